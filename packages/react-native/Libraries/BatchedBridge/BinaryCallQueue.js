@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ *
+ * @flow strict
+ * @format
+ */
+
+'use strict';
+
+/**
+ * Encodes a queue of calls to native modules (`[moduleIds, methodIds,
+ * params, callId]`) in the binary format read by `BinaryMethodCallQueue` in
+ * ReactCommon/cxxreact. See `BinaryMethodCallQueue.h` for the layout.
+ *
+ * Values are converted the same way `jsi::dynamicFromValue` does: functions
+ * become `null`, `undefined` becomes `null` and object properties set to
+ * `undefined` are dropped.
+ */
+
+const MAGIC = 0x51424e52; // "RNBQ"
+const VERSION = 1;
+
+const HEADER_SIZE = 16;
+const CALL_ENTRY_SIZE = 16;
+const INITIAL_CAPACITY = 1024;
+
+const TAG_NULL = 0;
+const TAG_FALSE = 1;
+const TAG_TRUE = 2;
+const TAG_NUMBER = 3;
+const TAG_STRING = 4;
+const TAG_ARRAY = 5;
+const TAG_OBJECT = 6;
+
+class Writer {
+  _bytes: Uint8Array;
+  _view: DataView;
+  position: number;
+
+  constructor(capacity: number) {
+    this._bytes = new Uint8Array(capacity);
+    this._view = new DataView(this._bytes.buffer);
+    this.position = 0;
+  }
+
+  _ensureCapacity(size: number): void {
+    const required = this.position + size;
+    if (required <= this._bytes.length) {
+      return;
+    }
+    let capacity = this._bytes.length * 2;
+    while (capacity < required) {
+      capacity *= 2;
+    }
+    const bytes = new Uint8Array(capacity);
+    bytes.set(this._bytes.subarray(0, this.position));
+    this._bytes = bytes;
+    this._view = new DataView(bytes.buffer);
+  }
+
+  writeUint8(value: number): void {
+    this._ensureCapacity(1);
+    this._bytes[this.position++] = value;
+  }
+
+  writeUint32(value: number): void {
+    this._ensureCapacity(4);
+    this._view.setUint32(this.position, value, true);
+    this.position += 4;
+  }
+
+  writeInt32(value: number): void {
+    this._ensureCapacity(4);
+    this._view.setInt32(this.position, value, true);
+    this.position += 4;
+  }
+
+  patchUint32(position: number, value: number): void {
+    this._view.setUint32(position, value, true);
+  }
+
+  writeFloat64(value: number): void {
+    this._ensureCapacity(8);
+    this._view.setFloat64(this.position, value, true);
+    this.position += 8;
+  }
+
+  writeString(value: string): void {
+    // Every UTF-16 code unit takes at most 3 bytes in UTF-8.
+    this._ensureCapacity(4 + value.length * 3);
+    const lengthPosition = this.position;
+    this.position += 4;
+    const bytes = this._bytes;
+    let position = this.position;
+    for (let i = 0; i < value.length; i++) {
+      let codePoint = value.charCodeAt(i);
+      if (
+        codePoint >= 0xd800 &&
+        codePoint <= 0xdbff &&
+        i + 1 < value.length
+      ) {
+        const next = value.charCodeAt(i + 1);
+        if (next >= 0xdc00 && next <= 0xdfff) {
+          codePoint =
+            0x10000 + ((codePoint - 0xd800) << 10) + (next - 0xdc00);
+          i++;
+        }
+      }
+      if (codePoint < 0x80) {
+        bytes[position++] = codePoint;
+      } else if (codePoint < 0x800) {
+        bytes[position++] = 0xc0 | (codePoint >> 6);
+        bytes[position++] = 0x80 | (codePoint & 0x3f);
+      } else if (codePoint < 0x10000) {
+        bytes[position++] = 0xe0 | (codePoint >> 12);
+        bytes[position++] = 0x80 | ((codePoint >> 6) & 0x3f);
+        bytes[position++] = 0x80 | (codePoint & 0x3f);
+      } else {
+        bytes[position++] = 0xf0 | (codePoint >> 18);
+        bytes[position++] = 0x80 | ((codePoint >> 12) & 0x3f);
+        bytes[position++] = 0x80 | ((codePoint >> 6) & 0x3f);
+        bytes[position++] = 0x80 | (codePoint & 0x3f);
+      }
+    }
+    this._view.setUint32(lengthPosition, position - this.position, true);
+    this.position = position;
+  }
+
+  writeValue(value: mixed): void {
+    switch (typeof value) {
+      case 'boolean':
+        this.writeUint8(value ? TAG_TRUE : TAG_FALSE);
+        return;
+      case 'number':
+        this.writeUint8(TAG_NUMBER);
+        this.writeFloat64(value);
+        return;
+      case 'string':
+        this.writeUint8(TAG_STRING);
+        this.writeString(value);
+        return;
+      case 'object': {
+        if (value == null) {
+          break;
+        }
+        if (Array.isArray(value)) {
+          this.writeUint8(TAG_ARRAY);
+          this.writeUint32(value.length);
+          for (let i = 0; i < value.length; i++) {
+            this.writeValue(value[i]);
+          }
+          return;
+        }
+        this.writeUint8(TAG_OBJECT);
+        const sizePosition = this.position;
+        this.writeUint32(0);
+        let size = 0;
+        for (const key in value) {
+          const element = value[key];
+          if (element === undefined) {
+            continue;
+          }
+          this.writeString(key);
+          this.writeValue(element);
+          size++;
+        }
+        this.patchUint32(sizePosition, size);
+        return;
+      }
+    }
+    this.writeUint8(TAG_NULL);
+  }
+
+  release(): ArrayBuffer {
+    return this._bytes.buffer.slice(0, this.position);
+  }
+}
+
+function encodeBinaryCallQueue(
+  queue: [Array<number>, Array<number>, Array<mixed>, number],
+): ArrayBuffer {
+  const [moduleIds, methodIds, params, callId] = queue;
+  const callCount = moduleIds.length;
+
+  const writer = new Writer(
+    Math.max(INITIAL_CAPACITY, HEADER_SIZE + callCount * CALL_ENTRY_SIZE * 2),
+  );
+  writer.writeUint32(MAGIC);
+  writer.writeUint32(VERSION);
+  writer.writeUint32(callCount);
+  writer.writeInt32(callId);
+
+  const callTablePosition = writer.position;
+  for (let i = 0; i < callCount; i++) {
+    writer.writeInt32(moduleIds[i]);
+    writer.writeInt32(methodIds[i]);
+    // Patched below.
+    writer.writeUint32(0);
+    writer.writeUint32(0);
+  }
+
+  for (let i = 0; i < callCount; i++) {
+    const offset = writer.position;
+    writer.writeValue(params[i]);
+    const entryPosition = callTablePosition + i * CALL_ENTRY_SIZE;
+    writer.patchUint32(entryPosition + 8, offset);
+    writer.patchUint32(entryPosition + 12, writer.position - offset);
+  }
+
+  return writer.release();
+}
+
+module.exports = {encodeBinaryCallQueue};
@@ -16,6 +16,7 @@ const deepFreezeAndThrowOnMutationInDev =
 const stringifySafe = require('../Utilities/stringifySafe').default;
 const warnOnce = require('../Utilities/warnOnce').default;
 const ErrorUtils = require('../vendor/core/ErrorUtils').default;
+const {encodeBinaryCallQueue} = require('./BinaryCallQueue');
 const invariant = require('invariant');
 
 export type SpyData = {
@@ -26,6 +27,13 @@ export type SpyData = {
   ...
 };
 
+// Queues are flushed to native as an ArrayBuffer (see BinaryCallQueue.js)
+// when `global.__fbBatchedBridgeBinaryQueue` is set.
+export type FlushedQueue =
+  | null
+  | [Array<number>, Array<number>, Array<mixed>, number]
+  | ArrayBuffer;
+
 const TO_JS = 0;
 const TO_NATIVE = 1;
 
@@ -109,7 +117,7 @@ class MessageQueue {
     module: string,
     method: string,
     args: mixed[],
-  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  ): FlushedQueue {
     this.__guard(() => {
       this.__callFunction(module, method, args);
     });
@@ -120,7 +128,7 @@ class MessageQueue {
   invokeCallbackAndReturnFlushedQueue(
     cbID: number,
     args: mixed[],
-  ): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  ): FlushedQueue {
     this.__guard(() => {
       this.__invokeCallback(cbID, args);
     });
@@ -128,14 +136,14 @@ class MessageQueue {
     return this.flushedQueue();
   }
 
-  flushedQueue(): null | [Array<number>, Array<number>, Array<mixed>, number] {
+  flushedQueue(): FlushedQueue {
     this.__guard(() => {
       this.__callReactNativeMicrotasks();
     });
 
     const queue = this._queue;
     this._queue = [[], [], [], this._callID];
-    return queue[0].length ? queue : null;
+    return queue[0].length ? this.__encodeQueue(queue) : null;
   }
 
   getEventLoopRunningTime(): number {
@@ -318,7 +326,7 @@ class MessageQueue {
       const queue = this._queue;
       this._queue = [[], [], [], this._callID];
       this._lastFlush = now;
-      global.nativeFlushQueueImmediate(queue);
+      global.nativeFlushQueueImmediate(this.__encodeQueue(queue));
     }
     Systrace.counterEvent('pending_js_to_native_queue', this._queue[0].length);
     if (__DEV__ && this.__spy && isFinite(moduleID)) {
@@ -387,6 +395,14 @@ class MessageQueue {
     );
   }
 
+  __encodeQueue(
+    queue: [Array<number>, Array<number>, Array<mixed>, number],
+  ): FlushedQueue {
+    return global.__fbBatchedBridgeBinaryQueue === true
+      ? encodeBinaryCallQueue(queue)
+      : queue;
+  }
+
   __callReactNativeMicrotasks() {
     Systrace.beginEvent('JSTimers.callReactNativeMicrotasks()');
     try {
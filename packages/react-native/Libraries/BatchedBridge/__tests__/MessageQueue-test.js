@@ -10,6 +10,8 @@
 
 'use strict';
 
+import type {FlushedQueue} from '../MessageQueue';
+
 let MessageQueue;
 let MessageQueueTestModule;
 let queue;
@@ -19,14 +21,14 @@ const METHOD_IDS = 1;
 const PARAMS = 2;
 
 const assertQueue = (
-  flushedQueue: null | [Array<number>, Array<number>, Array<mixed>, number],
+  flushedQueue: FlushedQueue,
   index: number,
   moduleID: number,
   methodID: number,
   params: $ReadOnlyArray<mixed>,
 ) => {
-  if (flushedQueue == null) {
-    throw new Error('Expected `flushedQueue` to be non-null');
+  if (flushedQueue == null || flushedQueue instanceof ArrayBuffer) {
+    throw new Error('Expected `flushedQueue` to be a non-null array');
   }
   expect(flushedQueue[MODULE_IDS][index]).toEqual(moduleID);
   expect(flushedQueue[METHOD_IDS][index]).toEqual(methodID);
@@ -61,6 +63,47 @@ describe('MessageQueue', () => {
     assertQueue(flushedQueue, 0, 0, 1, [2]);
   });
 
+  it('should enqueue native calls in the binary format if enabled', () => {
+    global.__fbBatchedBridgeBinaryQueue = true;
+    try {
+      queue.enqueueNativeCall(3, 4, ['héllo', {a: 1, b: undefined}]);
+      const flushedQueue = queue.flushedQueue();
+      if (!(flushedQueue instanceof ArrayBuffer)) {
+        throw new Error('Expected `flushedQueue` to be an ArrayBuffer');
+      }
+
+      const view = new DataView(flushedQueue);
+      expect(view.getUint32(0, true)).toEqual(0x51424e52);
+      expect(view.getUint32(4, true)).toEqual(1);
+      // Call count and call id.
+      expect(view.getUint32(8, true)).toEqual(1);
+      expect(view.getInt32(12, true)).toEqual(0);
+      // Module id and method id of the first call.
+      expect(view.getInt32(16, true)).toEqual(3);
+      expect(view.getInt32(20, true)).toEqual(4);
+
+      const argumentsOffset = view.getUint32(24, true);
+      const argumentsSize = view.getUint32(28, true);
+      expect(argumentsOffset + argumentsSize).toEqual(flushedQueue.byteLength);
+      expect(
+        Array.from(
+          new Uint8Array(flushedQueue, argumentsOffset, argumentsSize),
+        ),
+      ).toEqual([
+        // Array of 2 values.
+        5, 2, 0, 0, 0,
+        // String "héllo".
+        4, 6, 0, 0, 0, 0x68, 0xc3, 0xa9, 0x6c, 0x6c, 0x6f,
+        // Object with a single property, as `b` is undefined.
+        6, 1, 0, 0, 0, 1, 0, 0, 0, 0x61,
+        // Number 1.
+        3, 0, 0, 0, 0, 0, 0, 0xf0, 0x3f,
+      ]);
+    } finally {
+      delete global.__fbBatchedBridgeBinaryQueue;
+    }
+  });
+
   it('should call a local function with the function name', () => {
     const testHook2 = jest.fn();
     MessageQueueTestModule.testHook2 = testHook2;
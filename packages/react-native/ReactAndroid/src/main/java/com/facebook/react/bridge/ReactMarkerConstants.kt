@@ -94,6 +94,8 @@ public enum class ReactMarkerConstants(
   CREATE_MC_MODULE_GET_METADATA_END,
   REGISTER_JS_SEGMENT_START(true),
   REGISTER_JS_SEGMENT_STOP(true),
+  INSTALL_RUNTIME_BINDING_START(true),
+  INSTALL_RUNTIME_BINDING_END(true),
   VM_INIT,
   ON_FRAGMENT_CREATE,
   JAVASCRIPT_EXECUTOR_FACTORY_INJECT_START,
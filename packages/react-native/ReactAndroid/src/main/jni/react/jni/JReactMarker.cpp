@@ -106,6 +106,13 @@ void JReactMarker::logPerfMarkerWithInstanceKey(
     case ReactMarker::REGISTER_JS_SEGMENT_STOP:
       JReactMarker::logMarker("REGISTER_JS_SEGMENT_STOP", tag, instanceKey);
       break;
+    case ReactMarker::INSTALL_RUNTIME_BINDING_START:
+      JReactMarker::logMarker(
+          "INSTALL_RUNTIME_BINDING_START", tag, instanceKey);
+      break;
+    case ReactMarker::INSTALL_RUNTIME_BINDING_STOP:
+      JReactMarker::logMarker("INSTALL_RUNTIME_BINDING_END", tag, instanceKey);
+      break;
     case ReactMarker::NATIVE_REQUIRE_START:
     case ReactMarker::NATIVE_REQUIRE_STOP:
     case ReactMarker::REACT_INSTANCE_INIT_START:
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BinaryMethodCallQueue.h"
+
+#ifndef RCT_FIT_RM_OLD_RUNTIME
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kCallEntrySize = 16;
+
+// Arguments are decoded recursively, so the depth is bounded to fail
+// gracefully on malicious or corrupted input.
+constexpr size_t kMaxValueDepth = 256;
+
+enum ValueTag : uint8_t {
+  Null = 0,
+  False = 1,
+  True = 2,
+  Number = 3,
+  String = 4,
+  Array = 5,
+  Object = 6,
+};
+
+const char* errorPrefix = "Malformed calls from JS: ";
+
+[[noreturn]] void throwMalformed(const std::string& reason) {
+  throw std::invalid_argument(std::string(errorPrefix) + reason);
+}
+
+uint32_t readUint32LittleEndian(const uint8_t* data) {
+  return static_cast<uint32_t>(data[0]) |
+      (static_cast<uint32_t>(data[1]) << 8) |
+      (static_cast<uint32_t>(data[2]) << 16) |
+      (static_cast<uint32_t>(data[3]) << 24);
+}
+
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  bool atEnd() const {
+    return position_ == size_;
+  }
+
+  uint8_t readUint8() {
+    ensureAvailable(1);
+    return data_[position_++];
+  }
+
+  uint32_t readUint32() {
+    ensureAvailable(4);
+    auto value = readUint32LittleEndian(data_ + position_);
+    position_ += 4;
+    return value;
+  }
+
+  double readDouble() {
+    ensureAvailable(8);
+    auto low = readUint32LittleEndian(data_ + position_);
+    auto high = readUint32LittleEndian(data_ + position_ + 4);
+    auto bits =
+        static_cast<uint64_t>(low) | (static_cast<uint64_t>(high) << 32);
+    position_ += 8;
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string readString() {
+    auto length = readUint32();
+    ensureAvailable(length);
+    auto value =
+        std::string(reinterpret_cast<const char*>(data_ + position_), length);
+    position_ += length;
+    return value;
+  }
+
+  // Every element takes at least a byte, which bounds the size of
+  // collections before allocating them.
+  uint32_t readCollectionSize() {
+    auto size = readUint32();
+    ensureAvailable(size);
+    return size;
+  }
+
+  folly::dynamic readValue(size_t depth) {
+    if (depth > kMaxValueDepth) {
+      throwMalformed("arguments are nested too deeply");
+    }
+
+    auto tag = readUint8();
+    switch (tag) {
+      case ValueTag::Null:
+        return nullptr;
+      case ValueTag::False:
+        return false;
+      case ValueTag::True:
+        return true;
+      case ValueTag::Number:
+        return readDouble();
+      case ValueTag::String:
+        return readString();
+      case ValueTag::Array: {
+        auto size = readCollectionSize();
+        auto array = folly::dynamic::array();
+        array.reserve(size);
+        for (uint32_t i = 0; i < size; i++) {
+          array.push_back(readValue(depth + 1));
+        }
+        return array;
+      }
+      case ValueTag::Object: {
+        auto size = readCollectionSize();
+        auto object = folly::dynamic::object();
+        for (uint32_t i = 0; i < size; i++) {
+          auto key = readString();
+          object.insert(std::move(key), readValue(depth + 1));
+        }
+        return object;
+      }
+      default:
+        throwMalformed("unknown value tag " + std::to_string(tag));
+    }
+  }
+
+ private:
+  void ensureAvailable(size_t size) const {
+    if (size > size_ - position_) {
+      throwMalformed("unexpected end of binary queue");
+    }
+  }
+
+  const uint8_t* data_;
+  size_t size_;
+  size_t position_{0};
+};
+
+class Writer {
+ public:
+  void writeUint8(uint8_t value) {
+    data_.push_back(value);
+  }
+
+  void writeUint32(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      data_.push_back(static_cast<uint8_t>(value >> (i * 8)));
+    }
+  }
+
+  void writeDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUint32(static_cast<uint32_t>(bits));
+    writeUint32(static_cast<uint32_t>(bits >> 32));
+  }
+
+  void writeString(const std::string& value) {
+    writeUint32(static_cast<uint32_t>(value.size()));
+    data_.insert(data_.end(), value.begin(), value.end());
+  }
+
+  void writeValue(const folly::dynamic& value) {
+    switch (value.type()) {
+      case folly::dynamic::NULLT:
+        writeUint8(ValueTag::Null);
+        break;
+      case folly::dynamic::BOOL:
+        writeUint8(value.getBool() ? ValueTag::True : ValueTag::False);
+        break;
+      case folly::dynamic::INT64:
+        writeUint8(ValueTag::Number);
+        writeDouble(static_cast<double>(value.getInt()));
+        break;
+      case folly::dynamic::DOUBLE:
+        writeUint8(ValueTag::Number);
+        writeDouble(value.getDouble());
+        break;
+      case folly::dynamic::STRING:
+        writeUint8(ValueTag::String);
+        writeString(value.getString());
+        break;
+      case folly::dynamic::ARRAY:
+        writeUint8(ValueTag::Array);
+        writeUint32(static_cast<uint32_t>(value.size()));
+        for (const auto& element : value) {
+          writeValue(element);
+        }
+        break;
+      case folly::dynamic::OBJECT:
+        writeUint8(ValueTag::Object);
+        writeUint32(static_cast<uint32_t>(value.size()));
+        for (const auto& [key, element] : value.items()) {
+          writeString(key.asString());
+          writeValue(element);
+        }
+        break;
+    }
+  }
+
+  void patchUint32(size_t position, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      data_[position + i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+  }
+
+  size_t size() const {
+    return data_.size();
+  }
+
+  std::vector<uint8_t> release() {
+    return std::move(data_);
+  }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+} // namespace
+
+BinaryMethodCallQueue::BinaryMethodCallQueue(const uint8_t* data, size_t size)
+    : data_(data), size_(size) {
+  auto reader = Reader{data, size};
+  if (size < kHeaderSize || reader.readUint32() != kMagic) {
+    throwMalformed("invalid binary queue header");
+  }
+  auto version = reader.readUint32();
+  if (version != kVersion) {
+    throwMalformed(
+        "unsupported binary queue version " + std::to_string(version));
+  }
+  callCount_ = reader.readUint32();
+  callId_ = static_cast<int>(static_cast<int32_t>(reader.readUint32()));
+
+  if (callCount_ > (size - kHeaderSize) / kCallEntrySize) {
+    throwMalformed("call table exceeds binary queue size");
+  }
+}
+
+size_t BinaryMethodCallQueue::size() const {
+  return callCount_;
+}
+
+int BinaryMethodCallQueue::getModuleId(size_t index) const {
+  return static_cast<int32_t>(
+      readUint32LittleEndian(data_ + kHeaderSize + index * kCallEntrySize));
+}
+
+int BinaryMethodCallQueue::getMethodId(size_t index) const {
+  return static_cast<int32_t>(
+      readUint32LittleEndian(data_ + kHeaderSize + index * kCallEntrySize + 4));
+}
+
+int BinaryMethodCallQueue::getCallId(size_t index) const {
+  // Only increment the call id if the queue contains a valid one, as it's
+  // optional.
+  return callId_ != -1 ? callId_ + static_cast<int>(index) : -1;
+}
+
+folly::dynamic BinaryMethodCallQueue::getArguments(size_t index) const {
+  const auto* entry = data_ + kHeaderSize + index * kCallEntrySize;
+  auto offset = readUint32LittleEndian(entry + 8);
+  auto size = readUint32LittleEndian(entry + 12);
+  if (offset > size_ || size > size_ - offset) {
+    throwMalformed("method arguments exceed binary queue size");
+  }
+
+  auto reader = Reader{data_ + offset, size};
+  auto arguments = reader.readValue(0);
+  if (!arguments.isArray()) {
+    throwMalformed(
+        std::string("method arguments isn't array but ") +
+        arguments.typeName());
+  }
+  if (!reader.atEnd()) {
+    throwMalformed("unexpected data after method arguments");
+  }
+  return arguments;
+}
+
+folly::dynamic BinaryMethodCallQueue::toDynamic() const {
+  auto moduleIds = folly::dynamic::array();
+  auto methodIds = folly::dynamic::array();
+  auto params = folly::dynamic::array();
+  for (size_t i = 0; i < callCount_; i++) {
+    moduleIds.push_back(getModuleId(i));
+    methodIds.push_back(getMethodId(i));
+    params.push_back(getArguments(i));
+  }
+  return folly::dynamic::array(
+      std::move(moduleIds), std::move(methodIds), std::move(params), callId_);
+}
+
+std::vector<uint8_t> encodeBinaryMethodCallQueue(const folly::dynamic& calls) {
+  if (!calls.isArray() || calls.size() < 3) {
+    throwMalformed("queue isn't an array of at least 3 elements");
+  }
+
+  const auto& moduleIds = calls[0];
+  const auto& methodIds = calls[1];
+  const auto& params = calls[2];
+  if (!moduleIds.isArray() || !methodIds.isArray() || !params.isArray() ||
+      moduleIds.size() != methodIds.size() ||
+      moduleIds.size() != params.size()) {
+    throwMalformed("fields aren't arrays of the same size");
+  }
+
+  auto callId = calls.size() > 3 ? calls[3].asInt() : -1;
+
+  auto writer = Writer{};
+  writer.writeUint32(BinaryMethodCallQueue::kMagic);
+  writer.writeUint32(BinaryMethodCallQueue::kVersion);
+  writer.writeUint32(static_cast<uint32_t>(moduleIds.size()));
+  writer.writeUint32(static_cast<uint32_t>(static_cast<int32_t>(callId)));
+
+  auto callTableOffset = writer.size();
+  for (size_t i = 0; i < moduleIds.size(); i++) {
+    writer.writeUint32(static_cast<uint32_t>(moduleIds[i].asInt()));
+    writer.writeUint32(static_cast<uint32_t>(methodIds[i].asInt()));
+    // Patched below.
+    writer.writeUint32(0);
+    writer.writeUint32(0);
+  }
+
+  for (size_t i = 0; i < params.size(); i++) {
+    auto offset = writer.size();
+    writer.writeValue(params[i]);
+    auto entryOffset = callTableOffset + i * kCallEntrySize;
+    writer.patchUint32(entryOffset + 8, static_cast<uint32_t>(offset));
+    writer.patchUint32(
+        entryOffset + 12, static_cast<uint32_t>(writer.size() - offset));
+  }
+
+  return writer.release();
+}
+
+} // namespace facebook::react
+
+#endif // RCT_FIT_RM_OLD_RUNTIME
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#ifndef RCT_FIT_RM_OLD_RUNTIME
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <folly/dynamic.h>
+
+namespace facebook::react {
+
+/*
+ * Read-only view of a queue of calls from JS to native modules, in the
+ * binary format produced by `MessageQueue` when
+ * `global.__fbBatchedBridgeBinaryQueue` is enabled.
+ *
+ * The format is equivalent to `[moduleIds, methodIds, params, callId]`, but
+ * the arguments of each call are only decoded when requested, so no work is
+ * done for calls that are never dispatched.
+ *
+ * All integers are little-endian.
+ *
+ *   Header:     u32 magic ("RNBQ"), u32 version, u32 callCount, i32 callId
+ *   Call table: callCount x (i32 moduleId, i32 methodId,
+ *                            u32 argumentsOffset, u32 argumentsSize)
+ *   Arguments:  one encoded array per call, at the given offset (from the
+ *               start of the queue) and size.
+ *
+ * Values are encoded as a u8 tag followed by the payload:
+ *
+ *   0 null, 1 false, 2 true,
+ *   3 number (f64),
+ *   4 string (u32 byte length, UTF-8 bytes),
+ *   5 array (u32 length, values),
+ *   6 object (u32 size, pairs of keys encoded as strings without tag and
+ *            values)
+ */
+class BinaryMethodCallQueue {
+ public:
+  static constexpr uint32_t kMagic = 0x51424e52; // "RNBQ"
+  static constexpr uint32_t kVersion = 1;
+
+  /*
+   * Doesn't copy the data, which must outlive this object.
+   * \throws std::invalid_argument if the header or the call table are
+   * malformed.
+   */
+  BinaryMethodCallQueue(const uint8_t* data, size_t size);
+
+  size_t size() const;
+
+  int getModuleId(size_t index) const;
+  int getMethodId(size_t index) const;
+  int getCallId(size_t index) const;
+
+  /*
+   * Decodes the arguments of the call at the given index.
+   * \throws std::invalid_argument if they are malformed.
+   */
+  folly::dynamic getArguments(size_t index) const;
+
+  /*
+   * Decodes the whole queue into the format used by `parseMethodCalls`.
+   */
+  folly::dynamic toDynamic() const;
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t callCount_;
+  int callId_;
+};
+
+/*
+ * Encodes a queue in the `[moduleIds, methodIds, params, callId]` format.
+ * Every `folly::dynamic` value is kept as is, including non-finite numbers,
+ * like the JS encoder does for the values converted by `dynamicFromValue`.
+ * \throws std::invalid_argument if the queue is malformed.
+ */
+std::vector<uint8_t> encodeBinaryMethodCallQueue(const folly::dynamic& calls);
+
+} // namespace facebook::react
+
+#endif // RCT_FIT_RM_OLD_RUNTIME
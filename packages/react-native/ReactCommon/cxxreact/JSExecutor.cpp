@@ -7,6 +7,7 @@
 
 #include "JSExecutor.h"
 
+#include "BinaryMethodCallQueue.h"
 #include "RAMBundleRegistry.h"
 
 #include <jsinspector-modern/ReactCdp.h>
@@ -15,6 +16,15 @@
 
 namespace facebook::react {
 
+#ifndef RCT_FIT_RM_OLD_RUNTIME
+void ExecutorDelegate::callNativeModules(
+    JSExecutor& executor,
+    const BinaryMethodCallQueue& calls,
+    bool isEndOfBatch) {
+  callNativeModules(executor, calls.toDynamic(), isEndOfBatch);
+}
+#endif // RCT_FIT_RM_OLD_RUNTIME
+
 std::string JSExecutor::getSyntheticBundlePath(
     uint32_t bundleId,
     const std::string& bundlePath) {
@@ -22,6 +22,7 @@
 
 namespace facebook::react {
 
+class BinaryMethodCallQueue;
 class JSBigString;
 class JSExecutor;
 class JSModulesUnbundle;
@@ -41,6 +42,18 @@ class ExecutorDelegate {
       JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) = 0;
+#ifndef RCT_FIT_RM_OLD_RUNTIME
+  /**
+   * Same as above, for queues in the binary format. The queue is only valid
+   * for the duration of the call.
+   * The default implementation decodes the whole queue and forwards it to the
+   * `folly::dynamic` overload.
+   */
+  virtual void callNativeModules(
+      JSExecutor& executor,
+      const BinaryMethodCallQueue& calls,
+      bool isEndOfBatch);
+#endif // RCT_FIT_RM_OLD_RUNTIME
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor& executor,
       unsigned int moduleId,
@@ -15,6 +15,7 @@
 #include <jsi/jsi.h>
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
 
+#include "BinaryMethodCallQueue.h"
 #include "ErrorUtils.h"
 #include "Instance.h"
 #include "JSBigString.h"
@@ -71,17 +72,31 @@ class JsToNativeBridge : public react::ExecutorDelegate {
       m_registry->callNativeMethod(
           call.moduleId, call.methodId, std::move(call.arguments), call.callId);
     }
-    if (isEndOfBatch) {
-      // onBatchComplete will be called on the native (module) queue, but
-      // decrementPendingJSCalls will be called sync. Be aware that the bridge
-      // may still be processing native calls when the bridge idle signaler
-      // fires.
-      if (m_batchHadNativeModuleOrTurboModuleCalls) {
-        m_callback->onBatchComplete();
-        m_batchHadNativeModuleOrTurboModuleCalls = false;
-      }
-      m_callback->decrementPendingJSCalls();
+    onBatchProcessed(isEndOfBatch);
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor& executor,
+      const BinaryMethodCallQueue& calls,
+      bool isEndOfBatch) override {
+    CHECK(m_registry || calls.size() == 0)
+        << "native module calls cannot be completed with no native modules";
+    m_batchHadNativeModuleOrTurboModuleCalls =
+        m_batchHadNativeModuleOrTurboModuleCalls || calls.size() > 0;
+
+    BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
+        (int)calls.size());
+
+    // Arguments are decoded right before each call is dispatched. Same as
+    // above, an exception stops processing of the batch.
+    for (size_t i = 0; i < calls.size(); i++) {
+      m_registry->callNativeMethod(
+          calls.getModuleId(i),
+          calls.getMethodId(i),
+          calls.getArguments(i),
+          calls.getCallId(i));
     }
+    onBatchProcessed(isEndOfBatch);
   }
 
   MethodCallResult callSerializableNativeHook(
@@ -98,6 +113,20 @@ class JsToNativeBridge : public react::ExecutorDelegate {
   }
 
  private:
+  void onBatchProcessed(bool isEndOfBatch) {
+    if (isEndOfBatch) {
+      // onBatchComplete will be called on the native (module) queue, but
+      // decrementPendingJSCalls will be called sync. Be aware that the bridge
+      // may still be processing native calls when the bridge idle signaler
+      // fires.
+      if (m_batchHadNativeModuleOrTurboModuleCalls) {
+        m_callback->onBatchComplete();
+        m_batchHadNativeModuleOrTurboModuleCalls = false;
+      }
+      m_callback->decrementPendingJSCalls();
+    }
+  }
+
   // These methods are always invoked from an Executor.  The NativeToJsBridge
   // keeps a reference to the executor, and when destroy() is called, the
   // executor is destroyed synchronously on its queue.
@@ -33,7 +33,9 @@ enum ReactMarkerId {
   REGISTER_JS_SEGMENT_START,
   REGISTER_JS_SEGMENT_STOP,
   REACT_INSTANCE_INIT_START,
-  REACT_INSTANCE_INIT_STOP
+  REACT_INSTANCE_INIT_STOP,
+  INSTALL_RUNTIME_BINDING_START,
+  INSTALL_RUNTIME_BINDING_STOP
 };
 
 #ifdef __APPLE__
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+#include <cxxreact/BinaryMethodCallQueue.h>
+#include <cxxreact/MethodCall.h>
+
+#include <folly/json.h>
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#include <gtest/gtest.h>
+#pragma GCC diagnostic pop
+
+using namespace facebook::react;
+using dynamic = folly::dynamic;
+
+namespace {
+
+dynamic makeQueue(size_t callCount) {
+  auto moduleIds = dynamic::array();
+  auto methodIds = dynamic::array();
+  auto params = dynamic::array();
+  for (size_t i = 0; i < callCount; i++) {
+    moduleIds.push_back(static_cast<int>(i % 7));
+    methodIds.push_back(static_cast<int>(i % 3));
+    params.push_back(dynamic::array(
+        static_cast<double>(i),
+        "view",
+        dynamic::object("width", 100.5)("height", 20)("hidden", false)(
+            "children", dynamic::array(1, 2, 3, nullptr))));
+  }
+  return dynamic::array(
+      std::move(moduleIds), std::move(methodIds), std::move(params), 42);
+}
+
+BinaryMethodCallQueue makeBinaryQueue(const std::vector<uint8_t>& data) {
+  return BinaryMethodCallQueue{data.data(), data.size()};
+}
+
+} // namespace
+
+TEST(BinaryMethodCallQueue, RoundTripMatchesParseMethodCalls) {
+  auto queue = makeQueue(10);
+  auto data = encodeBinaryMethodCallQueue(queue);
+  auto binaryQueue = makeBinaryQueue(data);
+
+  auto expectedCalls = parseMethodCalls(dynamic(queue));
+  ASSERT_EQ(binaryQueue.size(), expectedCalls.size());
+  for (size_t i = 0; i < binaryQueue.size(); i++) {
+    EXPECT_EQ(binaryQueue.getModuleId(i), expectedCalls[i].moduleId);
+    EXPECT_EQ(binaryQueue.getMethodId(i), expectedCalls[i].methodId);
+    EXPECT_EQ(binaryQueue.getCallId(i), expectedCalls[i].callId);
+    EXPECT_EQ(binaryQueue.getArguments(i), expectedCalls[i].arguments);
+  }
+
+  auto decodedCalls = parseMethodCalls(binaryQueue.toDynamic());
+  ASSERT_EQ(decodedCalls.size(), expectedCalls.size());
+  for (size_t i = 0; i < decodedCalls.size(); i++) {
+    EXPECT_EQ(decodedCalls[i].arguments, expectedCalls[i].arguments);
+    EXPECT_EQ(decodedCalls[i].callId, expectedCalls[i].callId);
+  }
+}
+
+TEST(BinaryMethodCallQueue, PreservesStringsAndNumbers) {
+  auto queue = dynamic::array(
+      dynamic::array(1),
+      dynamic::array(2),
+      dynamic::array(dynamic::array(
+          "", "h\xC3\xA9llo", -0.5, 1e300, dynamic::object("", true))));
+  auto binaryQueue = encodeBinaryMethodCallQueue(queue);
+
+  auto arguments = makeBinaryQueue(binaryQueue).getArguments(0);
+  EXPECT_EQ(arguments, queue[2][0]);
+  EXPECT_EQ(makeBinaryQueue(binaryQueue).getCallId(0), -1);
+}
+
+TEST(BinaryMethodCallQueue, PreservesNonFiniteNumbers) {
+  auto queue = dynamic::array(
+      dynamic::array(1),
+      dynamic::array(2),
+      dynamic::array(dynamic::array(
+          std::numeric_limits<double>::infinity(),
+          -std::numeric_limits<double>::infinity(),
+          std::numeric_limits<double>::quiet_NaN())));
+  auto binaryQueue = encodeBinaryMethodCallQueue(queue);
+
+  auto arguments = makeBinaryQueue(binaryQueue).getArguments(0);
+  ASSERT_EQ(arguments.size(), 3);
+  EXPECT_EQ(arguments[0].asDouble(), std::numeric_limits<double>::infinity());
+  EXPECT_EQ(arguments[1].asDouble(), -std::numeric_limits<double>::infinity());
+  EXPECT_TRUE(std::isnan(arguments[2].asDouble()));
+}
+
+TEST(BinaryMethodCallQueue, EmptyQueue) {
+  auto data = encodeBinaryMethodCallQueue(
+      dynamic::array(dynamic::array(), dynamic::array(), dynamic::array(), 1));
+  auto binaryQueue = makeBinaryQueue(data);
+  EXPECT_EQ(binaryQueue.size(), 0);
+  EXPECT_TRUE(parseMethodCalls(binaryQueue.toDynamic()).empty());
+}
+
+TEST(BinaryMethodCallQueue, InvalidHeader) {
+  auto data = encodeBinaryMethodCallQueue(makeQueue(1));
+
+  EXPECT_THROW(BinaryMethodCallQueue(data.data(), 8), std::invalid_argument);
+
+  auto badMagic = data;
+  badMagic[0] ^= 0xff;
+  EXPECT_THROW(makeBinaryQueue(badMagic), std::invalid_argument);
+
+  auto badVersion = data;
+  badVersion[4] = 2;
+  EXPECT_THROW(makeBinaryQueue(badVersion), std::invalid_argument);
+
+  auto badCallCount = data;
+  badCallCount[8] = 0xff;
+  EXPECT_THROW(makeBinaryQueue(badCallCount), std::invalid_argument);
+}
+
+TEST(BinaryMethodCallQueue, InvalidArguments) {
+  auto data = encodeBinaryMethodCallQueue(makeQueue(1));
+  // The call table entry of the first call starts after the header.
+  constexpr size_t argumentsOffsetPosition = 16 + 8;
+  constexpr size_t argumentsSizePosition = 16 + 12;
+
+  auto outOfBounds = data;
+  outOfBounds[argumentsOffsetPosition + 3] = 0xff;
+  EXPECT_THROW(
+      makeBinaryQueue(outOfBounds).getArguments(0), std::invalid_argument);
+
+  auto truncated = data;
+  truncated[argumentsSizePosition] -= 1;
+  EXPECT_THROW(
+      makeBinaryQueue(truncated).getArguments(0), std::invalid_argument);
+
+  auto notAnArray = encodeBinaryMethodCallQueue(dynamic::array(
+      dynamic::array(1), dynamic::array(2), dynamic::array("foo")));
+  EXPECT_THROW(
+      makeBinaryQueue(notAnArray).getArguments(0), std::invalid_argument);
+
+  // The arguments of the only call start right after the call table.
+  auto unknownTag = data;
+  unknownTag[16 + 16] = 0x7f;
+  EXPECT_THROW(
+      makeBinaryQueue(unknownTag).getArguments(0), std::invalid_argument);
+}
+
+TEST(BinaryMethodCallQueue, DeeplyNestedArguments) {
+  auto arguments = dynamic::array();
+  for (int i = 0; i < 1000; i++) {
+    arguments = dynamic::array(std::move(arguments));
+  }
+  auto data = encodeBinaryMethodCallQueue(dynamic::array(
+      dynamic::array(1), dynamic::array(2), dynamic::array(arguments)));
+  EXPECT_THROW(makeBinaryQueue(data).getArguments(0), std::invalid_argument);
+}
+
+TEST(BinaryMethodCallQueue, Throughput) {
+  using Clock = std::chrono::steady_clock;
+  constexpr size_t callCount = 1000;
+  constexpr int iterations = 20;
+
+  auto queue = makeQueue(callCount);
+  auto json = folly::toJson(queue);
+  auto data = encodeBinaryMethodCallQueue(queue);
+
+  // Baseline: the whole queue is materialized as `folly::dynamic` before
+  // dispatching (from JSON here, as there's no JS runtime in this test).
+  auto dynamicStart = Clock::now();
+  size_t dynamicArgumentCount = 0;
+  for (int i = 0; i < iterations; i++) {
+    for (auto& call : parseMethodCalls(folly::parseJson(json))) {
+      dynamicArgumentCount += call.arguments.size();
+    }
+  }
+  auto dynamicDuration = Clock::now() - dynamicStart;
+
+  // Binary path: arguments are decoded per call, right before dispatching.
+  auto binaryStart = Clock::now();
+  size_t binaryArgumentCount = 0;
+  for (int i = 0; i < iterations; i++) {
+    auto binaryQueue = makeBinaryQueue(data);
+    for (size_t j = 0; j < binaryQueue.size(); j++) {
+      binaryArgumentCount += binaryQueue.getArguments(j).size();
+    }
+  }
+  auto binaryDuration = Clock::now() - binaryStart;
+
+  auto toMicroseconds = [](Clock::duration duration) {
+    return static_cast<int>(
+        std::chrono::duration_cast<std::chrono::microseconds>(duration)
+            .count());
+  };
+
+  EXPECT_EQ(dynamicArgumentCount, binaryArgumentCount);
+  RecordProperty("dynamicMicroseconds", toMicroseconds(dynamicDuration));
+  RecordProperty("binaryMicroseconds", toMicroseconds(binaryDuration));
+  RecordProperty("binaryQueueBytes", static_cast<int>(data.size()));
+  RecordProperty("jsonQueueBytes", static_cast<int>(json.size()));
+}
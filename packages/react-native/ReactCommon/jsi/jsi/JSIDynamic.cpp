@@ -12,6 +12,12 @@
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
 
+#include <cstring>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
 using namespace facebook::jsi;
 
 namespace facebook {
@@ -148,6 +154,211 @@ void dynamicFromValueShallow(
   }
 }
 
+template <typename T>
+void dynamicFromTypedArrayElements(
+    const uint8_t* data,
+    size_t length,
+    const std::function<bool(const std::string&)>& filterObjectKeys,
+    folly::dynamic& output) {
+  for (size_t i = 0; i < length; ++i) {
+    auto key = std::to_string(i);
+    if (filterObjectKeys && filterObjectKeys(key)) {
+      continue;
+    }
+    // The buffer isn't necessarily aligned for T.
+    T element;
+    std::memcpy(&element, data + i * sizeof(T), sizeof(T));
+    output.insert(std::move(key), static_cast<double>(element));
+  }
+}
+
+// Typed arrays are converted like any other object (with a key per index),
+// but reading each element with `getProperty` is very slow, so we read them
+// straight from the underlying buffer instead.
+//
+// Their type and layout are read through the getters of
+// `%TypedArray%.prototype`, which check the internal slots of the receiver,
+// so objects that only look like typed arrays (through their `constructor` or
+// own properties) are converted by the slow path.
+class TypedArrayReader {
+ public:
+  // Converts `obj` if it's a typed array. `names` are the property names of
+  // the object, which for typed arrays are exactly the indices of the
+  // elements.
+  bool read(
+      Runtime& runtime,
+      const Object& obj,
+      const Array& names,
+      const std::function<bool(const std::string&)>& filterObjectKeys,
+      folly::dynamic& output) {
+    if (!initialized_) {
+      initialize(runtime);
+      initialized_ = true;
+    }
+    if (!getTypeName_ || !getBuffer_ || !getByteOffset_ || !getLength_) {
+      return false;
+    }
+
+    // Returns `undefined` for anything but a typed array.
+    Value typeNameValue = getTypeName_->callWithThis(runtime, obj);
+    if (!typeNameValue.isString()) {
+      return false;
+    }
+    auto typeName = typeNameValue.getString(runtime).utf8(runtime);
+
+    size_t elementSize = 0;
+    if (typeName == "Int8Array" || typeName == "Uint8Array" ||
+        typeName == "Uint8ClampedArray") {
+      elementSize = 1;
+    } else if (typeName == "Int16Array" || typeName == "Uint16Array") {
+      elementSize = 2;
+    } else if (
+        typeName == "Int32Array" || typeName == "Uint32Array" ||
+        typeName == "Float32Array") {
+      elementSize = 4;
+    } else if (typeName == "Float64Array") {
+      elementSize = 8;
+    } else {
+      // BigInt arrays aren't convertible, and the slow path reports that.
+      return false;
+    }
+
+    Value bufferValue = getBuffer_->callWithThis(runtime, obj);
+    if (!bufferValue.isObject()) {
+      return false;
+    }
+    Object buffer = bufferValue.getObject(runtime);
+    if (!buffer.isArrayBuffer(runtime)) {
+      return false;
+    }
+    auto length = static_cast<size_t>(
+        getLength_->callWithThis(runtime, obj).asNumber());
+    auto byteOffset = static_cast<size_t>(
+        getByteOffset_->callWithThis(runtime, obj).asNumber());
+    if (names.size(runtime) != length) {
+      return false;
+    }
+
+    ArrayBuffer arrayBuffer = std::move(buffer).getArrayBuffer(runtime);
+    if (byteOffset + length * elementSize > arrayBuffer.size(runtime)) {
+      return false;
+    }
+    const uint8_t* data = arrayBuffer.data(runtime) + byteOffset;
+
+    if (typeName == "Int8Array") {
+      dynamicFromTypedArrayElements<int8_t>(
+          data, length, filterObjectKeys, output);
+    } else if (typeName == "Uint8Array" || typeName == "Uint8ClampedArray") {
+      dynamicFromTypedArrayElements<uint8_t>(
+          data, length, filterObjectKeys, output);
+    } else if (typeName == "Int16Array") {
+      dynamicFromTypedArrayElements<int16_t>(
+          data, length, filterObjectKeys, output);
+    } else if (typeName == "Uint16Array") {
+      dynamicFromTypedArrayElements<uint16_t>(
+          data, length, filterObjectKeys, output);
+    } else if (typeName == "Int32Array") {
+      dynamicFromTypedArrayElements<int32_t>(
+          data, length, filterObjectKeys, output);
+    } else if (typeName == "Uint32Array") {
+      dynamicFromTypedArrayElements<uint32_t>(
+          data, length, filterObjectKeys, output);
+    } else if (typeName == "Float32Array") {
+      dynamicFromTypedArrayElements<float>(
+          data, length, filterObjectKeys, output);
+    } else {
+      dynamicFromTypedArrayElements<double>(
+          data, length, filterObjectKeys, output);
+    }
+    return true;
+  }
+
+ private:
+  // Looks up the getters once per conversion, and only when an object may be
+  // a typed array. They are left empty if the runtime doesn't have them.
+  void initialize(Runtime& runtime) {
+    Value int8Array = runtime.global().getProperty(runtime, "Int8Array");
+    Value symbol = runtime.global().getProperty(runtime, "Symbol");
+    if (!int8Array.isObject() || !symbol.isObject()) {
+      return;
+    }
+    Object object = runtime.global().getPropertyAsObject(runtime, "Object");
+    Value int8ArrayPrototype =
+        int8Array.getObject(runtime).getProperty(runtime, "prototype");
+    Value prototype = object.getPropertyAsFunction(runtime, "getPrototypeOf")
+                          .call(runtime, int8ArrayPrototype);
+    if (!prototype.isObject()) {
+      return;
+    }
+
+    Function getOwnPropertyDescriptor =
+        object.getPropertyAsFunction(runtime, "getOwnPropertyDescriptor");
+    auto getGetter = [&](const Value& key) -> std::optional<Function> {
+      Value descriptor = getOwnPropertyDescriptor.call(runtime, prototype, key);
+      if (!descriptor.isObject()) {
+        return std::nullopt;
+      }
+      Value getter = descriptor.getObject(runtime).getProperty(runtime, "get");
+      if (!getter.isObject()) {
+        return std::nullopt;
+      }
+      Object getterObject = getter.getObject(runtime);
+      if (!getterObject.isFunction(runtime)) {
+        return std::nullopt;
+      }
+      return std::move(getterObject).getFunction(runtime);
+    };
+
+    getTypeName_ = getGetter(
+        symbol.getObject(runtime).getProperty(runtime, "toStringTag"));
+    getBuffer_ = getGetter(String::createFromAscii(runtime, "buffer"));
+    getByteOffset_ = getGetter(String::createFromAscii(runtime, "byteOffset"));
+    getLength_ = getGetter(String::createFromAscii(runtime, "length"));
+  }
+
+  bool initialized_{false};
+  std::optional<Function> getTypeName_;
+  std::optional<Function> getBuffer_;
+  std::optional<Function> getByteOffset_;
+  std::optional<Function> getLength_;
+};
+
+// Caches the UTF-8 version of the property names of the last converted
+// object. Objects converted one after another (e.g. the elements of an array)
+// usually have the same shape, and comparing property names is cheaper than
+// converting them again.
+class PropertyNameCache {
+ public:
+  // Returns the UTF-8 version of `name`. The reference is valid until the
+  // next call.
+  const std::string& utf8(Runtime& runtime, String name, size_t index) {
+    if (index < previousNames_.size() &&
+        String::strictEquals(runtime, name, previousNames_[index].first)) {
+      currentNames_.emplace_back(
+          std::move(name), std::move(previousNames_[index].second));
+    } else {
+      auto nameStr = name.utf8(runtime);
+      currentNames_.emplace_back(std::move(name), std::move(nameStr));
+    }
+    return currentNames_.back().second;
+  }
+
+  // The name passed in the last call to `utf8`.
+  const String& lastName() const {
+    return currentNames_.back().first;
+  }
+
+  // Called after all the property names of an object have been converted.
+  void finishObject() {
+    std::swap(previousNames_, currentNames_);
+    currentNames_.clear();
+  }
+
+ private:
+  std::vector<std::pair<String, std::string>> previousNames_;
+  std::vector<std::pair<String, std::string>> currentNames_;
+};
+
 } // namespace
 
 folly::dynamic dynamicFromValue(
@@ -156,6 +367,8 @@ folly::dynamic dynamicFromValue(
     const std::function<bool(const std::string&)>& filterObjectKeys) {
   std::vector<FromValue> stack;
   folly::dynamic ret;
+  PropertyNameCache propertyNameCache;
+  TypedArrayReader typedArrayReader;
 
   dynamicFromValueShallow(runtime, stack, valueInput, ret);
 
@@ -169,23 +382,32 @@ folly::dynamic dynamicFromValue(
       // the stack.
       Array array = top.obj.getArray(runtime);
       size_t arraySize = array.size(runtime);
-      for (size_t i = 0; i < arraySize; ++i) {
-        top.dyn->push_back(nullptr);
-      }
+      top.dyn->resize(arraySize, nullptr);
       for (size_t i = 0; i < arraySize; ++i) {
         dynamicFromValueShallow(
             runtime, stack, array.getValueAtIndex(runtime, i), top.dyn->at(i));
       }
+    } else if (top.obj.isArrayBuffer(runtime)) {
+      // ArrayBuffers don't have own enumerable properties, so they are
+      // converted to empty objects.
+      continue;
     } else {
       Array names = top.obj.getPropertyNames(runtime);
+      size_t namesSize = names.size(runtime);
       std::vector<std::pair<std::string, jsi::Value>> props;
-      for (size_t i = 0; i < names.size(runtime); ++i) {
-        String name = names.getValueAtIndex(runtime, i).getString(runtime);
+      for (size_t i = 0; i < namesSize; ++i) {
+        const auto& nameStr = propertyNameCache.utf8(
+            runtime, names.getValueAtIndex(runtime, i).getString(runtime), i);
+        const String& name = propertyNameCache.lastName();
+        if (i == 0 && nameStr == "0" &&
+            typedArrayReader.read(
+                runtime, top.obj, names, filterObjectKeys, *top.dyn)) {
+          break;
+        }
         Value prop = top.obj.getProperty(runtime, name);
         if (prop.isUndefined()) {
           continue;
         }
-        auto nameStr = name.utf8(runtime);
         if (filterObjectKeys && filterObjectKeys(nameStr)) {
           continue;
         }
@@ -195,9 +417,10 @@ folly::dynamic dynamicFromValue(
         if (prop.isObject() && prop.getObject(runtime).isFunction(runtime)) {
           prop = Value::null();
         }
-        props.emplace_back(std::move(nameStr), std::move(prop));
+        props.emplace_back(nameStr, std::move(prop));
         top.dyn->insert(props.back().first, nullptr);
       }
+      propertyNameCache.finishObject();
       for (const auto& prop : props) {
         dynamicFromValueShallow(
             runtime, stack, prop.second, (*top.dyn)[prop.first]);
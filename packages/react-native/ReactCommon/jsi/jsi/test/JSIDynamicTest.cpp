@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/test/testlib.h>
+
+#include <folly/json.h>
+#include <gtest/gtest.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+
+#include <string>
+
+using namespace facebook::jsi;
+
+class JSIDynamicTest : public JSITestBase {
+ public:
+  folly::dynamic convert(const std::string& source) {
+    return dynamicFromValue(rt, eval(("(" + source + ")").c_str()));
+  }
+};
+
+TEST_P(JSIDynamicTest, ConvertsTypedArraysLikeObjects) {
+  EXPECT_EQ(
+      convert("new Float64Array([0.5, -1, 3])"),
+      folly::parseJson(R"({"0": 0.5, "1": -1.0, "2": 3.0})"));
+  EXPECT_EQ(
+      convert("new Int16Array([-2, 7])"),
+      folly::parseJson(R"({"0": -2.0, "1": 7.0})"));
+
+  // Views into a larger buffer only include their own elements.
+  EXPECT_EQ(
+      convert("new Uint8Array(new Uint8Array([1, 2, 3, 4]).buffer, 1, 2)"),
+      folly::parseJson(R"({"0": 2.0, "1": 3.0})"));
+}
+
+TEST_P(JSIDynamicTest, IgnoresSpoofedTypedArrayProperties) {
+  // The element type and the layout come from the typed array itself.
+  EXPECT_EQ(
+      convert(
+          "Object.defineProperties(new Uint8Array([1, 2]), {"
+          "  constructor: {value: Float64Array},"
+          "  buffer: {value: new Float64Array([3, 4]).buffer},"
+          "  length: {value: 1},"
+          "})"),
+      folly::parseJson(R"({"0": 1.0, "1": 2.0})"));
+
+  // Objects that only look like typed arrays are converted as objects.
+  EXPECT_EQ(
+      convert(
+          "{0: 5, constructor: Uint8Array, length: 1, byteOffset: 0,"
+          " buffer: new Uint8Array([6]).buffer}"),
+      folly::parseJson(
+          R"({"0": 5.0, "constructor": null, "length": 1.0,
+              "byteOffset": 0.0, "buffer": {}})"));
+}
+
+TEST_P(JSIDynamicTest, ConvertsArrayBuffersToEmptyObjects) {
+  EXPECT_EQ(convert("new ArrayBuffer(16)"), folly::dynamic::object());
+}
+
+TEST_P(JSIDynamicTest, ConvertsObjectsWithSimilarShapes) {
+  EXPECT_EQ(
+      convert("[{a: 1, b: 2}, {a: 3, c: 4}, {0: 'x', b: 5}]"),
+      folly::parseJson(R"([{"a": 1.0, "b": 2.0}, {"a": 3.0, "c": 4.0},
+                           {"0": "x", "b": 5.0}])"));
+}
+
+INSTANTIATE_TEST_CASE_P(
+    Runtimes,
+    JSIDynamicTest,
+    ::testing::ValuesIn(runtimeGenerators()));
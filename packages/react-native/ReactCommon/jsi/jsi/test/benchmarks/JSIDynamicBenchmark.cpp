@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <string>
+
+namespace facebook::react {
+
+static std::unique_ptr<jsi::Runtime> runtime =
+    facebook::hermes::makeHermesRuntime();
+
+static jsi::Value evaluate(const std::string& source) {
+  return runtime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>("(" + source + ")"), "");
+}
+
+/*
+ * Queue of native module calls in the format used by `callNativeModules`:
+ * module ids, method ids, arguments and call id. Each call creates a view.
+ */
+static jsi::Value makeBridgeQueue(int callCount) {
+  return evaluate(
+      "(function (callCount) {"
+      "  var moduleIds = [], methodIds = [], params = [];"
+      "  for (var i = 0; i < callCount; i++) {"
+      "    moduleIds.push(12);"
+      "    methodIds.push(3);"
+      "    params.push([i * 2 + 3, 'RCTView', 1, {"
+      "      flex: 1, opacity: 0.5, backgroundColor: 4278190335,"
+      "      borderRadius: 4, testID: 'view-' + i, collapsable: false,"
+      "      transform: [{translateX: i}, {scale: 2}]"
+      "    }]);"
+      "  }"
+      "  return [moduleIds, methodIds, params, 42];"
+      "})(" +
+      std::to_string(callCount) + ")");
+}
+
+static jsi::Value makeNumberArray(int length) {
+  return evaluate(
+      "Array.from({length: " + std::to_string(length) +
+      "}, function (_, i) { return i * 0.5; })");
+}
+
+static jsi::Value makeFloat32Array(int length) {
+  return evaluate(
+      "Float32Array.from({length: " + std::to_string(length) +
+      "}, function (_, i) { return i * 0.5; })");
+}
+
+static void convertBridgeQueue(benchmark::State& state) {
+  auto value = makeBridgeQueue(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::dynamicFromValue(*runtime, value));
+  }
+}
+BENCHMARK(convertBridgeQueue)->Arg(10)->Arg(500);
+
+static void convertNumberArray(benchmark::State& state) {
+  auto value = makeNumberArray(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::dynamicFromValue(*runtime, value));
+  }
+}
+BENCHMARK(convertNumberArray)->Arg(100)->Arg(10000);
+
+static void convertTypedArray(benchmark::State& state) {
+  auto value = makeFloat32Array(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::dynamicFromValue(*runtime, value));
+  }
+}
+BENCHMARK(convertTypedArray)->Arg(100)->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
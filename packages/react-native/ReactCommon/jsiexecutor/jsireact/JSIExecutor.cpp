@@ -7,6 +7,7 @@
 
 #include "jsireact/JSIExecutor.h"
 
+#include <cxxreact/BinaryMethodCallQueue.h>
 #include <cxxreact/ErrorUtils.h>
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/ModuleRegistry.h>
@@ -16,6 +17,7 @@
 #include <glog/logging.h>
 #include <jsi/JSIDynamic.h>
 #include <jsi/instrumentation.h>
+#include <jsireact/RuntimePrelude.h>
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
 
 #include <sstream>
@@ -83,59 +85,58 @@ JSIExecutor::JSIExecutor(
 void JSIExecutor::initializeRuntime() {
   TraceSection s("JSIExecutor::initializeRuntime");
 
+  ReactMarker::logTaggedMarker(
+      ReactMarker::INSTALL_RUNTIME_BINDING_START, "nativePerformanceNow");
   bindNativePerformanceNow(*runtime_);
-
-  runtime_->global().setProperty(
-      *runtime_,
-      "nativeModuleProxy",
-      Object::createFromHostObject(
-          *runtime_, std::make_shared<NativeModuleProxy>(nativeModules_)));
-
-  runtime_->global().setProperty(
-      *runtime_,
-      "nativeFlushQueueImmediate",
-      Function::createFromHostFunction(
-          *runtime_,
-          PropNameID::forAscii(*runtime_, "nativeFlushQueueImmediate"),
-          1,
-          [this](
-              jsi::Runtime&,
-              const jsi::Value&,
-              const jsi::Value* args,
-              size_t count) {
-            if (count != 1) {
-              throw std::invalid_argument(
-                  "nativeFlushQueueImmediate arg count must be 1");
-            }
-            callNativeModules(args[0], false);
-            return Value::undefined();
-          }));
-
-  runtime_->global().setProperty(
-      *runtime_,
-      "nativeCallSyncHook",
-      Function::createFromHostFunction(
-          *runtime_,
-          PropNameID::forAscii(*runtime_, "nativeCallSyncHook"),
-          1,
-          [this](
-              jsi::Runtime&,
-              const jsi::Value&,
-              const jsi::Value* args,
-              size_t count) { return nativeCallSyncHook(args, count); }));
-
-  runtime_->global().setProperty(
-      *runtime_,
-      "globalEvalWithSourceUrl",
-      Function::createFromHostFunction(
-          *runtime_,
-          PropNameID::forAscii(*runtime_, "globalEvalWithSourceUrl"),
-          1,
-          [this](
-              jsi::Runtime&,
-              const jsi::Value&,
-              const jsi::Value* args,
-              size_t count) { return globalEvalWithSourceUrl(args, count); }));
+  ReactMarker::logTaggedMarker(
+      ReactMarker::INSTALL_RUNTIME_BINDING_STOP, "nativePerformanceNow");
+
+  // The bindings are the same for every runtime, so they're only described
+  // once per process, and installed in one pass.
+  static const auto prelude =
+      RuntimePrelude<JSIExecutor>{}
+          .value(
+              "nativeModuleProxy",
+              [](JSIExecutor& executor, Runtime& runtime) -> Value {
+                return Object::createFromHostObject(
+                    runtime,
+                    std::make_shared<NativeModuleProxy>(
+                        executor.nativeModules_));
+              })
+          .hostFunction(
+              "nativeFlushQueueImmediate",
+              1,
+              [](JSIExecutor& executor,
+                 Runtime&,
+                 const Value* args,
+                 size_t count) -> Value {
+                if (count != 1) {
+                  throw std::invalid_argument(
+                      "nativeFlushQueueImmediate arg count must be 1");
+                }
+                executor.callNativeModules(args[0], false);
+                return Value::undefined();
+              })
+          .hostFunction(
+              "nativeCallSyncHook",
+              1,
+              [](JSIExecutor& executor,
+                 Runtime&,
+                 const Value* args,
+                 size_t count) -> Value {
+                return executor.nativeCallSyncHook(args, count);
+              })
+          .hostFunction(
+              "globalEvalWithSourceUrl",
+              1,
+              [](JSIExecutor& executor,
+                 Runtime&,
+                 const Value* args,
+                 size_t count) -> Value {
+                return executor.globalEvalWithSourceUrl(args, count);
+              });
+
+  prelude.install(*runtime_, *this);
 
   if (runtimeInstaller_) {
     runtimeInstaller_(*runtime_);
@@ -397,6 +398,20 @@ void JSIExecutor::callNativeModules(const Value& queue, bool isEndOfBatch) {
 #endif
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
+  // Queues in the binary format are passed through without converting them
+  // to `folly::dynamic` first. The ArrayBuffer is kept alive by `queue` for
+  // the duration of the call.
+  if (queue.isObject()) {
+    auto queueObject = queue.getObject(*runtime_);
+    if (queueObject.isArrayBuffer(*runtime_)) {
+      auto arrayBuffer = queueObject.getArrayBuffer(*runtime_);
+      auto binaryQueue = BinaryMethodCallQueue(
+          arrayBuffer.data(*runtime_), arrayBuffer.size(*runtime_));
+      delegate_->callNativeModules(*this, binaryQueue, isEndOfBatch);
+      return;
+    }
+  }
+
   delegate_->callNativeModules(
       *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
 }
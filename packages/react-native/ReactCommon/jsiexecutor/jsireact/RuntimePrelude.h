@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cxxreact/ReactMarker.h>
+#include <jsi/jsi.h>
+#include <cstring>
+#include <vector>
+
+namespace facebook::react {
+
+// A RuntimePrelude is the list of globals an executor installs on every
+// runtime it initializes: host functions and values computed per runtime,
+// bound to a `Context` (usually the executor itself).
+//
+// The list is meant to be built once per process (e.g. in a function-local
+// static) and installed on each new runtime. Bindings are described by
+// plain function pointers, so only the description of the globals is shared
+// across runtimes, without allocating per binding. PropNameIDs belong to a
+// runtime and can't be shared: installing the list creates one per global,
+// used both for the global property and for the name of its host function
+// (instead of one for each).
+//
+// When a ReactMarker logger is set, every binding is timed with
+// INSTALL_RUNTIME_BINDING_START/STOP markers tagged with its name.
+//
+// Example usage:
+//
+//   static const auto prelude =
+//       RuntimePrelude<MyExecutor>{}
+//           .hostFunction(
+//               "nativeFoo",
+//               1,
+//               [](MyExecutor& executor,
+//                  jsi::Runtime& runtime,
+//                  const jsi::Value* args,
+//                  size_t count) { return executor.foo(args, count); })
+//           .value("nativeBar", [](MyExecutor& executor, jsi::Runtime&) {
+//             return executor.bar();
+//           });
+//   prelude.install(runtime, *this);
+template <typename Context>
+class RuntimePrelude {
+ public:
+  using HostFunction = jsi::Value (*)(
+      Context& context,
+      jsi::Runtime& runtime,
+      const jsi::Value* args,
+      size_t count);
+  using ValueFactory = jsi::Value (*)(Context& context, jsi::Runtime& runtime);
+
+  // `name` must be an ASCII string literal (or otherwise outlive the
+  // prelude).
+  RuntimePrelude&
+  hostFunction(const char* name, unsigned int paramCount, HostFunction fn) {
+    bindings_.push_back(Binding{name, paramCount, fn, nullptr});
+    return *this;
+  }
+
+  RuntimePrelude& value(const char* name, ValueFactory factory) {
+    bindings_.push_back(Binding{name, 0, nullptr, factory});
+    return *this;
+  }
+
+  size_t size() const {
+    return bindings_.size();
+  }
+
+  void install(jsi::Runtime& runtime, Context& context) const {
+    auto global = runtime.global();
+    for (const auto& binding : bindings_) {
+      ReactMarker::logTaggedMarker(
+          ReactMarker::INSTALL_RUNTIME_BINDING_START, binding.name);
+
+      auto name = jsi::PropNameID::forAscii(
+          runtime, binding.name, std::strlen(binding.name));
+      if (binding.hostFunction != nullptr) {
+        global.setProperty(
+            runtime,
+            name,
+            jsi::Function::createFromHostFunction(
+                runtime,
+                name,
+                binding.paramCount,
+                [&context, fn = binding.hostFunction](
+                    jsi::Runtime& runtime,
+                    const jsi::Value& /*thisValue*/,
+                    const jsi::Value* args,
+                    size_t count) {
+                  return fn(context, runtime, args, count);
+                }));
+      } else {
+        global.setProperty(
+            runtime, name, binding.valueFactory(context, runtime));
+      }
+
+      ReactMarker::logTaggedMarker(
+          ReactMarker::INSTALL_RUNTIME_BINDING_STOP, binding.name);
+    }
+  }
+
+ private:
+  struct Binding {
+    const char* name;
+    unsigned int paramCount;
+    HostFunction hostFunction;
+    ValueFactory valueFactory;
+  };
+
+  std::vector<Binding> bindings_;
+};
+
+} // namespace facebook::react
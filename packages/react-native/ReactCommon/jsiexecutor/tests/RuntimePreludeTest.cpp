@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <jsireact/RuntimePrelude.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+struct TestContext {
+  int callCount{0};
+  std::string label;
+};
+
+std::vector<std::pair<ReactMarker::ReactMarkerId, std::string>> markers;
+
+void logTestMarker(const ReactMarker::ReactMarkerId markerId, const char* tag) {
+  markers.emplace_back(markerId, tag != nullptr ? tag : "");
+}
+
+const RuntimePrelude<TestContext>& testPrelude() {
+  static const auto prelude =
+      RuntimePrelude<TestContext>{}
+          .hostFunction(
+              "increment",
+              1,
+              [](TestContext& context,
+                 jsi::Runtime&,
+                 const jsi::Value* args,
+                 size_t count) -> jsi::Value {
+                context.callCount +=
+                    count > 0 ? static_cast<int>(args[0].asNumber()) : 1;
+                return context.callCount;
+              })
+          .value("label", [](TestContext& context, jsi::Runtime& runtime) {
+            return jsi::Value(
+                jsi::String::createFromUtf8(runtime, context.label));
+          });
+  return prelude;
+}
+
+} // namespace
+
+class RuntimePreludeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+  }
+
+  void TearDown() override {
+    std::unique_lock lock(ReactMarker::logTaggedMarkerImplMutex);
+    ReactMarker::logTaggedMarkerImpl = nullptr;
+    markers.clear();
+  }
+
+  jsi::Value eval(const std::string& code) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(code), "");
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+};
+
+TEST_F(RuntimePreludeTest, installsBindings) {
+  auto context = TestContext{0, "first"};
+  testPrelude().install(*runtime_, context);
+
+  EXPECT_EQ(testPrelude().size(), 2);
+  EXPECT_EQ(eval("increment(2)").getNumber(), 2);
+  EXPECT_EQ(eval("increment()").getNumber(), 3);
+  EXPECT_EQ(context.callCount, 3);
+  EXPECT_EQ(
+      eval("increment.name").getString(*runtime_).utf8(*runtime_),
+      "increment");
+  EXPECT_EQ(eval("increment.length").getNumber(), 1);
+  EXPECT_EQ(eval("label").getString(*runtime_).utf8(*runtime_), "first");
+}
+
+TEST_F(RuntimePreludeTest, bindsEachRuntimeToItsContext) {
+  auto otherRuntime = facebook::hermes::makeHermesRuntime();
+  auto context = TestContext{0, "first"};
+  auto otherContext = TestContext{0, "second"};
+
+  testPrelude().install(*runtime_, context);
+  testPrelude().install(*otherRuntime, otherContext);
+
+  eval("increment(1)");
+  otherRuntime->evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>("increment(5)"), "");
+
+  EXPECT_EQ(context.callCount, 1);
+  EXPECT_EQ(otherContext.callCount, 5);
+  EXPECT_EQ(
+      otherRuntime->global()
+          .getProperty(*otherRuntime, "label")
+          .getString(*otherRuntime)
+          .utf8(*otherRuntime),
+      "second");
+}
+
+TEST_F(RuntimePreludeTest, logsMarkersPerBinding) {
+  {
+    std::unique_lock lock(ReactMarker::logTaggedMarkerImplMutex);
+    ReactMarker::logTaggedMarkerImpl = logTestMarker;
+  }
+
+  auto context = TestContext{};
+  testPrelude().install(*runtime_, context);
+
+  using Marker = std::pair<ReactMarker::ReactMarkerId, std::string>;
+  EXPECT_EQ(
+      markers,
+      (std::vector<Marker>{
+          {ReactMarker::INSTALL_RUNTIME_BINDING_START, "increment"},
+          {ReactMarker::INSTALL_RUNTIME_BINDING_STOP, "increment"},
+          {ReactMarker::INSTALL_RUNTIME_BINDING_START, "label"},
+          {ReactMarker::INSTALL_RUNTIME_BINDING_STOP, "label"},
+      }));
+}
+
+} // namespace facebook::react
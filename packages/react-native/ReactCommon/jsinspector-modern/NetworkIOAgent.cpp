@@ -510,16 +510,14 @@ void NetworkIOAgent::handleGetResponseBody(const cdp::PreparsedRequest& req) {
     return;
   }
 
-  std::string responseBody;
-  bool base64Encoded = false;
-  std::tie(responseBody, base64Encoded) = *storedResponse;
-
+  // The chunks of the stored body are only concatenated here, as CDP sends
+  // the body as a single string.
   auto result = GetResponseBodyResult{
-      .body = responseBody,
-      .base64Encoded = base64Encoded,
+      .body = storedResponse->toString(),
+      .base64Encoded = storedResponse->base64Encoded,
   };
 
-  frontendChannel_(cdp::jsonResult(requestId, result.toDynamic()));
+  frontendChannel_(cdp::jsonResult(requestId, std::move(result).toDynamic()));
 }
 
 } // namespace facebook::react::jsinspector_modern
@@ -91,12 +91,18 @@ struct IOReadResult {
 struct GetResponseBodyResult {
   std::string body;
   bool base64Encoded;
-  folly::dynamic toDynamic() const {
+  folly::dynamic toDynamic() const& {
     folly::dynamic params = folly::dynamic::object;
     params["body"] = body;
     params["base64Encoded"] = base64Encoded;
     return params;
   }
+  folly::dynamic toDynamic() && {
+    folly::dynamic params = folly::dynamic::object;
+    params["body"] = std::move(body);
+    params["base64Encoded"] = base64Encoded;
+    return params;
+  }
 };
 
 /**
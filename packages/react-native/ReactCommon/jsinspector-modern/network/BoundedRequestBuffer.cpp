@@ -7,71 +7,256 @@
 
 #include "BoundedRequestBuffer.h"
 
+#include <algorithm>
+
 namespace facebook::react::jsinspector_modern {
 
+namespace {
+
+constexpr size_t kMinRingCapacity = 16;
+
+// Bytes used to store a chunk besides its characters: the string object and
+// the shared_ptr control block it is allocated with, and the pointer to it in
+// the chunk list.
+constexpr size_t kChunkOverheadBytes =
+    sizeof(std::string) + 2 * sizeof(void*) + sizeof(std::shared_ptr<void>);
+
+size_t chunkCost(const std::string& chunk) {
+  return chunk.capacity() + kChunkOverheadBytes;
+}
+
+// Bytes used to store an entry besides its chunks: the request ID is stored
+// both in the ring buffer and as the key of the index.
+size_t entryCost(const std::string& requestId) {
+  return 2 * (sizeof(std::string) + requestId.size()) + sizeof(uint64_t) +
+      sizeof(std::vector<std::shared_ptr<const std::string>>);
+}
+
+} // namespace
+
+std::string BoundedRequestBuffer::ResponseBody::toString() const {
+  std::string result;
+  result.reserve(size);
+  for (const auto& chunk : chunks) {
+    result.append(*chunk);
+  }
+  return result;
+}
+
+BoundedRequestBuffer::BoundedRequestBuffer(size_t maxSizeBytes)
+    : maxSizeBytes_(maxSizeBytes) {}
+
 bool BoundedRequestBuffer::put(
     const std::string& requestId,
     std::string_view data,
     bool base64Encoded) noexcept {
-  if (data.size() > REQUEST_BUFFER_MAX_SIZE_BYTES) {
+  // Remove existing request with the same ID, if any
+  remove(requestId);
+  return append(requestId, data, base64Encoded);
+}
+
+bool BoundedRequestBuffer::append(
+    const std::string& requestId,
+    std::string_view data,
+    bool base64Encoded) noexcept {
+  auto* entry = find(requestId);
+  if (entry != nullptr && entry->body.base64Encoded != base64Encoded) {
+    remove(requestId);
     return false;
   }
 
-  // Remove existing request with the same ID, if any
-  if (auto it = responses_.find(requestId); it != responses_.end()) {
-    currentSize_ -= it->second->data.size();
-    responses_.erase(it);
-    // Update order: remove requestId from deque
-    for (auto orderIt = order_.begin(); orderIt != order_.end(); ++orderIt) {
-      if (*orderIt == requestId) {
-        order_.erase(orderIt);
-        break;
-      }
-    }
+  auto newChunkCount = (data.size() + kChunkSizeBytes - 1) / kChunkSizeBytes;
+  auto estimatedSize = data.size() + newChunkCount * kChunkOverheadBytes;
+  auto entrySize =
+      entry != nullptr ? entry->accountedSize : entryCost(requestId);
+  if (entrySize + estimatedSize > maxSizeBytes_) {
+    remove(requestId);
+    return false;
   }
 
   // Evict oldest requests if necessary to make space
-  while (currentSize_ + data.size() > REQUEST_BUFFER_MAX_SIZE_BYTES &&
-         !order_.empty()) {
-    const auto& oldestId = order_.front();
-    auto it = responses_.find(oldestId);
-    if (it != responses_.end()) {
-      currentSize_ -= it->second->data.size();
-      responses_.erase(it);
-    }
-    order_.pop_front();
+  auto newSize = estimatedSize + (entry != nullptr ? 0 : entrySize);
+  if (!makeSpace(newSize, requestId)) {
+    remove(requestId);
+    return false;
   }
 
-  // If still no space, reject the new data (this should not be reached)
-  if (currentSize_ + data.size() > REQUEST_BUFFER_MAX_SIZE_BYTES) {
-    return false;
+  if (entry == nullptr) {
+    Entry newEntry;
+    newEntry.requestId = requestId;
+    newEntry.body.base64Encoded = base64Encoded;
+    newEntry.accountedSize = entrySize;
+    pushBack(std::move(newEntry));
+    currentSize_ += entrySize;
+    entry = find(requestId);
   }
 
-  currentSize_ += data.size();
-  // `data` is copied at the point of insertion
-  responses_.emplace(
-      requestId,
-      std::make_shared<ResponseBody>(
-          ResponseBody{std::string(data), base64Encoded}));
-  order_.push_back(requestId);
+  appendChunks(*entry, data);
+
+  // Allocations may be slightly larger than estimated.
+  if (!makeSpace(0, requestId)) {
+    remove(requestId);
+    return false;
+  }
 
   return true;
 }
 
-std::shared_ptr<const BoundedRequestBuffer::ResponseBody>
-BoundedRequestBuffer::get(const std::string& requestId) const {
-  auto it = responses_.find(requestId);
-  if (it != responses_.end()) {
-    return it->second;
+std::optional<BoundedRequestBuffer::ResponseBody> BoundedRequestBuffer::get(
+    const std::string& requestId) const {
+  if (const auto* entry = find(requestId)) {
+    return entry->body;
   }
 
-  return nullptr;
+  return std::nullopt;
 }
 
 void BoundedRequestBuffer::clear() {
+  ring_.clear();
+  head_ = 0;
+  ringCount_ = 0;
+  headSequence_ = 0;
+  replacedCount_ = 0;
   responses_.clear();
-  order_.clear();
   currentSize_ = 0;
 }
 
+BoundedRequestBuffer::Entry* BoundedRequestBuffer::find(
+    const std::string& requestId) {
+  auto it = responses_.find(requestId);
+  return it != responses_.end() ? &at(it->second) : nullptr;
+}
+
+const BoundedRequestBuffer::Entry* BoundedRequestBuffer::find(
+    const std::string& requestId) const {
+  auto it = responses_.find(requestId);
+  return it != responses_.end() ? &at(it->second) : nullptr;
+}
+
+BoundedRequestBuffer::Entry& BoundedRequestBuffer::at(uint64_t sequence) {
+  return ring_[(head_ + (sequence - headSequence_)) % ring_.size()];
+}
+
+const BoundedRequestBuffer::Entry& BoundedRequestBuffer::at(
+    uint64_t sequence) const {
+  return ring_[(head_ + (sequence - headSequence_)) % ring_.size()];
+}
+
+void BoundedRequestBuffer::pushBack(Entry&& entry) {
+  if (ringCount_ == ring_.size()) {
+    std::vector<Entry> ring;
+    ring.reserve(std::max(kMinRingCapacity, ring_.size() * 2));
+    for (size_t i = 0; i < ringCount_; i++) {
+      ring.push_back(std::move(ring_[(head_ + i) % ring_.size()]));
+    }
+    ring.resize(ring.capacity());
+    ring_ = std::move(ring);
+    head_ = 0;
+  }
+
+  auto sequence = headSequence_ + ringCount_;
+  responses_[entry.requestId] = sequence;
+  ringCount_++;
+  at(sequence) = std::move(entry);
+}
+
+void BoundedRequestBuffer::remove(const std::string& requestId) {
+  auto it = responses_.find(requestId);
+  if (it == responses_.end()) {
+    return;
+  }
+
+  // Replaced entries are skipped when reached by eviction, so removing is
+  // O(1) regardless of the position of the entry.
+  auto& entry = at(it->second);
+  currentSize_ -= entry.accountedSize;
+  entry = Entry{};
+  responses_.erase(it);
+  replacedCount_++;
+
+  if (replacedCount_ >= kMinRingCapacity && replacedCount_ * 2 > ringCount_) {
+    compact();
+  }
+}
+
+void BoundedRequestBuffer::evictOldest() {
+  auto& entry = ring_[head_];
+  if (entry.requestId.empty()) {
+    replacedCount_--;
+  } else {
+    currentSize_ -= entry.accountedSize;
+    responses_.erase(entry.requestId);
+  }
+  entry = Entry{};
+
+  head_ = (head_ + 1) % ring_.size();
+  ringCount_--;
+  headSequence_++;
+}
+
+bool BoundedRequestBuffer::makeSpace(
+    size_t size,
+    const std::string& keepRequestId) {
+  while (currentSize_ + size > maxSizeBytes_) {
+    // Skip replaced entries to find the oldest response.
+    while (ringCount_ > 0 && ring_[head_].requestId.empty()) {
+      evictOldest();
+    }
+    if (ringCount_ == 0 || ring_[head_].requestId == keepRequestId) {
+      return false;
+    }
+    evictOldest();
+  }
+  return true;
+}
+
+void BoundedRequestBuffer::appendChunks(Entry& entry, std::string_view data) {
+  auto& chunks = entry.body.chunks;
+  entry.body.size += data.size();
+
+  // Fill the last chunk in place, unless it has been returned by get() and
+  // may be read.
+  if (!chunks.empty() && chunks.back().use_count() == 1 &&
+      chunks.back()->size() < kChunkSizeBytes) {
+    // Chunks are allocated as non-const strings below.
+    auto& last = const_cast<std::string&>(*chunks.back());
+    auto length = std::min(data.size(), kChunkSizeBytes - last.size());
+    auto previousCost = chunkCost(last);
+    if (last.capacity() < last.size() + length) {
+      auto capacity = std::max(last.capacity() * 2, last.size() + length);
+      last.reserve(std::min(kChunkSizeBytes, capacity));
+    }
+    last.append(data.substr(0, length));
+    entry.accountedSize += chunkCost(last) - previousCost;
+    currentSize_ += chunkCost(last) - previousCost;
+    data.remove_prefix(length);
+  }
+
+  for (size_t offset = 0; offset < data.size(); offset += kChunkSizeBytes) {
+    std::shared_ptr<const std::string> chunk =
+        std::make_shared<std::string>(data.substr(offset, kChunkSizeBytes));
+    entry.accountedSize += chunkCost(*chunk);
+    currentSize_ += chunkCost(*chunk);
+    chunks.push_back(std::move(chunk));
+  }
+}
+
+void BoundedRequestBuffer::compact() {
+  std::vector<Entry> ring;
+  ring.reserve(std::max(kMinRingCapacity, ring_.size()));
+  for (size_t i = 0; i < ringCount_; i++) {
+    auto& entry = ring_[(head_ + i) % ring_.size()];
+    if (!entry.requestId.empty()) {
+      responses_[entry.requestId] = headSequence_ + ring.size();
+      ring.push_back(std::move(entry));
+    }
+  }
+
+  ringCount_ = ring.size();
+  ring.resize(ring.capacity());
+  ring_ = std::move(ring);
+  head_ = 0;
+  replacedCount_ = 0;
+}
+
 } // namespace facebook::react::jsinspector_modern
@@ -7,10 +7,13 @@
 
 #pragma once
 
-#include <deque>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace facebook::react::jsinspector_modern {
 
@@ -23,14 +26,35 @@ constexpr size_t REQUEST_BUFFER_MAX_SIZE_BYTES = 100 * 1024 * 1024; // 100MB
 /**
  * A class to store network response previews keyed by requestId, with a fixed
  * memory limit. Evicts oldest responses when memory is exceeded.
+ *
+ * Bodies are stored as chunks of at most \ref kChunkSizeBytes, so they can be
+ * appended to while streaming, and read without copying them.
+ * Responses are kept in a ring buffer in insertion order, and the memory
+ * limit accounts for the bytes allocated for each chunk and request ID, not
+ * only for the body size.
  */
 class BoundedRequestBuffer {
  public:
+  static constexpr size_t kChunkSizeBytes = 64 * 1024;
+
   struct ResponseBody {
-    std::string data;
-    bool base64Encoded;
+    /**
+     * The body, split in chunks. Chunks are never modified once returned, so
+     * they can be read after the entry is appended to, evicted or replaced.
+     */
+    std::vector<std::shared_ptr<const std::string>> chunks;
+    size_t size{0};
+    bool base64Encoded{false};
+
+    /**
+     * Concatenate the chunks of the body.
+     */
+    std::string toString() const;
   };
 
+  explicit BoundedRequestBuffer(
+      size_t maxSizeBytes = REQUEST_BUFFER_MAX_SIZE_BYTES);
+
   /**
    * Store a response preview with the given requestId and data.
    * If adding the data exceeds the memory limit, removes oldest requests until
@@ -46,22 +70,78 @@ class BoundedRequestBuffer {
       bool base64Encoded) noexcept;
 
   /**
-   * Retrieve a response preview by requestId.
+   * Append data to the response preview with the given requestId, or store
+   * it if there is no response with this requestId yet. Evicts oldest
+   * requests as \ref put does.
+   * \return True if the data was stored, false otherwise (in which case the
+   * whole response is removed, as it would be incomplete).
+   */
+  bool append(
+      const std::string& requestId,
+      std::string_view data,
+      bool base64Encoded) noexcept;
+
+  /**
+   * Retrieve a response preview by requestId. The chunks of the body are
+   * shared with the buffer, not copied.
    * \param requestId The unique identifier for the request.
-   * \return A shared pointer to the request data if found, otherwise nullptr.
+   * \return The response body if found, otherwise nullopt.
    */
-  std::shared_ptr<const ResponseBody> get(const std::string& requestId) const;
+  std::optional<ResponseBody> get(const std::string& requestId) const;
 
   /**
    * Remove all entries from the buffer.
    */
   void clear();
 
+  /**
+   * The number of bytes accounted against the memory limit.
+   */
+  size_t sizeBytes() const {
+    return currentSize_;
+  }
+
+  /**
+   * The number of stored responses.
+   */
+  size_t count() const {
+    return responses_.size();
+  }
+
  private:
-  std::unordered_map<std::string, std::shared_ptr<const ResponseBody>>
-      responses_;
-  std::deque<std::string> order_;
-  size_t currentSize_ = 0;
+  struct Entry {
+    // Empty for entries that have been replaced.
+    std::string requestId;
+    ResponseBody body;
+    size_t accountedSize{0};
+  };
+
+  Entry* find(const std::string& requestId);
+  const Entry* find(const std::string& requestId) const;
+
+  Entry& at(uint64_t sequence);
+  const Entry& at(uint64_t sequence) const;
+
+  void pushBack(Entry&& entry);
+  void remove(const std::string& requestId);
+  void evictOldest();
+  bool makeSpace(size_t size, const std::string& keepRequestId);
+  void appendChunks(Entry& entry, std::string_view data);
+  void compact();
+
+  size_t maxSizeBytes_;
+
+  // Ring buffer of entries, from oldest to newest. An entry is identified by
+  // a sequence number, and stored at (head_ + sequence - headSequence_) %
+  // ring_.size().
+  std::vector<Entry> ring_;
+  size_t head_{0};
+  size_t ringCount_{0};
+  uint64_t headSequence_{0};
+  size_t replacedCount_{0};
+
+  std::unordered_map<std::string, uint64_t> responses_;
+  size_t currentSize_{0};
 };
 
 } // namespace facebook::react::jsinspector_modern
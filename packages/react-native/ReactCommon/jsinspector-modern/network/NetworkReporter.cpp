@@ -300,17 +300,10 @@ void NetworkReporter::storeResponseBody(
   requestBodyBuffer_.put(requestId, body, base64Encoded);
 }
 
-std::optional<std::tuple<std::string, bool>> NetworkReporter::getResponseBody(
-    const std::string& requestId) {
+std::optional<BoundedRequestBuffer::ResponseBody>
+NetworkReporter::getResponseBody(const std::string& requestId) {
   std::lock_guard<std::mutex> lock(requestBodyMutex_);
-  auto responseBody = requestBodyBuffer_.get(requestId);
-
-  if (responseBody == nullptr) {
-    return std::nullopt;
-  }
-
-  return std::make_optional<std::tuple<std::string, bool>>(
-      responseBody->data, responseBody->base64Encoded);
+  return requestBodyBuffer_.get(requestId);
 }
 
 } // namespace facebook::react::jsinspector_modern
@@ -17,7 +17,6 @@
 #include <functional>
 #include <mutex>
 #include <string>
-#include <tuple>
 #include <unordered_map>
 
 namespace facebook::react::jsinspector_modern {
@@ -177,10 +176,10 @@ class NetworkReporter {
   /**
    * Retrieve a stored response body for a given request ID.
    *
-   * \returns An optional tuple of [responseBody, base64Encoded]. Returns
-   * nullopt if no entry is found in the buffer.
+   * \returns The stored response body, sharing its chunks with the buffer.
+   * Returns nullopt if no entry is found in the buffer.
    */
-  std::optional<std::tuple<std::string, bool>> getResponseBody(
+  std::optional<BoundedRequestBuffer::ResponseBody> getResponseBody(
       const std::string& requestId);
 
  private:
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/network/BoundedRequestBuffer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace facebook::react::jsinspector_modern {
+
+namespace {
+
+constexpr size_t kChunkSize = BoundedRequestBuffer::kChunkSizeBytes;
+
+std::string getBody(
+    const BoundedRequestBuffer& buffer,
+    const std::string& requestId) {
+  auto body = buffer.get(requestId);
+  return body ? body->toString() : "<missing>";
+}
+
+} // namespace
+
+TEST(BoundedRequestBufferTest, PutAndGet) {
+  BoundedRequestBuffer buffer;
+  EXPECT_TRUE(buffer.put("1", "hello", false));
+  EXPECT_TRUE(buffer.put("2", "aGVsbG8=", true));
+
+  auto body = buffer.get("1");
+  ASSERT_TRUE(body.has_value());
+  EXPECT_EQ(body->toString(), "hello");
+  EXPECT_EQ(body->size, 5);
+  EXPECT_FALSE(body->base64Encoded);
+
+  body = buffer.get("2");
+  ASSERT_TRUE(body.has_value());
+  EXPECT_EQ(body->toString(), "aGVsbG8=");
+  EXPECT_TRUE(body->base64Encoded);
+
+  EXPECT_FALSE(buffer.get("3").has_value());
+  EXPECT_EQ(buffer.count(), 2);
+}
+
+TEST(BoundedRequestBufferTest, PutReplacesExistingResponse) {
+  BoundedRequestBuffer buffer;
+  EXPECT_TRUE(buffer.put("1", "first", false));
+  auto sizeBytes = buffer.sizeBytes();
+
+  EXPECT_TRUE(buffer.put("1", "other", true));
+  EXPECT_EQ(getBody(buffer, "1"), "other");
+  EXPECT_TRUE(buffer.get("1")->base64Encoded);
+  EXPECT_EQ(buffer.count(), 1);
+  EXPECT_EQ(buffer.sizeBytes(), sizeBytes);
+}
+
+TEST(BoundedRequestBufferTest, LargeBodiesAreSplitInChunks) {
+  BoundedRequestBuffer buffer;
+  std::string data(kChunkSize * 2 + 10, 'x');
+  data[kChunkSize] = 'y';
+  EXPECT_TRUE(buffer.put("1", data, false));
+
+  auto body = buffer.get("1");
+  ASSERT_TRUE(body.has_value());
+  EXPECT_EQ(body->chunks.size(), 3);
+  EXPECT_EQ(body->size, data.size());
+  EXPECT_EQ(body->toString(), data);
+}
+
+TEST(BoundedRequestBufferTest, SizeAccountsForOverhead) {
+  BoundedRequestBuffer buffer;
+  EXPECT_EQ(buffer.sizeBytes(), 0);
+
+  std::string data(1000, 'x');
+  EXPECT_TRUE(buffer.put("1", data, false));
+  EXPECT_GT(buffer.sizeBytes(), data.size());
+
+  buffer.put("2", "", false);
+  EXPECT_GT(buffer.sizeBytes(), data.size());
+
+  buffer.clear();
+  EXPECT_EQ(buffer.sizeBytes(), 0);
+  EXPECT_EQ(buffer.count(), 0);
+  EXPECT_FALSE(buffer.get("1").has_value());
+}
+
+TEST(BoundedRequestBufferTest, EvictsOldestResponses) {
+  BoundedRequestBuffer buffer(8 * 1024);
+  std::string data(1000, 'x');
+  for (int i = 0; i < 20; i++) {
+    EXPECT_TRUE(buffer.put(std::to_string(i), data, false));
+    EXPECT_LE(buffer.sizeBytes(), 8 * 1024);
+  }
+
+  EXPECT_LT(buffer.count(), 20);
+  EXPECT_GT(buffer.count(), 0);
+  auto oldestKept = 20 - buffer.count();
+  for (size_t i = 0; i < 20; i++) {
+    EXPECT_EQ(buffer.get(std::to_string(i)).has_value(), i >= oldestKept)
+        << "request " << i;
+  }
+}
+
+TEST(BoundedRequestBufferTest, ReplacingMovesResponseToTheEnd) {
+  // Fits three of these responses.
+  BoundedRequestBuffer buffer(8 * 1024);
+  std::string data(2000, 'x');
+  EXPECT_TRUE(buffer.put("1", data, false));
+  EXPECT_TRUE(buffer.put("2", data, false));
+  EXPECT_TRUE(buffer.put("3", data, false));
+  EXPECT_TRUE(buffer.put("1", data, false));
+  EXPECT_EQ(buffer.count(), 3);
+
+  EXPECT_TRUE(buffer.put("4", data, false));
+  EXPECT_TRUE(buffer.get("1").has_value());
+  EXPECT_FALSE(buffer.get("2").has_value());
+  EXPECT_TRUE(buffer.get("3").has_value());
+  EXPECT_TRUE(buffer.get("4").has_value());
+}
+
+TEST(BoundedRequestBufferTest, RejectsResponsesLargerThanLimit) {
+  BoundedRequestBuffer buffer(4 * 1024);
+  EXPECT_TRUE(buffer.put("1", "small", false));
+
+  EXPECT_FALSE(buffer.put("2", std::string(4 * 1024, 'x'), false));
+  EXPECT_FALSE(buffer.get("2").has_value());
+
+  // Existing responses are kept.
+  EXPECT_EQ(getBody(buffer, "1"), "small");
+
+  // A rejected replacement removes the previous response.
+  EXPECT_FALSE(buffer.put("1", std::string(4 * 1024, 'x'), false));
+  EXPECT_FALSE(buffer.get("1").has_value());
+  EXPECT_EQ(buffer.sizeBytes(), 0);
+}
+
+TEST(BoundedRequestBufferTest, AppendStreamsBody) {
+  BoundedRequestBuffer buffer;
+  std::string expected;
+  for (int i = 0; i < 1000; i++) {
+    auto piece = std::string(150, static_cast<char>('a' + (i % 26)));
+    EXPECT_TRUE(buffer.append("1", piece, false));
+    expected += piece;
+  }
+
+  auto body = buffer.get("1");
+  ASSERT_TRUE(body.has_value());
+  EXPECT_EQ(body->toString(), expected);
+  EXPECT_EQ(body->size, expected.size());
+
+  // Small pieces are merged into chunks of up to kChunkSizeBytes.
+  EXPECT_EQ(
+      body->chunks.size(), (expected.size() + kChunkSize - 1) / kChunkSize);
+}
+
+TEST(BoundedRequestBufferTest, ReadBodyIsNotAffectedByLaterWrites) {
+  BoundedRequestBuffer buffer;
+  EXPECT_TRUE(buffer.append("1", "hello", false));
+  auto body = buffer.get("1");
+
+  EXPECT_TRUE(buffer.append("1", " world", false));
+  EXPECT_EQ(body->toString(), "hello");
+  EXPECT_EQ(getBody(buffer, "1"), "hello world");
+
+  buffer.clear();
+  EXPECT_EQ(body->toString(), "hello");
+}
+
+TEST(BoundedRequestBufferTest, AppendOverLimitRemovesResponse) {
+  BoundedRequestBuffer buffer(4 * 1024);
+  EXPECT_TRUE(buffer.append("1", std::string(2000, 'x'), false));
+  EXPECT_FALSE(buffer.append("1", std::string(2000, 'x'), false));
+  EXPECT_FALSE(buffer.get("1").has_value());
+  EXPECT_EQ(buffer.sizeBytes(), 0);
+}
+
+TEST(BoundedRequestBufferTest, AppendWithDifferentEncodingRemovesResponse) {
+  BoundedRequestBuffer buffer;
+  EXPECT_TRUE(buffer.append("1", "abc", false));
+  EXPECT_FALSE(buffer.append("1", "YWJj", true));
+  EXPECT_FALSE(buffer.get("1").has_value());
+}
+
+TEST(BoundedRequestBufferTest, ManyReplacementsKeepOrder) {
+  BoundedRequestBuffer buffer;
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 10; i++) {
+      auto requestId = std::to_string(i);
+      auto data = requestId + std::to_string(round);
+      EXPECT_TRUE(buffer.put(requestId, data, false));
+    }
+  }
+
+  EXPECT_EQ(buffer.count(), 10);
+  for (int i = 0; i < 10; i++) {
+    EXPECT_EQ(getBody(buffer, std::to_string(i)), std::to_string(i) + "99");
+  }
+}
+
+} // namespace facebook::react::jsinspector_modern
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jsinspector-modern/network/BoundedRequestBuffer.h>
+
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace facebook::react::jsinspector_modern {
+
+namespace {
+
+/*
+ * The previous implementation of the buffer, for comparison: whole bodies in
+ * a hash map, with insertion order kept in a deque of request IDs.
+ */
+class DequeRequestBuffer {
+ public:
+  struct ResponseBody {
+    std::string data;
+    bool base64Encoded;
+  };
+
+  bool put(
+      const std::string& requestId,
+      std::string_view data,
+      bool base64Encoded) noexcept {
+    if (data.size() > REQUEST_BUFFER_MAX_SIZE_BYTES) {
+      return false;
+    }
+
+    if (auto it = responses_.find(requestId); it != responses_.end()) {
+      currentSize_ -= it->second->data.size();
+      responses_.erase(it);
+      for (auto orderIt = order_.begin(); orderIt != order_.end(); ++orderIt) {
+        if (*orderIt == requestId) {
+          order_.erase(orderIt);
+          break;
+        }
+      }
+    }
+
+    while (currentSize_ + data.size() > REQUEST_BUFFER_MAX_SIZE_BYTES &&
+           !order_.empty()) {
+      const auto& oldestId = order_.front();
+      auto it = responses_.find(oldestId);
+      if (it != responses_.end()) {
+        currentSize_ -= it->second->data.size();
+        responses_.erase(it);
+      }
+      order_.pop_front();
+    }
+
+    currentSize_ += data.size();
+    responses_.emplace(
+        requestId,
+        std::make_shared<ResponseBody>(
+            ResponseBody{std::string(data), base64Encoded}));
+    order_.push_back(requestId);
+    return true;
+  }
+
+  std::shared_ptr<const ResponseBody> get(const std::string& requestId) const {
+    auto it = responses_.find(requestId);
+    return it != responses_.end() ? it->second : nullptr;
+  }
+
+ private:
+  std::unordered_map<std::string, std::shared_ptr<const ResponseBody>>
+      responses_;
+  std::deque<std::string> order_;
+  size_t currentSize_ = 0;
+};
+
+/*
+ * Body sizes of a traffic-heavy session: mostly small JSON responses, some
+ * larger documents and a few images, for ~60KB per response on average.
+ */
+std::vector<size_t> makeBodySizes(size_t count) {
+  std::mt19937 random(42);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::vector<size_t> sizes;
+  sizes.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    auto p = percent(random);
+    sizes.push_back(p < 70 ? 1024 : p < 95 ? 32 * 1024 : 1024 * 1024);
+  }
+  return sizes;
+}
+
+const std::string& getData() {
+  static const std::string data(1024 * 1024, 'x');
+  return data;
+}
+
+template <typename Buffer>
+void putMixedSizes(benchmark::State& state) {
+  auto sizes = makeBodySizes(state.range(0));
+  for (auto _ : state) {
+    Buffer buffer;
+    for (size_t i = 0; i < sizes.size(); i++) {
+      auto data = std::string_view(getData()).substr(0, sizes[i]);
+      benchmark::DoNotOptimize(buffer.put(std::to_string(i), data, false));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ * Replaces responses of random requests, e.g. when requests are retried.
+ */
+template <typename Buffer>
+void replace(benchmark::State& state) {
+  Buffer buffer;
+  auto count = static_cast<size_t>(state.range(0));
+  auto data = std::string_view(getData()).substr(0, 1024);
+  for (size_t i = 0; i < count; i++) {
+    buffer.put(std::to_string(i), data, false);
+  }
+
+  std::mt19937 random(42);
+  std::uniform_int_distribution<size_t> index(0, count - 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        buffer.put(std::to_string(index(random)), data, false));
+  }
+}
+
+/*
+ * Reads a stored response as `Network.getResponseBody` does, up to the body
+ * string sent to the frontend.
+ */
+void getResponseBodyDeque(benchmark::State& state) {
+  DequeRequestBuffer buffer;
+  auto size = static_cast<size_t>(state.range(0));
+  buffer.put("1", std::string_view(getData()).substr(0, size), false);
+
+  for (auto _ : state) {
+    auto responseBody = buffer.get("1");
+    auto storedResponse = std::make_optional<std::tuple<std::string, bool>>(
+        responseBody->data, responseBody->base64Encoded);
+    std::string body;
+    bool base64Encoded = false;
+    std::tie(body, base64Encoded) = *storedResponse;
+    auto result = body;
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+void getResponseBodyRing(benchmark::State& state) {
+  BoundedRequestBuffer buffer;
+  auto size = static_cast<size_t>(state.range(0));
+  buffer.put("1", std::string_view(getData()).substr(0, size), false);
+
+  for (auto _ : state) {
+    auto result = buffer.get("1")->toString();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/*
+ * Stores a 1MB response received in 16KB pieces. The previous buffer had no
+ * append, so the pieces had to be accumulated before storing the response.
+ */
+void streamResponseDeque(benchmark::State& state) {
+  DequeRequestBuffer buffer;
+  auto data = std::string_view(getData());
+  for (auto _ : state) {
+    std::string accumulated;
+    for (size_t offset = 0; offset < data.size(); offset += 16 * 1024) {
+      accumulated.append(data.substr(offset, 16 * 1024));
+    }
+    buffer.put("1", accumulated, false);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void streamResponseRing(benchmark::State& state) {
+  BoundedRequestBuffer buffer;
+  auto data = std::string_view(getData());
+  for (auto _ : state) {
+    buffer.put("1", {}, false);
+    for (size_t offset = 0; offset < data.size(); offset += 16 * 1024) {
+      buffer.append("1", data.substr(offset, 16 * 1024), false);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+} // namespace
+
+BENCHMARK(putMixedSizes<DequeRequestBuffer>)->Arg(1000)->Arg(5000);
+BENCHMARK(putMixedSizes<BoundedRequestBuffer>)->Arg(1000)->Arg(5000);
+BENCHMARK(replace<DequeRequestBuffer>)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(replace<BoundedRequestBuffer>)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(getResponseBodyDeque)->Arg(1024)->Arg(1024 * 1024);
+BENCHMARK(getResponseBodyRing)->Arg(1024)->Arg(1024 * 1024);
+BENCHMARK(streamResponseDeque);
+BENCHMARK(streamResponseRing);
+
+} // namespace facebook::react::jsinspector_modern
+
+BENCHMARK_MAIN();
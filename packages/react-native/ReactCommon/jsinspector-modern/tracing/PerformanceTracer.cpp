@@ -341,6 +341,30 @@ void PerformanceTracer::reportEventLoopMicrotasks(
   });
 }
 
+void PerformanceTracer::reportCounters(
+    const std::string_view& name,
+    HighResTimeStamp timestamp,
+    folly::dynamic counters) {
+  if (!tracingAtomic_) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!tracingAtomic_) {
+    return;
+  }
+
+  buffer_.emplace_back(TraceEvent{
+      .name = std::string(name),
+      .cat = "disabled-by-default-devtools.timeline",
+      .ph = 'C',
+      .ts = timestamp,
+      .pid = processId_,
+      .tid = oscompat::getCurrentThreadId(),
+      .args = std::move(counters),
+  });
+}
+
 folly::dynamic PerformanceTracer::getSerializedRuntimeProfileTraceEvent(
     uint64_t threadId,
     uint16_t profileId,
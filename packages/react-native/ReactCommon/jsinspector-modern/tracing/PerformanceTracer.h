@@ -123,6 +123,17 @@ class PerformanceTracer {
    */
   void reportEventLoopMicrotasks(HighResTimeStamp start, HighResTimeStamp end);
 
+  /**
+   * Record a "Counter" Trace Event - a set of named values at a point in time,
+   * represented as a graph on a timeline view. `counters` must be an object
+   * mapping series names to numbers. If not currently tracing, this is a
+   * no-op.
+   */
+  void reportCounters(
+      const std::string_view& name,
+      HighResTimeStamp timestamp,
+      folly::dynamic counters);
+
   /**
    * Create and serialize Profile Trace Event.
    * \return serialized Trace Event that represents a Profile for CDT.
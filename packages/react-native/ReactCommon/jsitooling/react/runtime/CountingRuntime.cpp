@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "CountingRuntime.h"
+
+#include <jsinspector-modern/RuntimeTarget.h>
+
+namespace facebook::react {
+
+/*
+ * Forwards to the delegate of the wrapped runtime. The sampling profiler is
+ * enabled while a performance trace is recorded, so JSI calls are counted for
+ * the same duration.
+ */
+class CountingJSRuntime::CountingRuntimeTargetDelegate
+    : public jsinspector_modern::RuntimeTargetDelegate {
+ public:
+  explicit CountingRuntimeTargetDelegate(
+      jsinspector_modern::RuntimeTargetDelegate& delegate)
+      : delegate_(delegate) {}
+
+  std::unique_ptr<jsinspector_modern::RuntimeAgentDelegate> createAgentDelegate(
+      jsinspector_modern::FrontendChannel channel,
+      jsinspector_modern::SessionState& sessionState,
+      std::unique_ptr<jsinspector_modern::RuntimeAgentDelegate::ExportedState>
+          previouslyExportedState,
+      const jsinspector_modern::ExecutionContextDescription&
+          executionContextDescription,
+      RuntimeExecutor runtimeExecutor) override {
+    return delegate_.createAgentDelegate(
+        std::move(channel),
+        sessionState,
+        std::move(previouslyExportedState),
+        executionContextDescription,
+        std::move(runtimeExecutor));
+  }
+
+  void addConsoleMessage(
+      jsi::Runtime& runtime,
+      jsinspector_modern::ConsoleMessage message) override {
+    delegate_.addConsoleMessage(runtime, std::move(message));
+  }
+
+  bool supportsConsole() const override {
+    return delegate_.supportsConsole();
+  }
+
+  std::unique_ptr<jsinspector_modern::StackTrace> captureStackTrace(
+      jsi::Runtime& runtime,
+      size_t framesToSkip) override {
+    return delegate_.captureStackTrace(runtime, framesToSkip);
+  }
+
+  void enableSamplingProfiler() override {
+    JSICallCounters::reset();
+    JSICallCounters::setEnabled(true);
+    delegate_.enableSamplingProfiler();
+  }
+
+  void disableSamplingProfiler() override {
+    delegate_.disableSamplingProfiler();
+    // Called before the tracer stops, so the counts are part of the trace.
+    JSICallCounters::reportToTracer();
+    JSICallCounters::setEnabled(false);
+  }
+
+  jsinspector_modern::tracing::RuntimeSamplingProfile collectSamplingProfile()
+      override {
+    return delegate_.collectSamplingProfile();
+  }
+
+ private:
+  jsinspector_modern::RuntimeTargetDelegate& delegate_;
+};
+
+CountingJSRuntime::CountingJSRuntime(std::unique_ptr<JSRuntime> runtime)
+    : runtime_(std::move(runtime)), countingRuntime_(runtime_->getRuntime()) {}
+
+CountingJSRuntime::~CountingJSRuntime() = default;
+
+jsi::Runtime& CountingJSRuntime::getRuntime() noexcept {
+  return countingRuntime_;
+}
+
+jsinspector_modern::RuntimeTargetDelegate&
+CountingJSRuntime::getRuntimeTargetDelegate() {
+  if (!targetDelegate_) {
+    targetDelegate_ = std::make_unique<CountingRuntimeTargetDelegate>(
+        runtime_->getRuntimeTargetDelegate());
+  }
+  return *targetDelegate_;
+}
+
+void CountingJSRuntime::unstable_initializeOnJsThread() {
+  runtime_->unstable_initializeOnJsThread();
+}
+
+} // namespace facebook::react
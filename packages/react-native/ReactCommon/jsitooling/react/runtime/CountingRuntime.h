@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+#include <react/runtime/JSRuntimeFactory.h>
+
+#include <memory>
+
+#include "JSICallCounters.h"
+
+namespace facebook::react {
+
+/**
+ * A decorated runtime counting the hot JSI operations made through it in
+ * `JSICallCounters`, to find out how much each subsystem crosses the JS/native
+ * boundary. Counting is toggled at runtime with
+ * `JSICallCounters::setEnabled`, and is close to free when disabled.
+ */
+class CountingRuntime : public jsi::RuntimeDecorator<jsi::Runtime> {
+  using RD = jsi::RuntimeDecorator<jsi::Runtime>;
+
+ public:
+  explicit CountingRuntime(jsi::Runtime& runtime) : RD(runtime) {}
+
+  jsi::Value evaluateJavaScript(
+      const std::shared_ptr<const jsi::Buffer>& buffer,
+      const std::string& sourceURL) override {
+    JSIOperationScope scope(JSIOperation::EvaluateJavaScript);
+    return RD::evaluateJavaScript(buffer, sourceURL);
+  }
+
+  jsi::Value evaluatePreparedJavaScript(
+      const std::shared_ptr<const jsi::PreparedJavaScript>& js) override {
+    JSIOperationScope scope(JSIOperation::EvaluateJavaScript);
+    return RD::evaluatePreparedJavaScript(js);
+  }
+
+ protected:
+  jsi::PropNameID createPropNameIDFromAscii(const char* str, size_t length)
+      override {
+    JSIOperationScope scope(JSIOperation::CreatePropNameID);
+    return RD::createPropNameIDFromAscii(str, length);
+  }
+  jsi::PropNameID createPropNameIDFromUtf8(const uint8_t* utf8, size_t length)
+      override {
+    JSIOperationScope scope(JSIOperation::CreatePropNameID);
+    return RD::createPropNameIDFromUtf8(utf8, length);
+  }
+  jsi::PropNameID createPropNameIDFromString(const jsi::String& str) override {
+    JSIOperationScope scope(JSIOperation::CreatePropNameID);
+    return RD::createPropNameIDFromString(str);
+  }
+  std::string utf8(const jsi::PropNameID& id) override {
+    JSIOperationScope scope(JSIOperation::PropNameIDToUtf8);
+    return RD::utf8(id);
+  }
+
+  jsi::String createStringFromAscii(const char* str, size_t length) override {
+    JSIOperationScope scope(JSIOperation::CreateString);
+    return RD::createStringFromAscii(str, length);
+  }
+  jsi::String createStringFromUtf8(const uint8_t* utf8, size_t length)
+      override {
+    JSIOperationScope scope(JSIOperation::CreateString);
+    return RD::createStringFromUtf8(utf8, length);
+  }
+  std::string utf8(const jsi::String& str) override {
+    JSIOperationScope scope(JSIOperation::StringToUtf8);
+    return RD::utf8(str);
+  }
+
+  jsi::Object createObject() override {
+    JSIOperationScope scope(JSIOperation::CreateObject);
+    return RD::createObject();
+  }
+  jsi::Object createObject(std::shared_ptr<jsi::HostObject> ho) override {
+    JSIOperationScope scope(JSIOperation::CreateObject);
+    return RD::createObject(std::move(ho));
+  }
+
+  jsi::Value getProperty(const jsi::Object& o, const jsi::PropNameID& name)
+      override {
+    JSIOperationScope scope(JSIOperation::GetProperty);
+    return RD::getProperty(o, name);
+  }
+  jsi::Value getProperty(const jsi::Object& o, const jsi::String& name)
+      override {
+    JSIOperationScope scope(JSIOperation::GetProperty);
+    return RD::getProperty(o, name);
+  }
+  bool hasProperty(const jsi::Object& o, const jsi::PropNameID& name)
+      override {
+    JSIOperationScope scope(JSIOperation::HasProperty);
+    return RD::hasProperty(o, name);
+  }
+  bool hasProperty(const jsi::Object& o, const jsi::String& name) override {
+    JSIOperationScope scope(JSIOperation::HasProperty);
+    return RD::hasProperty(o, name);
+  }
+  void setPropertyValue(
+      const jsi::Object& o,
+      const jsi::PropNameID& name,
+      const jsi::Value& value) override {
+    JSIOperationScope scope(JSIOperation::SetProperty);
+    RD::setPropertyValue(o, name, value);
+  }
+  void setPropertyValue(
+      const jsi::Object& o,
+      const jsi::String& name,
+      const jsi::Value& value) override {
+    JSIOperationScope scope(JSIOperation::SetProperty);
+    RD::setPropertyValue(o, name, value);
+  }
+  jsi::Array getPropertyNames(const jsi::Object& o) override {
+    JSIOperationScope scope(JSIOperation::GetPropertyNames);
+    return RD::getPropertyNames(o);
+  }
+
+  jsi::Array createArray(size_t length) override {
+    JSIOperationScope scope(JSIOperation::CreateArray);
+    return RD::createArray(length);
+  }
+  jsi::Value getValueAtIndex(const jsi::Array& a, size_t i) override {
+    JSIOperationScope scope(JSIOperation::GetValueAtIndex);
+    return RD::getValueAtIndex(a, i);
+  }
+  void setValueAtIndexImpl(
+      const jsi::Array& a,
+      size_t i,
+      const jsi::Value& value) override {
+    JSIOperationScope scope(JSIOperation::SetValueAtIndex);
+    RD::setValueAtIndexImpl(a, i, value);
+  }
+
+  jsi::Function createFunctionFromHostFunction(
+      const jsi::PropNameID& name,
+      unsigned int paramCount,
+      jsi::HostFunctionType func) override {
+    JSIOperationScope scope(JSIOperation::CreateFunctionFromHostFunction);
+    return RD::createFunctionFromHostFunction(
+        name, paramCount, std::move(func));
+  }
+  jsi::Value call(
+      const jsi::Function& f,
+      const jsi::Value& jsThis,
+      const jsi::Value* args,
+      size_t count) override {
+    JSIOperationScope scope(JSIOperation::Call);
+    return RD::call(f, jsThis, args, count);
+  }
+  jsi::Value callAsConstructor(
+      const jsi::Function& f,
+      const jsi::Value* args,
+      size_t count) override {
+    JSIOperationScope scope(JSIOperation::CallAsConstructor);
+    return RD::callAsConstructor(f, args, count);
+  }
+};
+
+/**
+ * A `JSRuntime` exposing the runtime of another `JSRuntime` through a
+ * `CountingRuntime`. JSI calls are counted while the runtime is profiled for a
+ * performance trace, and the counts are reported to the trace when profiling
+ * stops.
+ *
+ * Only used when React Native is built with `RN_JSI_CALL_COUNTERS` defined.
+ */
+class CountingJSRuntime : public JSRuntime {
+ public:
+  explicit CountingJSRuntime(std::unique_ptr<JSRuntime> runtime);
+  ~CountingJSRuntime() override;
+
+  jsi::Runtime& getRuntime() noexcept override;
+
+  jsinspector_modern::RuntimeTargetDelegate& getRuntimeTargetDelegate()
+      override;
+
+  void unstable_initializeOnJsThread() override;
+
+ private:
+  class CountingRuntimeTargetDelegate;
+
+  std::unique_ptr<JSRuntime> runtime_;
+  CountingRuntime countingRuntime_;
+  std::unique_ptr<CountingRuntimeTargetDelegate> targetDelegate_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSICallCounters.h"
+
+#include <folly/dynamic.h>
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+
+#include <mutex>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Counters of a single thread. Only written by their thread, so increments
+ * don't need atomic read-modify-write operations, but they are atomic so
+ * other threads can read them.
+ */
+struct ThreadCounters {
+  std::array<std::atomic<uint64_t>, kJSIOperationCount> callCounts{};
+  std::array<std::atomic<int64_t>, kJSIOperationCount> nanoseconds{};
+};
+
+struct Totals {
+  std::array<uint64_t, kJSIOperationCount> callCounts{};
+  std::array<int64_t, kJSIOperationCount> nanoseconds{};
+
+  void add(const ThreadCounters& counters) {
+    for (size_t i = 0; i < kJSIOperationCount; i++) {
+      callCounts[i] += counters.callCounts[i].load(std::memory_order_relaxed);
+      nanoseconds[i] += counters.nanoseconds[i].load(std::memory_order_relaxed);
+    }
+  }
+};
+
+/*
+ * Keeps track of the counters of all threads. Only accessed when a thread
+ * records its first operation or exits, and when reading the counters.
+ */
+struct Registry {
+  std::mutex mutex;
+  std::vector<const ThreadCounters*> threads;
+
+  // Counters of threads that exited.
+  Totals retired;
+
+  // Totals at the time of the last reset, and of the last report to the
+  // tracer.
+  Totals baseline;
+  Totals lastReported;
+
+  Totals getTotals() {
+    auto totals = retired;
+    for (const auto* counters : threads) {
+      totals.add(*counters);
+    }
+    return totals;
+  }
+};
+
+Registry& getRegistry() {
+  // Leaked, so it outlives the counters of threads exiting after static
+  // destructors ran.
+  static auto* registry = new Registry();
+  return *registry;
+}
+
+class ThreadCountersHolder {
+ public:
+  ThreadCountersHolder() {
+    auto& registry = getRegistry();
+    std::lock_guard lock(registry.mutex);
+    registry.threads.push_back(&counters);
+  }
+
+  ~ThreadCountersHolder() {
+    auto& registry = getRegistry();
+    std::lock_guard lock(registry.mutex);
+    registry.retired.add(counters);
+    std::erase(registry.threads, &counters);
+  }
+
+  ThreadCounters counters;
+};
+
+ThreadCounters& getThreadCounters() {
+  thread_local ThreadCountersHolder holder;
+  return holder.counters;
+}
+
+} // namespace
+
+std::atomic<bool> JSICallCounters::enabled_{false};
+
+void JSICallCounters::setEnabled(bool enabled) {
+  enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+void JSICallCounters::record(
+    JSIOperation operation,
+    HighResDuration duration) {
+  auto& counters = getThreadCounters();
+  auto index = static_cast<size_t>(operation);
+
+  auto& callCount = counters.callCounts[index];
+  callCount.store(
+      callCount.load(std::memory_order_relaxed) + 1,
+      std::memory_order_relaxed);
+  auto& nanoseconds = counters.nanoseconds[index];
+  nanoseconds.store(
+      nanoseconds.load(std::memory_order_relaxed) + duration.toNanoseconds(),
+      std::memory_order_relaxed);
+}
+
+JSICallCounters::Snapshot JSICallCounters::getSnapshot() {
+  auto& registry = getRegistry();
+  std::lock_guard lock(registry.mutex);
+  auto totals = registry.getTotals();
+
+  Snapshot snapshot;
+  for (size_t i = 0; i < kJSIOperationCount; i++) {
+    snapshot[i].callCount =
+        totals.callCounts[i] - registry.baseline.callCounts[i];
+    snapshot[i].duration = HighResDuration::fromNanoseconds(
+        totals.nanoseconds[i] - registry.baseline.nanoseconds[i]);
+  }
+  return snapshot;
+}
+
+void JSICallCounters::reset() {
+  auto& registry = getRegistry();
+  std::lock_guard lock(registry.mutex);
+  registry.baseline = registry.getTotals();
+  registry.lastReported = registry.baseline;
+}
+
+void JSICallCounters::reportToTracer() {
+  auto& tracer = jsinspector_modern::tracing::PerformanceTracer::getInstance();
+  if (!tracer.isTracing()) {
+    return;
+  }
+
+  auto callCounts = folly::dynamic::object();
+  auto durations = folly::dynamic::object();
+  {
+    auto& registry = getRegistry();
+    std::lock_guard lock(registry.mutex);
+    auto totals = registry.getTotals();
+    for (size_t i = 0; i < kJSIOperationCount; i++) {
+      const char* name = getOperationName(static_cast<JSIOperation>(i));
+      callCounts[name] =
+          totals.callCounts[i] - registry.lastReported.callCounts[i];
+      durations[name] = HighResDuration::fromNanoseconds(
+                            totals.nanoseconds[i] -
+                            registry.lastReported.nanoseconds[i])
+                            .toDOMHighResTimeStamp();
+    }
+    registry.lastReported = totals;
+  }
+
+  auto now = HighResTimeStamp::now();
+  tracer.reportCounters("JSI calls", now, std::move(callCounts));
+  tracer.reportCounters("JSI time (ms)", now, std::move(durations));
+}
+
+const char* JSICallCounters::getOperationName(JSIOperation operation) {
+  switch (operation) {
+    case JSIOperation::EvaluateJavaScript:
+      return "evaluateJavaScript";
+    case JSIOperation::Call:
+      return "call";
+    case JSIOperation::CallAsConstructor:
+      return "callAsConstructor";
+    case JSIOperation::CreateFunctionFromHostFunction:
+      return "createFunctionFromHostFunction";
+    case JSIOperation::CreateObject:
+      return "createObject";
+    case JSIOperation::CreateArray:
+      return "createArray";
+    case JSIOperation::CreateString:
+      return "createString";
+    case JSIOperation::CreatePropNameID:
+      return "createPropNameID";
+    case JSIOperation::GetProperty:
+      return "getProperty";
+    case JSIOperation::SetProperty:
+      return "setProperty";
+    case JSIOperation::HasProperty:
+      return "hasProperty";
+    case JSIOperation::GetPropertyNames:
+      return "getPropertyNames";
+    case JSIOperation::GetValueAtIndex:
+      return "getValueAtIndex";
+    case JSIOperation::SetValueAtIndex:
+      return "setValueAtIndex";
+    case JSIOperation::StringToUtf8:
+      return "String::utf8";
+    case JSIOperation::PropNameIDToUtf8:
+      return "PropNameID::utf8";
+  }
+  return "unknown";
+}
+
+} // namespace facebook::react
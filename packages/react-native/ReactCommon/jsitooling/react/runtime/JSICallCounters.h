@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/timing/primitives.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
+namespace facebook::react {
+
+/**
+ * The JSI operations counted by `CountingRuntime`.
+ */
+enum class JSIOperation : uint8_t {
+  EvaluateJavaScript,
+  Call,
+  CallAsConstructor,
+  CreateFunctionFromHostFunction,
+  CreateObject,
+  CreateArray,
+  CreateString,
+  CreatePropNameID,
+  GetProperty,
+  SetProperty,
+  HasProperty,
+  GetPropertyNames,
+  GetValueAtIndex,
+  SetValueAtIndex,
+  StringToUtf8,
+  PropNameIDToUtf8,
+};
+
+constexpr size_t kJSIOperationCount =
+    static_cast<size_t>(JSIOperation::PropNameIDToUtf8) + 1;
+
+/**
+ * Process-wide call counts and cumulative durations of JSI operations,
+ * recorded by `CountingRuntime`.
+ *
+ * Every thread records into its own counters, without locks or contention.
+ * Reading the counters (`getSnapshot`) sums the counters of all threads.
+ *
+ * Counting is disabled by default. When disabled, recording an operation
+ * costs a relaxed atomic load.
+ */
+class JSICallCounters {
+ public:
+  struct OperationStats {
+    uint64_t callCount{0};
+
+    /*
+     * Wall time spent in the operation, including nested operations (e.g.
+     * host functions called by a `Call`).
+     */
+    HighResDuration duration;
+  };
+
+  using Snapshot = std::array<OperationStats, kJSIOperationCount>;
+
+  static void setEnabled(bool enabled);
+
+  static bool isEnabled() {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+
+  static void record(JSIOperation operation, HighResDuration duration);
+
+  /*
+   * Returns the counters accumulated by all threads since the last `reset`.
+   */
+  static Snapshot getSnapshot();
+
+  static void reset();
+
+  /*
+   * Reports the counters accumulated since the last report (or `reset`) as
+   * Counter Trace Events, if the PerformanceTracer is tracing. Called by
+   * `CountingJSRuntime` right before a trace stops.
+   */
+  static void reportToTracer();
+
+  static const char* getOperationName(JSIOperation operation);
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+/**
+ * Records the duration of a JSI operation, from construction to destruction,
+ * if counting is enabled.
+ */
+class JSIOperationScope {
+ public:
+  explicit JSIOperationScope(JSIOperation operation) : operation_(operation) {
+    if (JSICallCounters::isEnabled()) {
+      start_ = HighResTimeStamp::now();
+    }
+  }
+
+  ~JSIOperationScope() {
+    if (start_) {
+      JSICallCounters::record(operation_, HighResTimeStamp::now() - *start_);
+    }
+  }
+
+  JSIOperationScope(const JSIOperationScope&) = delete;
+  JSIOperationScope& operator=(const JSIOperationScope&) = delete;
+
+ private:
+  JSIOperation operation_;
+  std::optional<HighResTimeStamp> start_;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+#include <react/runtime/CountingRuntime.h>
+
+namespace facebook::react {
+
+using jsinspector_modern::tracing::PerformanceTracer;
+
+class CountingRuntimeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    JSICallCounters::reset();
+    JSICallCounters::setEnabled(false);
+  }
+
+  void TearDown() override {
+    JSICallCounters::setEnabled(false);
+  }
+
+  static uint64_t getCallCount(JSIOperation operation) {
+    return JSICallCounters::getSnapshot()[static_cast<size_t>(operation)]
+        .callCount;
+  }
+
+  /*
+   * Installs `global.add`, a host function adding its two arguments.
+   */
+  static void installAdd(jsi::Runtime& runtime) {
+    auto name = jsi::PropNameID::forAscii(runtime, "add");
+    runtime.global().setProperty(
+        runtime,
+        name,
+        jsi::Function::createFromHostFunction(
+            runtime,
+            name,
+            2,
+            [](jsi::Runtime& /*runtime*/,
+               const jsi::Value& /*thisValue*/,
+               const jsi::Value* args,
+               size_t /*count*/) {
+              return jsi::Value(args[0].asNumber() + args[1].asNumber());
+            }));
+  }
+};
+
+TEST_F(CountingRuntimeTest, countsOperationsWhenEnabled) {
+  auto hermesRuntime = hermes::makeHermesRuntime();
+  auto runtime = CountingRuntime(*hermesRuntime);
+
+  JSICallCounters::setEnabled(true);
+  installAdd(runtime);
+
+  EXPECT_EQ(getCallCount(JSIOperation::CreatePropNameID), 1);
+  EXPECT_EQ(getCallCount(JSIOperation::CreateFunctionFromHostFunction), 1);
+  EXPECT_EQ(getCallCount(JSIOperation::SetProperty), 1);
+
+  auto name = jsi::PropNameID::forAscii(runtime, "add");
+  auto add = runtime.global()
+                 .getProperty(runtime, name)
+                 .asObject(runtime)
+                 .asFunction(runtime);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(add.call(runtime, i, 1).asNumber(), i + 1);
+  }
+
+  EXPECT_EQ(getCallCount(JSIOperation::GetProperty), 1);
+  EXPECT_EQ(getCallCount(JSIOperation::Call), 3);
+
+  // Calls from JavaScript to host functions don't go through JSI.
+  runtime.evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>("add(1, 2); add(3, 4);"), "");
+  EXPECT_EQ(getCallCount(JSIOperation::EvaluateJavaScript), 1);
+  EXPECT_EQ(getCallCount(JSIOperation::Call), 3);
+}
+
+TEST_F(CountingRuntimeTest, doesNotCountOperationsWhenDisabled) {
+  auto hermesRuntime = hermes::makeHermesRuntime();
+  auto runtime = CountingRuntime(*hermesRuntime);
+
+  installAdd(runtime);
+  runtime.evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>("add(1, 2)"), "");
+
+  for (size_t i = 0; i < kJSIOperationCount; i++) {
+    EXPECT_EQ(JSICallCounters::getSnapshot()[i].callCount, 0)
+        << JSICallCounters::getOperationName(static_cast<JSIOperation>(i));
+  }
+}
+
+TEST_F(CountingRuntimeTest, reportsCountsToTracerWhenProfilingStops) {
+  auto jsRuntime = CountingJSRuntime(
+      std::make_unique<JSIRuntimeHolder>(hermes::makeHermesRuntime()));
+  auto& runtime = jsRuntime.getRuntime();
+  auto& targetDelegate = jsRuntime.getRuntimeTargetDelegate();
+  auto& tracer = PerformanceTracer::getInstance();
+
+  // Not counted, as the runtime isn't profiled yet.
+  installAdd(runtime);
+
+  ASSERT_TRUE(tracer.startTracing());
+  targetDelegate.enableSamplingProfiler();
+  EXPECT_TRUE(JSICallCounters::isEnabled());
+
+  auto add = runtime.global().getPropertyAsFunction(runtime, "add");
+  add.call(runtime, 1, 2);
+  add.call(runtime, 3, 4);
+
+  targetDelegate.disableSamplingProfiler();
+  EXPECT_FALSE(JSICallCounters::isEnabled());
+  ASSERT_TRUE(tracer.stopTracing());
+
+  auto callCounts = folly::dynamic();
+  auto durations = folly::dynamic();
+  tracer.collectEvents(
+      [&](const folly::dynamic& eventsChunk) {
+        for (const auto& event : eventsChunk) {
+          if (event["name"] == "JSI calls") {
+            EXPECT_EQ(event["ph"], "C");
+            callCounts = event["args"];
+          } else if (event["name"] == "JSI time (ms)") {
+            EXPECT_EQ(event["ph"], "C");
+            durations = event["args"];
+          }
+        }
+      },
+      100);
+
+  ASSERT_TRUE(callCounts.isObject());
+  EXPECT_EQ(callCounts["call"], 2);
+  EXPECT_EQ(callCounts["getProperty"], 1);
+  EXPECT_EQ(callCounts["createFunctionFromHostFunction"], 0);
+  ASSERT_TRUE(durations.isObject());
+  EXPECT_GE(durations["call"].asDouble(), 0);
+  EXPECT_EQ(durations.size(), kJSIOperationCount);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/bridging/Base.h>
+
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace facebook::react {
+
+/**
+ * A `jsi::MutableBuffer` that owns its bytes, so a `jsi::ArrayBuffer` can be
+ * backed by native storage without copying it.
+ */
+class VectorMutableBuffer : public jsi::MutableBuffer {
+ public:
+  explicit VectorMutableBuffer(std::vector<uint8_t> data)
+      : data_(std::move(data)) {}
+
+  size_t size() const override {
+    return data_.size();
+  }
+
+  uint8_t* data() override {
+    return data_.data();
+  }
+
+ private:
+  std::vector<uint8_t> data_;
+};
+
+namespace array_buffer_detail {
+
+/**
+ * Returns the bytes of an ArrayBuffer, or the bytes viewed by a typed array
+ * or a DataView.
+ */
+inline std::span<uint8_t> getBytes(
+    jsi::Runtime& rt,
+    const jsi::Object& object) {
+  if (object.isArrayBuffer(rt)) {
+    auto arrayBuffer = object.getArrayBuffer(rt);
+    return {arrayBuffer.data(rt), arrayBuffer.size(rt)};
+  }
+
+  auto buffer = object.getProperty(rt, "buffer");
+  if (buffer.isObject() && buffer.getObject(rt).isArrayBuffer(rt)) {
+    auto arrayBuffer = buffer.getObject(rt).getArrayBuffer(rt);
+    auto byteOffset = object.getProperty(rt, "byteOffset").asNumber();
+    auto byteLength = object.getProperty(rt, "byteLength").asNumber();
+    auto size = arrayBuffer.size(rt);
+    if (byteOffset < 0 || byteLength < 0 || byteOffset + byteLength > size) {
+      throw jsi::JSError(rt, "ArrayBuffer view is out of bounds");
+    }
+    return {
+        arrayBuffer.data(rt) + static_cast<size_t>(byteOffset),
+        static_cast<size_t>(byteLength)};
+  }
+
+  throw jsi::JSError(rt, "Value is not an ArrayBuffer or an ArrayBuffer view");
+}
+
+/**
+ * Wraps the given bytes in a `Uint8Array`, without copying them.
+ */
+inline jsi::Object createUint8Array(
+    jsi::Runtime& rt,
+    std::vector<uint8_t> bytes) {
+  auto arrayBuffer = jsi::ArrayBuffer(
+      rt, std::make_shared<VectorMutableBuffer>(std::move(bytes)));
+  return rt.global()
+      .getPropertyAsFunction(rt, "Uint8Array")
+      .callAsConstructor(rt, std::move(arrayBuffer))
+      .asObject(rt);
+}
+
+} // namespace array_buffer_detail
+
+/**
+ * Binary data passed to and from JS as a `Uint8Array`, instead of the array
+ * of numbers that `std::vector<uint8_t>` is bridged as. Using it is an opt-in
+ * change of the JS type of the value.
+ */
+struct ByteBuffer {
+  std::vector<uint8_t> bytes;
+
+  bool operator==(const ByteBuffer& other) const = default;
+};
+
+/**
+ * Byte buffers are passed to JS as a `Uint8Array` backed by the vector's
+ * storage (moved in, or copied once for lvalues).
+ *
+ * From JS, ArrayBuffers, typed arrays and DataViews are copied with a single
+ * `memcpy`.
+ */
+template <>
+struct Bridging<ByteBuffer> {
+  static ByteBuffer fromJs(jsi::Runtime& rt, const jsi::Object& value) {
+    auto bytes = array_buffer_detail::getBytes(rt, value);
+    return {{bytes.begin(), bytes.end()}};
+  }
+
+  static jsi::Object toJs(jsi::Runtime& rt, ByteBuffer value) {
+    return array_buffer_detail::createUint8Array(rt, std::move(value.bytes));
+  }
+};
+
+/**
+ * Byte spans are a zero-copy view of an ArrayBuffer, typed array or DataView
+ * passed from JS. The span is only valid while the JS value is alive and its
+ * buffer isn't detached, which is the case for the duration of a call
+ * receiving it as an argument. Don't store it.
+ *
+ * To JS, the bytes are copied once into a new `Uint8Array`.
+ */
+template <typename T>
+struct Bridging<
+    std::span<T>,
+    std::enable_if_t<std::is_same_v<std::remove_const_t<T>, uint8_t>>> {
+  static std::span<T> fromJs(jsi::Runtime& rt, const jsi::Object& value) {
+    return array_buffer_detail::getBytes(rt, value);
+  }
+
+  static jsi::Object toJs(jsi::Runtime& rt, std::span<T> value) {
+    return array_buffer_detail::createUint8Array(
+        rt, std::vector<uint8_t>(value.begin(), value.end()));
+  }
+};
+
+} // namespace facebook::react
@@ -6,10 +6,48 @@
  */
 
 #include "LongLivedObject.h"
+#include <mutex>
+#include <stdexcept>
 #include <unordered_map>
 
 namespace facebook::react {
 
+namespace {
+
+// A slot's state holds a 32-bit generation, incremented every time the slot is
+// freed, and a status in the lowest bits.
+enum SlotStatus : uint64_t {
+  Free = 0,
+  Occupied = 1,
+  Releasing = 2,
+};
+
+constexpr uint64_t kSlotStatusMask = 3;
+constexpr uint64_t kLowMask = 0xffffffff;
+
+uint64_t makeSlotState(uint64_t generation, SlotStatus status) {
+  return ((generation & kLowMask) << 2) | status;
+}
+
+uint64_t getGeneration(uint64_t slotState) {
+  return slotState >> 2;
+}
+
+// Handles refer to a slot and its generation, so handles of released objects
+// never match the slot's current object. `0` is not a valid handle.
+uint64_t makeHandle(uint32_t index, uint64_t generation) {
+  return (static_cast<uint64_t>(index + 1) << 32) | (generation & kLowMask);
+}
+
+} // namespace
+
+struct LongLivedObjectCollection::Slot {
+  std::atomic<uint64_t> state{makeSlotState(0, Free)};
+  // Index plus one of the next slot in the stack of free slots.
+  std::atomic<uint32_t> nextFreeSlot{0};
+  std::shared_ptr<LongLivedObject> object;
+};
+
 // LongLivedObjectCollection
 
 LongLivedObjectCollection& LongLivedObjectCollection::get(
@@ -18,40 +56,195 @@ LongLivedObjectCollection& LongLivedObjectCollection::get(
       instances;
   static std::mutex instancesMutex;
 
-  std::scoped_lock lock(instancesMutex);
+  // Instances are never removed, so the last one looked up on this thread can
+  // be returned without taking the lock.
+  thread_local void* lastKey = nullptr;
+  thread_local LongLivedObjectCollection* lastInstance = nullptr;
+
   void* key = static_cast<void*>(&runtime);
+  if (key == lastKey) {
+    return *lastInstance;
+  }
+
+  std::scoped_lock lock(instancesMutex);
   auto entry = instances.find(key);
   if (entry == instances.end()) {
     entry =
         instances.emplace(key, std::make_shared<LongLivedObjectCollection>())
             .first;
   }
+  lastKey = key;
+  lastInstance = entry->second.get();
   return *(entry->second);
 }
 
+LongLivedObjectCollection::LongLivedObjectCollection() = default;
+
+LongLivedObjectCollection::~LongLivedObjectCollection() {
+  for (auto& slab : slabs_) {
+    delete[] slab.load(std::memory_order_acquire);
+  }
+}
+
 void LongLivedObjectCollection::add(std::shared_ptr<LongLivedObject> so) {
-  std::scoped_lock lock(collectionMutex_);
-  collection_.insert(std::move(so));
+  // Objects that are already in a collection are kept where they are.
+  if (!so || so->handle_.load(std::memory_order_acquire) != 0) {
+    return;
+  }
+
+  auto index = allocateSlot();
+  auto& slot = getSlot(index);
+  auto generation =
+      getGeneration(slot.state.load(std::memory_order_acquire));
+
+  // The owner is published before the handle, so a handle is never read with
+  // the owner of a previous membership.
+  so->collection_.store(this, std::memory_order_relaxed);
+  so->handle_.store(makeHandle(index, generation), std::memory_order_release);
+  slot.object = std::move(so);
+  size_.fetch_add(1, std::memory_order_relaxed);
+  slot.state.store(
+      makeSlotState(generation, Occupied), std::memory_order_release);
 }
 
 void LongLivedObjectCollection::remove(const LongLivedObject* o) {
-  std::scoped_lock lock(collectionMutex_);
-  for (auto p = collection_.begin(); p != collection_.end(); p++) {
-    if (p->get() == o) {
-      collection_.erase(p);
-      break;
-    }
+  if (o == nullptr) {
+    return;
+  }
+
+  // Handles of objects owned by another collection refer to slots of that
+  // collection, so they are rejected before touching any slot of this one. The
+  // handle is read again to make sure the owner belongs to the same membership.
+  auto handle = o->handle_.load(std::memory_order_acquire);
+  if (handle == 0 ||
+      o->collection_.load(std::memory_order_acquire) != this ||
+      o->handle_.load(std::memory_order_acquire) != handle) {
+    return;
   }
+
+  auto index = static_cast<uint32_t>((handle >> 32) - 1);
+  if ((index >> kSlabSizeLog2) >= kMaxSlabCount ||
+      slabs_[index >> kSlabSizeLog2].load(std::memory_order_acquire) ==
+          nullptr) {
+    return;
+  }
+
+  auto& slot = getSlot(index);
+  auto occupiedState = makeSlotState(handle & kLowMask, Occupied);
+  auto releasingState = makeSlotState(handle & kLowMask, Releasing);
+  if (!slot.state.compare_exchange_strong(
+          occupiedState,
+          releasingState,
+          std::memory_order_acquire,
+          std::memory_order_relaxed)) {
+    // Already released.
+    return;
+  }
+
+  release(index, occupiedState);
 }
 
 void LongLivedObjectCollection::clear() {
-  std::scoped_lock lock(collectionMutex_);
-  collection_.clear();
+  for (auto& slabPointer : slabs_) {
+    auto* slab = slabPointer.load(std::memory_order_acquire);
+    if (slab == nullptr) {
+      continue;
+    }
+
+    for (uint32_t i = 0; i < kSlabSize; i++) {
+      auto state = slab[i].state.load(std::memory_order_relaxed);
+      if ((state & kSlotStatusMask) != Occupied) {
+        continue;
+      }
+      auto releasingState = makeSlotState(getGeneration(state), Releasing);
+      if (slab[i].state.compare_exchange_strong(
+              state,
+              releasingState,
+              std::memory_order_acquire,
+              std::memory_order_relaxed)) {
+        auto index = static_cast<uint32_t>(
+            (&slabPointer - slabs_.data()) * kSlabSize + i);
+        release(index, state);
+      }
+    }
+  }
 }
 
 size_t LongLivedObjectCollection::size() const {
-  std::scoped_lock lock(collectionMutex_);
-  return collection_.size();
+  return size_.load(std::memory_order_relaxed);
+}
+
+LongLivedObjectCollection::Slot& LongLivedObjectCollection::getSlot(
+    uint32_t index) const {
+  return slabs_[index >> kSlabSizeLog2].load(
+      std::memory_order_acquire)[index & (kSlabSize - 1)];
+}
+
+uint32_t LongLivedObjectCollection::allocateSlot() {
+  auto head = freeSlots_.load(std::memory_order_acquire);
+  while ((head & kLowMask) != 0) {
+    auto index = static_cast<uint32_t>((head & kLowMask) - 1);
+    // The slot may be popped concurrently, in which case the value read here
+    // is stale, but the tag makes the exchange below fail.
+    auto next = getSlot(index).nextFreeSlot.load(std::memory_order_relaxed);
+    auto newHead = (((head >> 32) + 1) << 32) | next;
+    if (freeSlots_.compare_exchange_weak(
+            head,
+            newHead,
+            std::memory_order_acquire,
+            std::memory_order_acquire)) {
+      return index;
+    }
+  }
+
+  auto index = slotCount_.fetch_add(1, std::memory_order_relaxed);
+  auto slabIndex = index >> kSlabSizeLog2;
+  if (slabIndex >= kMaxSlabCount) {
+    throw std::length_error("Too many objects in LongLivedObjectCollection");
+  }
+
+  auto& slabPointer = slabs_[slabIndex];
+  if (slabPointer.load(std::memory_order_acquire) == nullptr) {
+    auto* slab = new Slot[kSlabSize];
+    Slot* expected = nullptr;
+    if (!slabPointer.compare_exchange_strong(
+            expected, slab, std::memory_order_acq_rel)) {
+      delete[] slab;
+    }
+  }
+  return index;
+}
+
+void LongLivedObjectCollection::freeSlot(uint32_t index) {
+  auto& slot = getSlot(index);
+  auto head = freeSlots_.load(std::memory_order_relaxed);
+  uint64_t newHead;
+  do {
+    slot.nextFreeSlot.store(
+        static_cast<uint32_t>(head & kLowMask), std::memory_order_relaxed);
+    newHead = (((head >> 32) + 1) << 32) | (index + 1);
+  } while (!freeSlots_.compare_exchange_weak(
+      head, newHead, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void LongLivedObjectCollection::release(
+    uint32_t index,
+    uint64_t occupiedState) {
+  // The slot is in the `Releasing` state, so this thread owns it.
+  auto& slot = getSlot(index);
+  auto object = std::move(slot.object);
+  // Cleared before the handle, as the object can be added again as soon as its
+  // handle is `0`.
+  object->collection_.store(nullptr, std::memory_order_relaxed);
+  object->handle_.store(0, std::memory_order_release);
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  slot.state.store(
+      makeSlotState(getGeneration(occupiedState) + 1, Free),
+      std::memory_order_release);
+  freeSlot(index);
+
+  // The object is destroyed here (if this was the last reference), outside of
+  // any critical section.
 }
 
 // LongLivedObject
@@ -8,12 +8,15 @@
 #pragma once
 
 #include <jsi/jsi.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <mutex>
-#include <unordered_set>
 
 namespace facebook::react {
 
+class LongLivedObjectCollection;
+
 /**
  * A simple wrapper class that can be registered to a collection that keep it
  * alive for extended period of time. This object can be removed from the
@@ -35,27 +38,64 @@ class LongLivedObject {
   explicit LongLivedObject(jsi::Runtime& runtime) : runtime_(runtime) {}
   virtual ~LongLivedObject() = default;
   jsi::Runtime& runtime_;
+
+ private:
+  friend class LongLivedObjectCollection;
+
+  // Collection the object was added to, or `nullptr`. Slot handles are only
+  // meaningful in that collection.
+  std::atomic<const LongLivedObjectCollection*> collection_{nullptr};
+  // Slot of the object in `collection_`, or `0`.
+  std::atomic<uint64_t> handle_{0};
 };
 
 /**
  * A singleton, thread-safe, write-only collection for the `LongLivedObject`s.
+ *
+ * Objects are stored in slots allocated from fixed-size slabs, which are never
+ * moved or freed while the collection is alive. Each object remembers its slot,
+ * so `add` and `remove` are O(1) and lock-free: free slots are kept in a
+ * lock-free stack, and a per-slot generation makes stale handles harmless.
+ * An object can only be in one collection at a time.
  */
 class LongLivedObjectCollection {
  public:
   static LongLivedObjectCollection& get(jsi::Runtime& runtime);
 
-  LongLivedObjectCollection() = default;
+  LongLivedObjectCollection();
+  ~LongLivedObjectCollection();
   LongLivedObjectCollection(const LongLivedObjectCollection&) = delete;
   void operator=(const LongLivedObjectCollection&) = delete;
 
   void add(std::shared_ptr<LongLivedObject> o);
   void remove(const LongLivedObject* o);
+
+  /**
+   * Releases all objects at once, e.g. when the runtime is torn down.
+   * Objects added concurrently with this call may be kept.
+   */
   void clear();
   size_t size() const;
 
  private:
-  std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
-  mutable std::mutex collectionMutex_;
+  static constexpr uint32_t kSlabSizeLog2 = 10;
+  static constexpr uint32_t kSlabSize = 1u << kSlabSizeLog2;
+  static constexpr uint32_t kMaxSlabCount = 4096;
+
+  struct Slot;
+
+  Slot& getSlot(uint32_t index) const;
+  uint32_t allocateSlot();
+  void freeSlot(uint32_t index);
+  void release(uint32_t index, uint64_t occupiedState);
+
+  std::array<std::atomic<Slot*>, kMaxSlabCount> slabs_{};
+  // Number of slots that were ever handed out.
+  std::atomic<uint32_t> slotCount_{0};
+  // Top of the stack of free slots: an ABA tag in the high bits and the slot
+  // index plus one in the low bits (`0` when the stack is empty).
+  std::atomic<uint64_t> freeSlots_{0};
+  std::atomic<size_t> size_{0};
 };
 
 } // namespace facebook::react
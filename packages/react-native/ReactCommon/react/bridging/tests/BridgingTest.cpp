@@ -194,6 +194,64 @@ TEST_F(BridgingTest, arrayTest) {
   EXPECT_EQ(headers.size(), jsiHeaders.size(rt));
 }
 
+TEST_F(BridgingTest, arrayBufferTest) {
+  auto bytes = std::vector<uint8_t>{1, 2, 3, 255};
+
+  // Byte vectors are still arrays of numbers.
+  EXPECT_TRUE(function("(a) => Array.isArray(a)")
+                  .call(rt, bridging::toJs(rt, bytes, invoker))
+                  .getBool());
+
+  // Byte buffers are passed as Uint8Arrays backed by the native storage.
+  auto uint8Array = bridging::toJs(rt, ByteBuffer{bytes}, invoker);
+  EXPECT_TRUE(function("(a) => a instanceof Uint8Array")
+                  .call(rt, jsi::Value(rt, uint8Array))
+                  .getBool());
+  EXPECT_EQ(4, uint8Array.getProperty(rt, "length").asNumber());
+  EXPECT_EQ(255, uint8Array.getProperty(rt, "3").asNumber());
+
+  auto movedBuffer = ByteBuffer{bytes};
+  const auto* movedData = movedBuffer.bytes.data();
+  auto movedUint8Array = bridging::toJs(rt, std::move(movedBuffer), invoker);
+  auto arrayBuffer = movedUint8Array.getProperty(rt, "buffer")
+                         .asObject(rt)
+                         .getArrayBuffer(rt);
+  EXPECT_EQ(movedData, arrayBuffer.data(rt));
+
+  // ArrayBuffers, typed arrays and DataViews are all supported.
+  EXPECT_EQ(
+      ByteBuffer{bytes},
+      bridging::fromJs<ByteBuffer>(rt, uint8Array, invoker));
+  EXPECT_EQ(
+      ByteBuffer{bytes},
+      bridging::fromJs<ByteBuffer>(rt, arrayBuffer, invoker));
+  EXPECT_EQ(
+      (ByteBuffer{{2, 3}}),
+      bridging::fromJs<ByteBuffer>(
+          rt,
+          eval("new DataView(new Uint8Array([1, 2, 3, 4]).buffer, 1, 2)"),
+          invoker));
+  EXPECT_JSI_THROW(
+      bridging::fromJs<ByteBuffer>(rt, eval("[1, 2, 3, 255]"), invoker));
+
+  // Spans are views of the JS buffer.
+  auto span = bridging::fromJs<std::span<uint8_t>>(rt, arrayBuffer, invoker);
+  EXPECT_EQ(movedData, span.data());
+  EXPECT_EQ(4, span.size());
+  span[0] = 42;
+  EXPECT_EQ(42, movedUint8Array.getProperty(rt, "0").asNumber());
+  EXPECT_EQ(1, uint8Array.getProperty(rt, "0").asNumber());
+
+  auto copiedUint8Array = bridging::toJs(
+      rt, std::span<const uint8_t>(bytes.data(), 2), invoker);
+  EXPECT_EQ(2, copiedUint8Array.getProperty(rt, "length").asNumber());
+
+  EXPECT_TRUE((bridging::supportsFromJs<ByteBuffer, jsi::Object>));
+  EXPECT_TRUE(
+      (bridging::supportsFromJs<std::span<const uint8_t>, jsi::Object>));
+  EXPECT_FALSE((bridging::supportsFromJs<ByteBuffer, jsi::String>));
+}
+
 TEST_F(BridgingTest, functionTest) {
   auto object = jsi::Object(rt);
   object.setProperty(rt, "foo", "bar");
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BridgingTest.h"
+
+#include <thread>
+
+namespace facebook::react {
+
+namespace {
+
+class TestLongLivedObject : public LongLivedObject {
+ public:
+  explicit TestLongLivedObject(jsi::Runtime& runtime)
+      : LongLivedObject(runtime) {}
+};
+
+} // namespace
+
+TEST_F(BridgingTest, longLivedObjectCollectionAddRemoveTest) {
+  LongLivedObjectCollection collection;
+  auto first = std::make_shared<TestLongLivedObject>(rt);
+  auto second = std::make_shared<TestLongLivedObject>(rt);
+  std::weak_ptr<TestLongLivedObject> weakFirst = first;
+
+  collection.add(first);
+  collection.add(second);
+  // Adding an object twice keeps a single entry.
+  collection.add(second);
+  EXPECT_EQ(2, collection.size());
+
+  first.reset();
+  EXPECT_FALSE(weakFirst.expired());
+
+  collection.remove(weakFirst.lock().get());
+  EXPECT_TRUE(weakFirst.expired());
+  EXPECT_EQ(1, collection.size());
+
+  collection.remove(second.get());
+  EXPECT_EQ(0, collection.size());
+
+  // Removing an object that isn't in the collection is a no-op.
+  collection.remove(second.get());
+  collection.remove(nullptr);
+  EXPECT_EQ(0, collection.size());
+}
+
+TEST_F(BridgingTest, longLivedObjectCollectionStaleHandleTest) {
+  LongLivedObjectCollection collection;
+  auto first = std::make_shared<TestLongLivedObject>(rt);
+  collection.add(first);
+  collection.remove(first.get());
+
+  // The slot of the first object is reused, so the removal of the first
+  // object again must not release the second one.
+  auto second = std::make_shared<TestLongLivedObject>(rt);
+  std::weak_ptr<TestLongLivedObject> weakSecond = second;
+  collection.add(std::move(second));
+  collection.remove(first.get());
+  EXPECT_EQ(1, collection.size());
+  EXPECT_FALSE(weakSecond.expired());
+
+  // Objects can be added again after being removed.
+  collection.add(first);
+  EXPECT_EQ(2, collection.size());
+}
+
+TEST_F(BridgingTest, longLivedObjectCollectionForeignHandleTest) {
+  LongLivedObjectCollection collection;
+  LongLivedObjectCollection otherCollection;
+  auto first = std::make_shared<TestLongLivedObject>(rt);
+  auto second = std::make_shared<TestLongLivedObject>(rt);
+  std::weak_ptr<TestLongLivedObject> weakFirst = first;
+
+  // Both objects get the same slot in their own collection.
+  collection.add(first);
+  otherCollection.add(second);
+
+  // Removing an object from a collection it isn't in is a no-op, and leaves
+  // the occupant of the same slot there.
+  collection.remove(second.get());
+  EXPECT_EQ(1, collection.size());
+  EXPECT_EQ(1, otherCollection.size());
+
+  first.reset();
+  collection.remove(weakFirst.lock().get());
+  EXPECT_TRUE(weakFirst.expired());
+  EXPECT_EQ(0, collection.size());
+
+  otherCollection.remove(second.get());
+  EXPECT_EQ(0, otherCollection.size());
+}
+
+TEST_F(BridgingTest, longLivedObjectCollectionClearTest) {
+  LongLivedObjectCollection collection;
+  std::vector<std::weak_ptr<TestLongLivedObject>> objects;
+  for (int i = 0; i < 3000; i++) {
+    auto object = std::make_shared<TestLongLivedObject>(rt);
+    objects.push_back(object);
+    collection.add(std::move(object));
+  }
+  EXPECT_EQ(3000, collection.size());
+
+  collection.clear();
+  EXPECT_EQ(0, collection.size());
+  for (const auto& object : objects) {
+    EXPECT_TRUE(object.expired());
+  }
+}
+
+TEST_F(BridgingTest, longLivedObjectCollectionConcurrencyTest) {
+  LongLivedObjectCollection collection;
+  constexpr int threadCount = 8;
+  constexpr int objectCount = 1000;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < threadCount; i++) {
+    threads.emplace_back([&]() {
+      std::vector<std::weak_ptr<TestLongLivedObject>> objects;
+      for (int j = 0; j < objectCount; j++) {
+        auto object = std::make_shared<TestLongLivedObject>(rt);
+        objects.push_back(object);
+        collection.add(std::move(object));
+      }
+      for (const auto& object : objects) {
+        auto lockedObject = object.lock();
+        ASSERT_NE(lockedObject, nullptr);
+        collection.remove(lockedObject.get());
+      }
+      for (const auto& object : objects) {
+        EXPECT_TRUE(object.expired());
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(0, collection.size());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/bridging/Array.h>
+#include <react/bridging/ArrayBuffer.h>
+#include <react/bridging/Number.h>
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kPayloadSize = 1024 * 1024;
+
+std::unique_ptr<jsi::Runtime> runtime = facebook::hermes::makeHermesRuntime();
+
+std::vector<uint8_t> makePayload() {
+  std::vector<uint8_t> payload(kPayloadSize);
+  for (size_t i = 0; i < payload.size(); i++) {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+  return payload;
+}
+
+/*
+ * Baseline: a payload converted element by element to an array of numbers,
+ * which is how byte vectors are bridged.
+ */
+void payloadToJsAsArray(benchmark::State& state) {
+  auto payload = makePayload();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bridging::toJs(*runtime, payload, nullptr));
+  }
+}
+BENCHMARK(payloadToJsAsArray);
+
+void payloadToJsAsCopiedUint8Array(benchmark::State& state) {
+  auto payload = ByteBuffer{makePayload()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bridging::toJs(*runtime, payload, nullptr));
+  }
+}
+BENCHMARK(payloadToJsAsCopiedUint8Array);
+
+void payloadToJsAsMovedUint8Array(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto payload = ByteBuffer{makePayload()};
+    state.ResumeTiming();
+    benchmark::DoNotOptimize(
+        bridging::toJs(*runtime, std::move(payload), nullptr));
+  }
+}
+BENCHMARK(payloadToJsAsMovedUint8Array);
+
+void payloadFromJsAsArray(benchmark::State& state) {
+  auto array = bridging::toJs(*runtime, makePayload(), nullptr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        bridging::fromJs<std::vector<uint8_t>>(*runtime, array, nullptr));
+  }
+}
+BENCHMARK(payloadFromJsAsArray);
+
+void payloadFromJsAsByteBuffer(benchmark::State& state) {
+  auto uint8Array =
+      bridging::toJs(*runtime, ByteBuffer{makePayload()}, nullptr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        bridging::fromJs<ByteBuffer>(*runtime, uint8Array, nullptr));
+  }
+}
+BENCHMARK(payloadFromJsAsByteBuffer);
+
+void payloadFromJsAsSpan(benchmark::State& state) {
+  auto uint8Array =
+      bridging::toJs(*runtime, ByteBuffer{makePayload()}, nullptr);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(bridging::fromJs<std::span<const uint8_t>>(
+        *runtime, uint8Array, nullptr));
+  }
+}
+BENCHMARK(payloadFromJsAsSpan);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
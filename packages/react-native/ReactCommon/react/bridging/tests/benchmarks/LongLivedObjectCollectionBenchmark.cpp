@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/bridging/LongLivedObject.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kPendingObjectCount = 256;
+
+std::unique_ptr<jsi::Runtime> runtime = facebook::hermes::makeHermesRuntime();
+
+class BenchmarkLongLivedObject : public LongLivedObject {
+ public:
+  BenchmarkLongLivedObject() : LongLivedObject(*runtime) {}
+};
+
+/*
+ * The previous implementation of the collection, for comparison: a hash set
+ * behind a single mutex, with removal by linear search.
+ */
+class MutexLongLivedObjectCollection {
+ public:
+  void add(std::shared_ptr<LongLivedObject> o) {
+    std::scoped_lock lock(mutex_);
+    collection_.insert(std::move(o));
+  }
+
+  void remove(const LongLivedObject* o) {
+    std::scoped_lock lock(mutex_);
+    for (auto p = collection_.begin(); p != collection_.end(); p++) {
+      if (p->get() == o) {
+        collection_.erase(p);
+        break;
+      }
+    }
+  }
+
+ private:
+  std::unordered_set<std::shared_ptr<LongLivedObject>> collection_;
+  std::mutex mutex_;
+};
+
+LongLivedObjectCollection lockFreeCollection;
+MutexLongLivedObjectCollection mutexCollection;
+
+/*
+ * Every thread registers a batch of objects (like promises created by async
+ * TurboModule calls) and releases them (like native threads resolving them).
+ */
+template <typename CollectionT>
+void addAndRemove(benchmark::State& state, CollectionT& collection) {
+  std::vector<std::shared_ptr<BenchmarkLongLivedObject>> objects;
+  objects.reserve(kPendingObjectCount);
+  for (int i = 0; i < kPendingObjectCount; i++) {
+    objects.push_back(std::make_shared<BenchmarkLongLivedObject>());
+  }
+
+  for (auto _ : state) {
+    for (const auto& object : objects) {
+      collection.add(object);
+    }
+    for (const auto& object : objects) {
+      collection.remove(object.get());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kPendingObjectCount);
+}
+
+void lockFreeAddAndRemove(benchmark::State& state) {
+  addAndRemove(state, lockFreeCollection);
+}
+BENCHMARK(lockFreeAddAndRemove)->ThreadRange(1, 8)->UseRealTime();
+
+void mutexAddAndRemove(benchmark::State& state) {
+  addAndRemove(state, mutexCollection);
+}
+BENCHMARK(mutexAddAndRemove)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
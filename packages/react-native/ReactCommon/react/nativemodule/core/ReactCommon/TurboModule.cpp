@@ -10,6 +10,20 @@
 
 namespace facebook::react {
 
+namespace {
+
+// Identifies the per-runtime cache of PropNameIDs shared by TurboModules.
+constexpr jsi::UUID kSharedPropNameIDsKey{
+    0x3f7a1c52,
+    0x9d04,
+    0x11ef,
+    0x8b6e,
+    0x0242ac120002};
+
+using SharedPropNameIDs = std::unordered_map<std::string, jsi::PropNameID>;
+
+} // namespace
+
 TurboModuleMethodValueKind getTurboModuleMethodValueKind(
     jsi::Runtime& rt,
     const jsi::Value* value) {
@@ -39,6 +53,53 @@ TurboModule::TurboModule(
     std::shared_ptr<CallInvoker> jsInvoker)
     : name_(std::move(name)), jsInvoker_(std::move(jsInvoker)) {}
 
+const jsi::PropNameID& TurboModule::getSharedPropNameID(
+    jsi::Runtime& runtime,
+    const std::string& name) {
+  // The cache is owned by the runtime, so the PropNameIDs are released
+  // together with it.
+  auto sharedPropNameIDs = std::static_pointer_cast<SharedPropNameIDs>(
+      runtime.getRuntimeData(kSharedPropNameIDsKey));
+  if (!sharedPropNameIDs) {
+    sharedPropNameIDs = std::make_shared<SharedPropNameIDs>();
+    runtime.setRuntimeData(kSharedPropNameIDsKey, sharedPropNameIDs);
+  }
+
+  auto it = sharedPropNameIDs->find(name);
+  if (it == sharedPropNameIDs->end()) {
+    it = sharedPropNameIDs
+             ->emplace(name, jsi::PropNameID::forUtf8(runtime, name))
+             .first;
+  }
+  return it->second;
+}
+
+jsi::Value TurboModule::installMethods(
+    jsi::Runtime& runtime,
+    const jsi::PropNameID& propName) {
+  auto jsRepresentation = jsRepresentation_->lock(runtime);
+  if (!jsRepresentation.isObject()) {
+    return jsi::Value::undefined();
+  }
+
+  auto jsRepresentationObject = jsRepresentation.asObject(runtime);
+  auto result = jsi::Value::undefined();
+  for (const auto& [methodName, _] : methodMap_) {
+    const auto& methodPropName = getSharedPropNameID(runtime, methodName);
+    auto method = create(runtime, methodPropName);
+    if (method.isUndefined()) {
+      continue;
+    }
+    if (result.isUndefined() &&
+        jsi::PropNameID::compare(runtime, methodPropName, propName)) {
+      result = jsi::Value(runtime, method);
+    }
+    jsRepresentationObject.setProperty(
+        runtime, methodPropName, std::move(method));
+  }
+  return result;
+}
+
 void TurboModule::emitDeviceEvent(
     const std::string& eventName,
     ArgFactory argFactory) {
@@ -57,6 +57,16 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
   // between RTTI and non-RTTI compilation units
   jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& propName)
       override {
+    // On the first lookup, install all methods on the JS representation at
+    // once, so that further method lookups don't go through this HostObject.
+    if (jsRepresentation_ && !methodsInstalled_) {
+      methodsInstalled_ = true;
+      auto method = installMethods(runtime, propName);
+      if (!method.isUndefined()) {
+        return method;
+      }
+    }
+
     auto prop = create(runtime, propName);
     // If we have a JS wrapper, cache the result of this lookup
     // We don't cache misses, to allow for methodMap_ to dynamically be
@@ -73,7 +83,7 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
     std::vector<jsi::PropNameID> result;
     result.reserve(methodMap_.size());
     for (auto it = methodMap_.cbegin(); it != methodMap_.cend(); ++it) {
-      result.push_back(jsi::PropNameID::forUtf8(runtime, it->first));
+      result.emplace_back(runtime, getSharedPropNameID(runtime, it->first));
     }
     return result;
   }
@@ -113,6 +123,15 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
       const std::string& eventName,
       ArgFactory argFactory = nullptr);
 
+  /**
+   * Returns a PropNameID for the given name, shared by all TurboModules in
+   * the runtime. Method names like `getConstants` or `addListener` are
+   * common to many modules, so they are only created once per runtime.
+   */
+  static const jsi::PropNameID& getSharedPropNameID(
+      jsi::Runtime& runtime,
+      const std::string& name);
+
   // Backwards compatibility version
   void emitDeviceEvent(
       jsi::Runtime& /*runtime*/,
@@ -149,7 +168,18 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
 
  private:
   friend class TurboModuleBinding;
+
+  /**
+   * Creates every method in `methodMap_` (through `create`, so overrides are
+   * respected) and sets it on the JS representation. Returns the method
+   * named `propName` if it was installed, or `undefined` otherwise.
+   */
+  jsi::Value installMethods(
+      jsi::Runtime& runtime,
+      const jsi::PropNameID& propName);
+
   std::unique_ptr<jsi::WeakObject> jsRepresentation_;
+  bool methodsInstalled_{false};
 };
 
 /**
@@ -8,6 +8,7 @@
 #include "TurboModuleBinding.h"
 
 #include <ReactCommon/TurboModuleWithJSIBindings.h>
+#include <cxxreact/ReactMarker.h>
 #include <cxxreact/TraceSection.h>
 #include <react/utils/jsi-utils.h>
 #include <stdexcept>
@@ -82,6 +83,31 @@ class BridgelessNativeModuleProxy : public jsi::HostObject {
   }
 };
 
+namespace {
+
+/**
+ * Defines a read-only global of a bridgeless runtime, timed with
+ * INSTALL_RUNTIME_BINDING markers when a marker logger is set.
+ */
+template <typename ValueFactory>
+void defineBridgelessGlobal(
+    jsi::Runtime& runtime,
+    const char* name,
+    ValueFactory&& valueFactory) {
+  bool hasLogger(ReactMarker::logTaggedMarkerBridgelessImpl);
+  if (hasLogger) {
+    ReactMarker::logTaggedMarkerBridgeless(
+        ReactMarker::INSTALL_RUNTIME_BINDING_START, name);
+  }
+  defineReadOnlyGlobal(runtime, name, valueFactory());
+  if (hasLogger) {
+    ReactMarker::logTaggedMarkerBridgeless(
+        ReactMarker::INSTALL_RUNTIME_BINDING_STOP, name);
+  }
+}
+
+} // namespace
+
 /**
  * Public API to install the TurboModule system.
  */
@@ -103,6 +129,8 @@ void TurboModuleBinding::install(
   auto isBridgeless = runtime.global().hasProperty(runtime, "RN$Bridgeless");
 
   if (!isBridgeless) {
+    ReactMarker::logTaggedMarker(
+        ReactMarker::INSTALL_RUNTIME_BINDING_START, "__turboModuleProxy");
     runtime.global().setProperty(
         runtime,
         "__turboModuleProxy",
@@ -125,20 +153,23 @@ void TurboModuleBinding::install(
               std::string moduleName = args[0].getString(rt).utf8(rt);
               return binding.getModule(rt, moduleName);
             }));
+    ReactMarker::logTaggedMarker(
+        ReactMarker::INSTALL_RUNTIME_BINDING_STOP, "__turboModuleProxy");
     return;
   }
 
-  defineReadOnlyGlobal(runtime, "RN$UnifiedNativeModuleProxy", true);
-  defineReadOnlyGlobal(
-      runtime,
-      "nativeModuleProxy",
-      jsi::Object::createFromHostObject(
-          runtime,
-          std::make_shared<BridgelessNativeModuleProxy>(
-              runtime,
-              std::move(moduleProvider),
-              std::move(legacyModuleProvider),
-              longLivedObjectCollection)));
+  defineBridgelessGlobal(runtime, "RN$UnifiedNativeModuleProxy", [] {
+    return jsi::Value(true);
+  });
+  defineBridgelessGlobal(runtime, "nativeModuleProxy", [&]() -> jsi::Value {
+    return jsi::Object::createFromHostObject(
+        runtime,
+        std::make_shared<BridgelessNativeModuleProxy>(
+            runtime,
+            std::move(moduleProvider),
+            std::move(legacyModuleProvider),
+            longLivedObjectCollection));
+  });
 }
 
 TurboModuleBinding::~TurboModuleBinding() {
@@ -178,6 +209,7 @@ jsi::Value TurboModuleBinding::getModule(
     jsi::Object jsRepresentation(runtime);
     weakJsRepresentation =
         std::make_unique<jsi::WeakObject>(runtime, jsRepresentation);
+    module->methodsInstalled_ = false;
 
     // Lazily populate the jsRepresentation, on property access.
     //
@@ -185,9 +217,10 @@ jsi::Value TurboModuleBinding::getModule(
     //   1. Initially jsRepresentation is empty: {}
     //   2. If property lookup on jsRepresentation fails, the JS runtime will
     //   search jsRepresentation's prototype: jsi::Object(TurboModule).
-    //   3. TurboModule::get(runtime, propKey) executes. This creates the
-    //   property, caches it on jsRepresentation, then returns it to
-    //   JavaScript.
+    //   3. TurboModule::get(runtime, propKey) executes. The first time, this
+    //   creates all methods and caches them on jsRepresentation. Otherwise,
+    //   it creates the property, caches it on jsRepresentation, then returns
+    //   it to JavaScript.
     auto hostObject =
         jsi::Object::createFromHostObject(runtime, std::move(module));
     jsRepresentation.setProperty(runtime, "__proto__", std::move(hostObject));
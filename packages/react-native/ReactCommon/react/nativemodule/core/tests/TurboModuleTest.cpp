@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/instrumentation.h>
+#include <jsi/jsi.h>
+
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+class NoopCallInvoker : public CallInvoker {
+ public:
+  void invokeAsync(CallFunc&& /*func*/) noexcept override {}
+  void invokeSync(CallFunc&& /*func*/) override {}
+};
+
+jsi::Value add(
+    jsi::Runtime& /*rt*/,
+    TurboModule& /*turboModule*/,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  return {args[0].asNumber() + args[1].asNumber()};
+}
+
+jsi::Value negate(
+    jsi::Runtime& /*rt*/,
+    TurboModule& /*turboModule*/,
+    const jsi::Value* args,
+    size_t /*count*/) {
+  return {-args[0].asNumber()};
+}
+
+/*
+ * Records the names passed to `create`, and overrides the `version` method
+ * with a constant.
+ */
+class TestTurboModule : public TurboModule {
+ public:
+  explicit TestTurboModule(std::shared_ptr<CallInvoker> jsInvoker)
+      : TurboModule("TestModule", std::move(jsInvoker)) {
+    methodMap_["add"] = MethodMetadata{2, add};
+    methodMap_["negate"] = MethodMetadata{1, negate};
+    methodMap_["version"] = MethodMetadata{0, add};
+  }
+
+  jsi::Value create(jsi::Runtime& runtime, const jsi::PropNameID& propName)
+      override {
+    auto name = propName.utf8(runtime);
+    createdNames.push_back(name);
+    if (name == "version") {
+      return {42};
+    }
+    return TurboModule::create(runtime, propName);
+  }
+
+  void addNegateMethod(const std::string& name) {
+    methodMap_[name] = MethodMetadata{1, negate};
+  }
+
+  std::vector<std::string> createdNames;
+};
+
+} // namespace
+
+class TurboModuleTest : public ::testing::Test {
+ protected:
+  TurboModuleTest()
+      : runtime_(facebook::hermes::makeHermesRuntime()),
+        module_(std::make_shared<TestTurboModule>(
+            std::make_shared<NoopCallInvoker>())) {
+    TurboModuleBinding::install(
+        *runtime_,
+        [module = module_](
+            const std::string& name) -> std::shared_ptr<TurboModule> {
+          return name == "TestModule" ? module : nullptr;
+        });
+  }
+
+  jsi::Value eval(const std::string& code) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(code), "");
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::shared_ptr<TestTurboModule> module_;
+};
+
+TEST_F(TurboModuleTest, installsAllMethodsOnFirstAccess) {
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').add(1, 2)").asNumber(), 3);
+  EXPECT_EQ(module_->createdNames.size(), 3);
+
+  // The methods are own properties of the JS representation, so they are no
+  // longer looked up through the TurboModule.
+  EXPECT_EQ(
+      eval("Object.getOwnPropertyNames(__turboModuleProxy('TestModule'))"
+           "    .sort().join()")
+          .asString(*runtime_)
+          .utf8(*runtime_),
+      "add,negate,version");
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').negate(5)").asNumber(), -5);
+  EXPECT_EQ(module_->createdNames.size(), 3);
+}
+
+TEST_F(TurboModuleTest, installsMethodsThroughCreate) {
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').version").asNumber(), 42);
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').version").asNumber(), 42);
+  EXPECT_EQ(module_->createdNames.size(), 3);
+
+  // Properties that aren't methods are still created on access.
+  EXPECT_TRUE(eval("__turboModuleProxy('TestModule').unknown").isUndefined());
+  EXPECT_EQ(module_->createdNames.size(), 4);
+  EXPECT_EQ(module_->createdNames.back(), "unknown");
+}
+
+TEST_F(TurboModuleTest, resolvesMethodsAddedAfterInstallation) {
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').add(1, 2)").asNumber(), 3);
+
+  module_->addNegateMethod("subtract");
+
+  EXPECT_EQ(
+      eval("__turboModuleProxy('TestModule').subtract(3)").asNumber(), -3);
+  EXPECT_EQ(module_->createdNames.size(), 4);
+  EXPECT_EQ(module_->createdNames.back(), "subtract");
+}
+
+TEST_F(TurboModuleTest, reinstallsMethodsWhenJSRepresentationIsRecreated) {
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').add(1, 2)").asNumber(), 3);
+  EXPECT_EQ(module_->createdNames.size(), 3);
+
+  // Nothing retains the JS representation, so it is collected and the next
+  // access creates a new one, without any method.
+  runtime_->instrumentation().collectGarbage("test");
+
+  EXPECT_EQ(eval("__turboModuleProxy('TestModule').negate(5)").asNumber(), -5);
+  EXPECT_EQ(module_->createdNames.size(), 6);
+  EXPECT_EQ(
+      eval("Object.getOwnPropertyNames(__turboModuleProxy('TestModule'))"
+           "    .length")
+          .asNumber(),
+      3);
+}
+
+} // namespace facebook::react
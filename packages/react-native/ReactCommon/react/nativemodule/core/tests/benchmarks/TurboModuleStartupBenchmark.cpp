@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kModuleCount = 50;
+constexpr int kMethodCount = 20;
+
+class NoopCallInvoker : public CallInvoker {
+ public:
+  void invokeAsync(CallFunc&& /*func*/) noexcept override {}
+  void invokeSync(CallFunc&& /*func*/) override {}
+};
+
+jsi::Value returnArgCount(
+    jsi::Runtime& /*rt*/,
+    TurboModule& /*turboModule*/,
+    const jsi::Value* /*args*/,
+    size_t count) {
+  return {static_cast<int>(count)};
+}
+
+/*
+ * Mimics a generated C++ TurboModule spec with `kMethodCount` methods. The
+ * common method names are shared by every module.
+ */
+class BenchmarkTurboModule : public TurboModule {
+ public:
+  BenchmarkTurboModule(
+      std::string name,
+      std::shared_ptr<CallInvoker> jsInvoker)
+      : TurboModule(std::move(name), std::move(jsInvoker)) {
+    methodMap_["getConstants"] = MethodMetadata{0, returnArgCount};
+    methodMap_["addListener"] = MethodMetadata{1, returnArgCount};
+    methodMap_["removeListeners"] = MethodMetadata{1, returnArgCount};
+    for (int i = 3; i < kMethodCount; i++) {
+      methodMap_["method" + std::to_string(i)] =
+          MethodMetadata{1, returnArgCount};
+    }
+  }
+};
+
+std::unique_ptr<jsi::Runtime> makeRuntime() {
+  auto runtime = facebook::hermes::makeHermesRuntime();
+  auto jsInvoker = std::make_shared<NoopCallInvoker>();
+  // Modules are cached by name, like TurboModuleManager does.
+  auto modules = std::make_shared<
+      std::unordered_map<std::string, std::shared_ptr<TurboModule>>>();
+  TurboModuleBinding::install(
+      *runtime,
+      [jsInvoker, modules](
+          const std::string& name) -> std::shared_ptr<TurboModule> {
+        auto& module = (*modules)[name];
+        if (!module) {
+          module = std::make_shared<BenchmarkTurboModule>(name, jsInvoker);
+        }
+        return module;
+      });
+  return runtime;
+}
+
+jsi::Function makeFunction(jsi::Runtime& runtime, const std::string& source) {
+  return runtime
+      .evaluateJavaScript(
+          std::make_shared<jsi::StringBuffer>("(" + source + ")"), "")
+      .asObject(runtime)
+      .asFunction(runtime);
+}
+
+/*
+ * Measures the latency of the first calls to each of `kModuleCount` modules,
+ * as happens during startup: the module is required, then a few of its
+ * methods are called once.
+ */
+void firstCallAcrossModules(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto runtime = makeRuntime();
+    {
+      auto callModules = makeFunction(
+          *runtime,
+          "function (moduleCount) {"
+          "  var result = 0;"
+          "  for (var i = 0; i < moduleCount; i++) {"
+          "    var module = __turboModuleProxy('Module' + i);"
+          "    result += module.getConstants();"
+          "    result += module.addListener('event');"
+          "    result += module.method7(i);"
+          "  }"
+          "  return result;"
+          "}");
+      state.ResumeTiming();
+
+      benchmark::DoNotOptimize(callModules.call(*runtime, kModuleCount));
+
+      state.PauseTiming();
+    }
+    runtime.reset();
+    state.ResumeTiming();
+  }
+}
+BENCHMARK(firstCallAcrossModules);
+
+/*
+ * Measures repeated calls once all modules have been accessed.
+ */
+void warmCallAcrossModules(benchmark::State& state) {
+  auto runtime = makeRuntime();
+  auto callModules = makeFunction(
+      *runtime,
+      "function (moduleCount) {"
+      "  var result = 0;"
+      "  for (var i = 0; i < moduleCount; i++) {"
+      "    var module = __turboModuleProxy('Module' + i);"
+      "    result += module.method7(i) + module.method12(i);"
+      "  }"
+      "  return result;"
+      "}");
+  callModules.call(*runtime, kModuleCount);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(callModules.call(*runtime, kModuleCount));
+  }
+}
+BENCHMARK(warmCallAcrossModules);
+
+} // namespace
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -11,6 +11,10 @@
 #include <react/renderer/dom/DOM.h>
 #include <react/renderer/uimanager/PointerEventsProcessor.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <string>
 
 #ifdef RN_DISABLE_OSS_PLUGIN_HEADER
 #include "Plugins.h"
@@ -366,6 +370,67 @@ NativeDOM::getOffset(
       domOffset.left};
 }
 
+#pragma mark - Batched layout APIs.
+
+jsi::Value NativeDOM::getLayoutBatch(
+    jsi::Runtime& rt,
+    std::vector<std::shared_ptr<const ShadowNode>> shadowNodes,
+    int query) {
+  if (query < static_cast<int>(dom::DOMLayoutQuery::BoundingClientRect) ||
+      query > static_cast<int>(dom::DOMLayoutQuery::Offset)) {
+    throw jsi::JSError(
+        rt, "Unknown layout query '" + std::to_string(query) + "'.");
+  }
+
+  auto domLayoutQuery = static_cast<dom::DOMLayoutQuery>(query);
+  auto stride = dom::getLayoutQueryStride(domLayoutQuery);
+  auto values = std::vector<double>(shadowNodes.size() * stride, 0);
+
+  // All the nodes in a batch are expected to belong to the same surface, but
+  // we group them by surface to resolve each of them against its own revision.
+  std::unordered_map<SurfaceId, std::vector<size_t>> indicesBySurfaceId;
+  for (size_t i = 0; i < shadowNodes.size(); i++) {
+    if (shadowNodes[i] != nullptr) {
+      indicesBySurfaceId[shadowNodes[i]->getSurfaceId()].push_back(i);
+    }
+  }
+
+  for (const auto& [surfaceId, indices] : indicesBySurfaceId) {
+    auto currentRevision = getCurrentShadowTreeRevision(rt, surfaceId);
+    if (currentRevision == nullptr) {
+      continue;
+    }
+
+    auto surfaceShadowNodes = std::vector<std::shared_ptr<const ShadowNode>>{};
+    surfaceShadowNodes.reserve(indices.size());
+    for (auto index : indices) {
+      surfaceShadowNodes.push_back(shadowNodes[index]);
+    }
+
+    auto surfaceValues = dom::getLayoutBatch(
+        currentRevision, surfaceShadowNodes, domLayoutQuery);
+    for (size_t i = 0; i < indices.size(); i++) {
+      std::copy_n(
+          surfaceValues.begin() + static_cast<std::ptrdiff_t>(i * stride),
+          stride,
+          values.begin() + static_cast<std::ptrdiff_t>(indices[i] * stride));
+    }
+  }
+
+  // Return the values in a single `Float64Array` instead of an array of
+  // boxed numbers.
+  auto float64Array =
+      rt.global()
+          .getPropertyAsFunction(rt, "Float64Array")
+          .callAsConstructor(rt, static_cast<double>(values.size()))
+          .asObject(rt);
+  auto arrayBuffer =
+      float64Array.getPropertyAsObject(rt, "buffer").getArrayBuffer(rt);
+  std::memcpy(
+      arrayBuffer.data(rt), values.data(), values.size() * sizeof(double));
+  return float64Array;
+}
+
 #pragma mark - Special methods to handle the root node.
 
 jsi::Value NativeDOM::linkRootNode(
@@ -105,6 +105,13 @@ class NativeDOM : public NativeDOMCxxSpec<NativeDOM> {
       /* left: */ double>
   getOffset(jsi::Runtime& rt, std::shared_ptr<const ShadowNode> shadowNode);
 
+#pragma mark - Batched layout APIs.
+
+  jsi::Value getLayoutBatch(
+      jsi::Runtime& rt,
+      std::vector<std::shared_ptr<const ShadowNode>> shadowNodes,
+      int query);
+
 #pragma mark - Special methods to handle the root node.
 
   jsi::Value linkRootNode(
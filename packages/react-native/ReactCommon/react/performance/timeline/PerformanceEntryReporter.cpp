@@ -92,7 +92,8 @@ PerformanceEntryReporter::getSupportedEntryTypes() {
 }
 
 uint32_t PerformanceEntryReporter::getDroppedEntriesCount(
-    PerformanceEntryType entryType) const noexcept {
+    PerformanceEntryType entryType) const {
+  mergePendingEntries();
   std::shared_lock lock(buffersMutex_);
 
   return (uint32_t)getBuffer(entryType).droppedEntriesCount;
@@ -106,6 +107,7 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries() const {
 
 void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest) const {
+  mergePendingEntries();
   std::shared_lock lock(buffersMutex_);
 
   for (auto entryType : getSupportedEntryTypes()) {
@@ -123,6 +125,7 @@ std::vector<PerformanceEntry> PerformanceEntryReporter::getEntries(
 void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest,
     PerformanceEntryType entryType) const {
+  mergePendingEntries();
   std::shared_lock lock(buffersMutex_);
 
   getBuffer(entryType).getEntries(dest);
@@ -140,12 +143,14 @@ void PerformanceEntryReporter::getEntries(
     std::vector<PerformanceEntry>& dest,
     PerformanceEntryType entryType,
     const std::string& entryName) const {
+  mergePendingEntries();
   std::shared_lock lock(buffersMutex_);
 
   getBuffer(entryType).getEntries(dest, entryName);
 }
 
 void PerformanceEntryReporter::clearEntries() {
+  mergePendingEntries();
   std::unique_lock lock(buffersMutex_);
 
   for (auto entryType : getSupportedEntryTypes()) {
@@ -154,6 +159,7 @@ void PerformanceEntryReporter::clearEntries() {
 }
 
 void PerformanceEntryReporter::clearEntries(PerformanceEntryType entryType) {
+  mergePendingEntries();
   std::unique_lock lock(buffersMutex_);
 
   getBufferRef(entryType).clear();
@@ -162,6 +168,7 @@ void PerformanceEntryReporter::clearEntries(PerformanceEntryType entryType) {
 void PerformanceEntryReporter::clearEntries(
     PerformanceEntryType entryType,
     const std::string& entryName) {
+  mergePendingEntries();
   std::unique_lock lock(buffersMutex_);
 
   getBufferRef(entryType).clear(entryName);
@@ -232,43 +239,34 @@ void PerformanceEntryReporter::reportEvent(
     HighResTimeStamp processingStart,
     HighResTimeStamp processingEnd,
     uint32_t interactionId) {
-  eventCounts_[name]++;
-
-  if (duration < eventBuffer_.durationThreshold) {
-    // The entries duration is lower than the desired reporting threshold,
-    // skip
-    return;
-  }
-
-  const auto entry = PerformanceEventTiming{
+  auto entry = PerformanceEntry{PerformanceEventTiming{
       {.name = std::move(name), .startTime = startTime, .duration = duration},
       processingStart,
       processingEnd,
-      interactionId};
+      interactionId}};
 
-  {
-    std::unique_lock lock(buffersMutex_);
-    eventBuffer_.add(entry);
+  // The entries duration is lower than the desired reporting threshold
+  // otherwise.
+  if (duration >= eventBuffer_.durationThreshold) {
+    // TODO(T198982346): Log interaction events to jsinspector_modern
+    observerRegistry_->queuePerformanceEntry(entry);
   }
 
-  // TODO(T198982346): Log interaction events to jsinspector_modern
-  observerRegistry_->queuePerformanceEntry(entry);
+  // All events are queued to be counted, even the ones below the threshold.
+  queuePendingEntry(std::move(entry));
 }
 
 void PerformanceEntryReporter::reportLongTask(
     HighResTimeStamp startTime,
     HighResDuration duration) {
-  const auto entry = PerformanceLongTaskTiming{
+  auto entry = PerformanceEntry{PerformanceLongTaskTiming{
       {.name = std::string{"self"},
        .startTime = startTime,
-       .duration = duration}};
-
-  {
-    std::unique_lock lock(buffersMutex_);
-    longTaskBuffer_.add(entry);
-  }
+       .duration = duration}}};
 
   observerRegistry_->queuePerformanceEntry(entry);
+
+  queuePendingEntry(std::move(entry));
 }
 
 PerformanceResourceTiming PerformanceEntryReporter::reportResourceTiming(
@@ -291,17 +289,54 @@ PerformanceResourceTiming PerformanceEntryReporter::reportResourceTiming(
       responseStatus,
   };
 
-  // Add to buffers & notify observers
-  {
-    std::unique_lock lock(buffersMutex_);
-    resourceTimingBuffer_.add(entry);
-  }
+  // Queue for buffers & notify observers
+  queuePendingEntry(entry);
 
   observerRegistry_->queuePerformanceEntry(entry);
 
   return entry;
 }
 
+std::unordered_map<std::string, uint32_t>
+PerformanceEntryReporter::getEventCounts() const {
+  mergePendingEntries();
+  std::shared_lock lock(buffersMutex_);
+
+  return eventCounts_;
+}
+
+void PerformanceEntryReporter::queuePendingEntry(PerformanceEntry entry) {
+  if (pendingEntries_.push(std::move(entry)) >=
+      PENDING_ENTRIES_MERGE_THRESHOLD) {
+    mergePendingEntries();
+  }
+}
+
+void PerformanceEntryReporter::mergePendingEntries() const {
+  if (pendingEntries_.empty()) {
+    return;
+  }
+
+  // Draining while holding the lock keeps the entries merged by concurrent
+  // calls in order.
+  std::unique_lock lock(buffersMutex_);
+  std::vector<PerformanceEntry> entries;
+  pendingEntries_.drain(entries);
+
+  for (const auto& entry : entries) {
+    if (const auto* eventTiming = std::get_if<PerformanceEventTiming>(&entry)) {
+      eventCounts_[eventTiming->name]++;
+      if (eventTiming->duration >= eventBuffer_.durationThreshold) {
+        eventBuffer_.add(entry);
+      }
+    } else if (std::holds_alternative<PerformanceLongTaskTiming>(entry)) {
+      longTaskBuffer_.add(entry);
+    } else if (std::holds_alternative<PerformanceResourceTiming>(entry)) {
+      resourceTimingBuffer_.add(entry);
+    }
+  }
+}
+
 void PerformanceEntryReporter::traceMark(const PerformanceMark& entry) const {
   auto& performanceTracer =
       jsinspector_modern::tracing::PerformanceTracer::getInstance();
@@ -9,6 +9,7 @@
 
 #include "PerformanceEntryCircularBuffer.h"
 #include "PerformanceEntryKeyedBuffer.h"
+#include "PerformanceEntryShardedQueue.h"
 #include "PerformanceObserverRegistry.h"
 
 #include <jsinspector-modern/tracing/CdpTracing.h>
@@ -30,12 +31,19 @@ constexpr size_t RESOURCE_TIMING_BUFFER_SIZE = 250;
 constexpr HighResDuration LONG_TASK_DURATION_THRESHOLD =
     HighResDuration::fromMilliseconds(50);
 
+// Number of pending entries (events, long tasks and resource timings) reported
+// from a thread after which they are merged into the buffers, even if nothing
+// reads them.
+constexpr size_t PENDING_ENTRIES_MERGE_THRESHOLD = 64;
+
 class PerformanceEntryReporter {
  public:
   PerformanceEntryReporter();
 
-  // NOTE: This class is not thread safe, make sure that the calls are made from
-  // the same thread.
+  // NOTE: Marks and measures must be reported from the same thread (the JS
+  // thread). Events, long tasks and resource timings may be reported from any
+  // thread: they are queued without locking the buffers, and merged into them
+  // when entries are read or enough of them are pending.
   // TODO: Consider passing it as a parameter to the corresponding modules at
   // creation time instead of having the singleton.
   static std::shared_ptr<PerformanceEntryReporter>& getInstance();
@@ -75,11 +83,9 @@ class PerformanceEntryReporter {
 
   static std::vector<PerformanceEntryType> getSupportedEntryTypes();
 
-  uint32_t getDroppedEntriesCount(PerformanceEntryType type) const noexcept;
+  uint32_t getDroppedEntriesCount(PerformanceEntryType type) const;
 
-  const std::unordered_map<std::string, uint32_t>& getEventCounts() const {
-    return eventCounts_;
-  }
+  std::unordered_map<std::string, uint32_t> getEventCounts() const;
 
   std::optional<HighResTimeStamp> getMarkTime(
       const std::string& markName) const;
@@ -119,14 +125,18 @@ class PerformanceEntryReporter {
   std::unique_ptr<PerformanceObserverRegistry> observerRegistry_;
 
   mutable std::shared_mutex buffersMutex_;
-  PerformanceEntryCircularBuffer eventBuffer_{EVENT_BUFFER_SIZE};
-  PerformanceEntryCircularBuffer longTaskBuffer_{LONG_TASK_BUFFER_SIZE};
-  PerformanceEntryCircularBuffer resourceTimingBuffer_{
+  // Pending entries are merged into these buffers (and counted in
+  // `eventCounts_`) by the reading methods too.
+  mutable PerformanceEntryCircularBuffer eventBuffer_{EVENT_BUFFER_SIZE};
+  mutable PerformanceEntryCircularBuffer longTaskBuffer_{LONG_TASK_BUFFER_SIZE};
+  mutable PerformanceEntryCircularBuffer resourceTimingBuffer_{
       RESOURCE_TIMING_BUFFER_SIZE};
   PerformanceEntryKeyedBuffer markBuffer_;
   PerformanceEntryKeyedBuffer measureBuffer_;
 
-  std::unordered_map<std::string, uint32_t> eventCounts_;
+  mutable std::unordered_map<std::string, uint32_t> eventCounts_;
+
+  mutable PerformanceEntryShardedQueue pendingEntries_;
 
   std::function<HighResTimeStamp()> timeStampProvider_ = nullptr;
 
@@ -167,6 +177,14 @@ class PerformanceEntryReporter {
     throw std::logic_error("Unhandled PerformanceEntryType");
   }
 
+  void queuePendingEntry(PerformanceEntry entry);
+
+  /**
+   * Moves the pending entries to their buffers. Must be called without holding
+   * `buffersMutex_`.
+   */
+  void mergePendingEntries() const;
+
   void traceMark(const PerformanceMark& entry) const;
   void traceMeasure(const PerformanceMeasure& entry) const;
 };
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PerformanceEntryShardedQueue.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace facebook::react {
+
+namespace {
+
+std::atomic<size_t> nextThreadIndex{0};
+
+HighResTimeStamp getStartTime(const PerformanceEntry& entry) {
+  return std::visit([](const auto& e) { return e.startTime; }, entry);
+}
+
+} // namespace
+
+PerformanceEntryShardedQueue::PerformanceEntryShardedQueue(size_t shardCount)
+    : shardCount_(std::max<size_t>(shardCount, 1)),
+      shards_(std::make_unique<Shard[]>(shardCount_)) {}
+
+size_t PerformanceEntryShardedQueue::push(PerformanceEntry entry) {
+  auto& shard = getShardForCurrentThread();
+  std::lock_guard lock(shard.mutex);
+  shard.entries.push_back(std::move(entry));
+  auto size = shard.entries.size();
+  shard.size.store(size, std::memory_order_relaxed);
+  return size;
+}
+
+void PerformanceEntryShardedQueue::drain(
+    std::vector<PerformanceEntry>& target) {
+  if (empty()) {
+    return;
+  }
+
+  for (size_t i = 0; i < shardCount_; i++) {
+    auto& shard = shards_[i];
+    std::lock_guard lock(shard.mutex);
+    drainedEntries_.insert(
+        drainedEntries_.end(),
+        std::make_move_iterator(shard.entries.begin()),
+        std::make_move_iterator(shard.entries.end()));
+    shard.entries.clear();
+    shard.size.store(0, std::memory_order_relaxed);
+  }
+
+  target.reserve(target.size() + drainedEntries_.size());
+
+  // Entries are ordered by start time, then by their position in
+  // `drainedEntries_`, which is the order they were pushed in within a shard.
+  // Only the (much smaller) keys are sorted, and only if entries are not
+  // already in order.
+  auto byStartTime = [](const PerformanceEntry& lhs,
+                        const PerformanceEntry& rhs) {
+    return getStartTime(lhs) < getStartTime(rhs);
+  };
+  if (std::is_sorted(
+          drainedEntries_.begin(), drainedEntries_.end(), byStartTime)) {
+    std::move(
+        drainedEntries_.begin(),
+        drainedEntries_.end(),
+        std::back_inserter(target));
+  } else {
+    drainOrder_.clear();
+    for (size_t i = 0; i < drainedEntries_.size(); i++) {
+      drainOrder_.emplace_back(getStartTime(drainedEntries_[i]), i);
+    }
+    std::sort(
+        drainOrder_.begin(),
+        drainOrder_.end(),
+        [](const auto& lhs, const auto& rhs) {
+          if (lhs.first != rhs.first) {
+            return lhs.first < rhs.first;
+          }
+          return lhs.second < rhs.second;
+        });
+    for (auto [startTime, index] : drainOrder_) {
+      target.push_back(std::move(drainedEntries_[index]));
+    }
+  }
+
+  drainedEntries_.clear();
+}
+
+bool PerformanceEntryShardedQueue::empty() const noexcept {
+  for (size_t i = 0; i < shardCount_; i++) {
+    if (shards_[i].size.load(std::memory_order_relaxed) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+PerformanceEntryShardedQueue::Shard&
+PerformanceEntryShardedQueue::getShardForCurrentThread() {
+  // Threads are assigned shards round-robin, in the order they first report
+  // an entry.
+  thread_local size_t threadIndex =
+      nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+  return shards_[threadIndex % shardCount_];
+}
+
+} // namespace facebook::react
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "PerformanceEntry.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+constexpr size_t DEFAULT_SHARD_COUNT = 8;
+
+/**
+ * Entries reported from any thread, waiting to be merged into the buffers of
+ * `PerformanceEntryReporter`.
+ * Threads are spread over several shards, so threads reporting concurrently
+ * rarely wait for each other, and the buffers are locked once per merge instead
+ * of once per entry.
+ */
+class PerformanceEntryShardedQueue {
+ public:
+  explicit PerformanceEntryShardedQueue(
+      size_t shardCount = DEFAULT_SHARD_COUNT);
+
+  /**
+   * Appends the entry to the shard of the current thread and returns the
+   * number of entries queued in that shard.
+   */
+  size_t push(PerformanceEntry entry);
+
+  /**
+   * Moves all queued entries to the end of `target`, ordered by start time.
+   * Entries with the same start time which were pushed from the same thread
+   * stay in the order they were pushed in.
+   */
+  void drain(std::vector<PerformanceEntry>& target);
+
+  bool empty() const noexcept;
+
+ private:
+  // Aligned to a cache line, so threads appending to different shards don't
+  // invalidate each other's caches.
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::vector<PerformanceEntry> entries;
+    // The size of `entries`, readable without locking `mutex`.
+    std::atomic<size_t> size{0};
+  };
+
+  Shard& getShardForCurrentThread();
+
+  size_t shardCount_;
+  std::unique_ptr<Shard[]> shards_;
+
+  // Reused by `drain`, which must not be called concurrently.
+  std::vector<PerformanceEntry> drainedEntries_;
+  std::vector<std::pair<HighResTimeStamp, size_t>> drainOrder_;
+};
+
+} // namespace facebook::react
@@ -66,7 +66,7 @@ void PerformanceObserver::observe(
   registry_.addObserver(shared_from_this());
 }
 
-uint32_t PerformanceObserver::getDroppedEntriesCount() noexcept {
+uint32_t PerformanceObserver::getDroppedEntriesCount() {
   uint32_t droppedEntriesCount = 0;
 
   if (requiresDroppedEntries_) {
@@ -117,7 +117,7 @@ class PerformanceObserver
    * Internal function called by JS bridge to get number of dropped entries
    * count counted at call time.
    */
-  uint32_t getDroppedEntriesCount() noexcept;
+  uint32_t getDroppedEntriesCount();
 
  private:
   void scheduleFlushBuffer();
@@ -11,6 +11,7 @@
 
 #include "../PerformanceEntryReporter.h"
 
+#include <thread>
 #include <variant>
 
 using namespace facebook::react;
@@ -382,3 +383,44 @@ TEST(PerformanceEntryReporter, PerformanceEntryReporterTestClearMarks) {
     ASSERT_EQ(entries.size(), 0);
   }
 }
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestConcurrentReports) {
+  auto reporter = std::make_shared<PerformanceEntryReporter>();
+  auto timeOrigin = HighResTimeStamp::now();
+
+  // Events and long tasks are reported from several threads.
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < 4; i++) {
+    threads.emplace_back([&reporter, timeOrigin, i]() {
+      for (int j = 0; j < 100; j++) {
+        auto startTime = timeOrigin + HighResDuration::fromMilliseconds(j);
+        reporter->reportEvent(
+            "click",
+            startTime,
+            HighResDuration::fromMilliseconds(1),
+            startTime,
+            startTime,
+            i);
+        reporter->reportLongTask(
+            startTime, HighResDuration::fromMilliseconds(60));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(400, reporter->getEventCounts().at("click"));
+  ASSERT_EQ(
+      EVENT_BUFFER_SIZE,
+      reporter->getEntries(PerformanceEntryType::EVENT).size());
+  ASSERT_EQ(
+      400 - EVENT_BUFFER_SIZE,
+      reporter->getDroppedEntriesCount(PerformanceEntryType::EVENT));
+  ASSERT_EQ(
+      LONG_TASK_BUFFER_SIZE,
+      reporter->getEntries(PerformanceEntryType::LONGTASK).size());
+
+  reporter->clearEntries();
+  ASSERT_EQ(0, reporter->getEntries().size());
+}
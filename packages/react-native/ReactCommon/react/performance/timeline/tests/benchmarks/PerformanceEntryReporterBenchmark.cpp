@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/performance/timeline/PerformanceEntryReporter.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * The reporter shared by all threads of a benchmark, as the singleton is.
+ */
+PerformanceEntryReporter& getReporter() {
+  static auto reporter = std::make_shared<PerformanceEntryReporter>();
+  return *reporter;
+}
+
+} // namespace
+
+/*
+ * The overhead of reporting an event, as `EventPerformanceLogger` does from
+ * the threads that dispatch and mount events.
+ */
+static void reportEvents(benchmark::State& state) {
+  auto& reporter = getReporter();
+  auto startTime = HighResTimeStamp::now();
+  for (auto _ : state) {
+    reporter.reportEvent(
+        "click",
+        startTime,
+        HighResDuration::fromMilliseconds(16),
+        startTime,
+        startTime,
+        0);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportEvents)->Threads(1)->Threads(4);
+
+static void reportLongTasks(benchmark::State& state) {
+  auto& reporter = getReporter();
+  auto startTime = HighResTimeStamp::now();
+  for (auto _ : state) {
+    reporter.reportLongTask(startTime, HighResDuration::fromMilliseconds(60));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(reportLongTasks)->Threads(1)->Threads(4);
+
+/*
+ * Reporting events and reading them back (which merges the pending ones), as
+ * `PerformanceObserver`s with buffered entries do.
+ */
+static void reportAndGetEvents(benchmark::State& state) {
+  auto& reporter = getReporter();
+  auto startTime = HighResTimeStamp::now();
+  auto entries = std::vector<PerformanceEntry>{};
+  for (auto _ : state) {
+    for (int i = 0; i < state.range(0); i++) {
+      reporter.reportEvent(
+          "click",
+          startTime,
+          HighResDuration::fromMilliseconds(16),
+          startTime,
+          startTime,
+          0);
+    }
+    entries.clear();
+    reporter.getEntries(entries, PerformanceEntryType::EVENT);
+    benchmark::DoNotOptimize(entries.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(reportAndGetEvents)->Arg(10)->Arg(100);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
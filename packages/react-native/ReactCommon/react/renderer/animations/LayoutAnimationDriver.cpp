@@ -26,31 +26,48 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       continue;
     }
 
+    // The progress of a keyframe only depends on its type, so it's computed
+    // once per type for all of the keyframes of the animation.
+    // The contract with the "keyframes generation" phase is that any animated
+    // node will have a valid configuration.
+    const auto& layoutAnimationConfig = animation.layoutAnimationConfig;
+    const auto createProgress = calculateAnimationProgress(
+        now, animation, layoutAnimationConfig.createConfig);
+    const auto updateProgress = calculateAnimationProgress(
+        now, animation, layoutAnimationConfig.updateConfig);
+    const auto deleteProgress = calculateAnimationProgress(
+        now, animation, layoutAnimationConfig.deleteConfig);
+
     int incompleteAnimations = 0;
     for (auto& keyframe : animation.keyFrames) {
       if (keyframe.invalidated) {
         continue;
       }
 
-      const auto& baselineShadowView = keyframe.viewStart;
-      const auto& finalShadowView = keyframe.viewEnd;
-
-      // The contract with the "keyframes generation" phase is that any animated
-      // node will have a valid configuration.
-      const auto layoutAnimationConfig = animation.layoutAnimationConfig;
-      const auto& mutationConfig =
+      const auto& progress =
           (keyframe.type == AnimationConfigurationType::Delete
-               ? layoutAnimationConfig.deleteConfig
+               ? deleteProgress
                : (keyframe.type == AnimationConfigurationType::Create
-                      ? layoutAnimationConfig.createConfig
-                      : layoutAnimationConfig.updateConfig));
-
-      // Interpolate
-      auto progress =
-          calculateAnimationProgress(now, animation, mutationConfig);
+                      ? createProgress
+                      : updateProgress));
       auto animationTimeProgressLinear = progress.first;
       auto animationInterpolationFactor = progress.second;
 
+      if (animationTimeProgressLinear < 1) {
+        incompleteAnimations++;
+      }
+
+      // The view is already in the state of this frame, e.g. while the
+      // animation is delayed. Don't interpolate (and clone) its props again.
+      if (keyframe.viewPrevInterpolationFactor ==
+          animationInterpolationFactor) {
+        continue;
+      }
+
+      const auto& baselineShadowView = keyframe.viewStart;
+      const auto& finalShadowView = keyframe.viewEnd;
+
+      // Interpolate
       auto mutatedShadowView = createInterpolatedShadowView(
           animationInterpolationFactor, baselineShadowView, finalShadowView);
 
@@ -61,10 +78,7 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       PrintMutationInstruction("Animation Progress:", mutationsList.back());
 
       keyframe.viewPrev = std::move(mutatedShadowView);
-
-      if (animationTimeProgressLinear < 1) {
-        incompleteAnimations++;
-      }
+      keyframe.viewPrevInterpolationFactor = animationInterpolationFactor;
     }
 
     // Are there no ongoing mutations left in this animation?
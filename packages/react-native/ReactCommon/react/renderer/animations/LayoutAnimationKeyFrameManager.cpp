@@ -391,6 +391,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
                 if (keyframe.type == AnimationConfigurationType::Update &&
                     mutation.newChildShadowView.tag > 0) {
                   keyframe.viewPrev = mutation.newChildShadowView;
+                  keyframe.viewPrevInterpolationFactor.reset();
                   keyframe.parentTag = mutation.parentTag;
                   react_native_assert(
                       keyframe.finalMutationsForKeyFrame.size() == 1);
@@ -667,6 +668,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
               // from this point.
               keyFrame.viewPrev = conflictingKeyFrame.viewPrev;
               keyFrame.viewStart = conflictingKeyFrame.viewPrev;
+              keyFrame.viewPrevInterpolationFactor.reset();
               react_native_assert(keyFrame.viewStart.tag > 0);
               keyFrame.initialProgress = 0;
 
@@ -749,6 +751,7 @@ LayoutAnimationKeyFrameManager::pullTransaction(
               // The animation will continue from the current position - we
               // restart viewStart to make sure there are no sudden jumps
               keyFrame.viewStart = keyFrame.viewPrev;
+              keyFrame.viewPrevInterpolationFactor.reset();
 
               // Find the insert mutation that conflicted with this update
               for (auto& mutation : immediateMutations) {
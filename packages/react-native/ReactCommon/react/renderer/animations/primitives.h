@@ -12,6 +12,7 @@
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/mounting/ShadowView.h>
 #include <react/renderer/mounting/ShadowViewMutation.h>
+#include <optional>
 #include <vector>
 
 namespace facebook::react {
@@ -83,6 +84,11 @@ struct AnimationKeyFrame {
   // be halfway through the intended transition.
   double initialProgress;
 
+  // The interpolation factor that `viewPrev` was interpolated with, if it was
+  // interpolated from `viewStart` and `viewEnd`. Must be reset when any of the
+  // views are replaced.
+  std::optional<Float> viewPrevInterpolationFactor{};
+
   bool invalidated{false};
 
   // In the case where some mutation conflicts with this keyframe,
@@ -45,7 +45,8 @@ static void testShadowNodeTreeLifeCycleLayoutAnimations(
     int delay_ms_between_stages,
     int delay_ms_between_repeats,
     bool commits_conflicting_mutations = false,
-    int final_animation_delay = 0) {
+    int final_animation_delay = 0,
+    int animation_delay = 0) {
   auto entropy = seed == 0 ? Entropy() : Entropy(seed);
 
   auto eventDispatcher = EventDispatcher::Shared{};
@@ -175,19 +176,19 @@ static void testShadowNodeTreeLifeCycleLayoutAnimations(
             {/* Create */ AnimationType::EaseInEaseOut,
              AnimationProperty::Opacity,
              (double)animation_duration,
-             0,
+             (double)animation_delay,
              0,
              0},
             {/* Update */ AnimationType::EaseInEaseOut,
              AnimationProperty::ScaleXY,
              (double)animation_duration,
-             0,
+             (double)animation_delay,
              0,
              0},
             {/* Delete */ AnimationType::EaseInEaseOut,
              AnimationProperty::Opacity,
              (double)animation_duration,
-             0,
+             (double)animation_delay,
              0,
              0}},
            {},
@@ -411,6 +412,25 @@ TEST(LayoutAnimationTest, stableBiggerTreeFewRepeatsManyStages_NonOverlapping) {
       /* delay_ms_between_repeats */ 2000);
 }
 
+// Frames computed while the animations are delayed don't change any views.
+TEST(
+    LayoutAnimationTest,
+    stableSmallerTreeFewRepeatsFewStages_Delayed_2029343357) {
+  testShadowNodeTreeLifeCycleLayoutAnimations(
+      /* seed */ 2029343357,
+      /* size */ 128,
+      /* repeats */ 32,
+      /* stages */ 10,
+      /* animation_duration */ 1000,
+      /* animation_frames*/ 15,
+      /* delay_ms_between_frames */ 100,
+      /* delay_ms_between_stages */ 100,
+      /* delay_ms_between_repeats */ 2000,
+      /* commits_conflicting_mutations */ false,
+      /* final_animation_delay */ 0,
+      /* animation_delay */ 500);
+}
+
 // You may uncomment this - locally only! - to generate failing seeds.
 // TEST(LayoutAnimationTest, stableSmallerTreeFewRepeatsFewStages_Random) {
 //   std::random_device device;
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <ReactCommon/RuntimeExecutor.h>
+#include <react/renderer/animations/LayoutAnimationDriver.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+#include <memory>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr SurfaceId kSurfaceId = 1;
+constexpr Tag kRootTag = 1;
+
+// Long enough for the animation to never complete while being measured.
+constexpr double kAnimationDuration = 1e9;
+
+ShadowView makeShadowView(Tag tag, Float y) {
+  auto shadowView = ShadowView{};
+  shadowView.componentName = ViewShadowNode::Name();
+  shadowView.componentHandle = ViewShadowNode::Handle();
+  shadowView.surfaceId = kSurfaceId;
+  shadowView.tag = tag;
+  shadowView.props = std::make_shared<const ViewShadowNodeProps>();
+  shadowView.eventEmitter =
+      std::make_shared<const EventEmitter>(nullptr, EventDispatcher::Weak{});
+  shadowView.layoutMetrics.frame = {{0, y}, {100, 10}};
+  return shadowView;
+}
+
+/*
+ * `viewCount` views moving down in a layout animation, as when an item is
+ * inserted at the top of a list.
+ */
+class AnimatedViews {
+ public:
+  AnimatedViews(int viewCount, double delay) {
+    auto componentDescriptorParameters = ComponentDescriptorParameters{
+        EventDispatcher::Shared{}, contextContainer_, nullptr};
+    auto providerRegistry =
+        std::make_shared<ComponentDescriptorProviderRegistry>();
+    auto componentDescriptorRegistry =
+        providerRegistry->createComponentDescriptorRegistry(
+            componentDescriptorParameters);
+    providerRegistry->add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+    animationDriver_ = std::make_unique<LayoutAnimationDriver>(
+        [](const std::function<void(jsi::Runtime&)>& /*unused*/) {},
+        contextContainer_,
+        nullptr);
+    animationDriver_->setComponentDescriptorRegistry(
+        componentDescriptorRegistry);
+    animationDriver_->setClockNow([this]() { return now_; });
+
+    auto initialMutations = ShadowViewMutationList{};
+    auto updateMutations = ShadowViewMutationList{};
+    for (int i = 0; i < viewCount; i++) {
+      auto oldShadowView = makeShadowView(i + 2, static_cast<Float>(i * 10));
+      auto newShadowView =
+          makeShadowView(i + 2, static_cast<Float>(i * 10 + 10));
+      initialMutations.push_back(
+          ShadowViewMutation::CreateMutation(oldShadowView));
+      initialMutations.push_back(
+          ShadowViewMutation::InsertMutation(kRootTag, oldShadowView, i));
+      updateMutations.push_back(ShadowViewMutation::UpdateMutation(
+          oldShadowView, newShadowView, kRootTag));
+    }
+    pullTransaction(std::move(initialMutations));
+
+    auto updateConfig = AnimationConfig{
+        AnimationType::EaseInEaseOut,
+        AnimationProperty::NotApplicable,
+        kAnimationDuration,
+        delay,
+        0,
+        0};
+    animationDriver_->uiManagerDidConfigureNextLayoutAnimation(
+        {kSurfaceId,
+         0,
+         false,
+         {kAnimationDuration, {}, updateConfig, {}},
+         {},
+         {},
+         {}});
+    pullTransaction(std::move(updateMutations));
+  }
+
+  /*
+   * Computes the next frame of the animation and returns the number of
+   * mutations it produced.
+   */
+  size_t pullFrame() {
+    now_ += 16;
+    return pullTransaction({});
+  }
+
+ private:
+  size_t pullTransaction(ShadowViewMutationList mutations) {
+    auto transaction = animationDriver_->pullTransaction(
+        kSurfaceId, transactionNumber_++, {}, std::move(mutations));
+    return transaction ? transaction->getMutations().size() : 0;
+  }
+
+  ContextContainer::Shared contextContainer_ =
+      std::make_shared<const ContextContainer>();
+  std::unique_ptr<LayoutAnimationDriver> animationDriver_;
+  uint64_t now_{0};
+  MountingTransaction::Number transactionNumber_{0};
+};
+
+} // namespace
+
+/*
+ * The cost of a frame of a layout animation of a given number of views. When
+ * the animation is delayed, none of the views change until it starts.
+ */
+static void layoutAnimationFrame(benchmark::State& state) {
+  auto delay = state.range(1) != 0 ? kAnimationDuration : 0;
+  auto animatedViews = AnimatedViews(state.range(0), delay);
+  size_t mutationCount = 0;
+  for (auto _ : state) {
+    mutationCount += animatedViews.pullFrame();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["mutations"] = benchmark::Counter(
+      mutationCount, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(layoutAnimationFrame)
+    ->ArgNames({"views", "delayed"})
+    ->ArgsProduct({{10, 100, 1000}, {0, 1}});
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -26,7 +26,7 @@ std::string Fragment::AttachmentCharacter() {
 }
 
 bool Fragment::isAttachment() const {
-  return string == AttachmentCharacter();
+  return *string == AttachmentCharacter();
 }
 
 bool Fragment::operator==(const Fragment& rhs) const {
@@ -51,14 +51,14 @@ bool Fragment::isContentEqual(const Fragment& rhs) const {
 
 void AttributedString::appendFragment(Fragment&& fragment) {
   ensureUnsealed();
-  if (!fragment.string.empty()) {
+  if (!fragment.string->empty()) {
     fragments_.push_back(std::move(fragment));
   }
 }
 
 void AttributedString::prependFragment(Fragment&& fragment) {
   ensureUnsealed();
-  if (!fragment.string.empty()) {
+  if (!fragment.string->empty()) {
     fragments_.insert(fragments_.begin(), std::move(fragment));
   }
 }
@@ -79,7 +79,7 @@ Fragments& AttributedString::getFragments() {
 std::string AttributedString::getString() const {
   auto string = std::string{};
   for (const auto& fragment : fragments_) {
-    string += fragment.string;
+    string += *fragment.string;
   }
   return string;
 }
@@ -135,11 +135,11 @@ SharedDebugStringConvertibleList AttributedString::getDebugChildren() const {
 
   for (auto&& fragment : fragments_) {
     auto propsList =
-        fragment.textAttributes.DebugStringConvertible::getDebugProps();
+        fragment.textAttributes->DebugStringConvertible::getDebugProps();
 
     list.push_back(std::make_shared<DebugStringConvertibleItem>(
         "Fragment",
-        fragment.string,
+        *fragment.string,
         SharedDebugStringConvertibleList(),
         propsList));
   }
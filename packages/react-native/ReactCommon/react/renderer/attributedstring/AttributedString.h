@@ -12,6 +12,7 @@
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/mounting/ShadowView.h>
+#include <react/utils/Interned.h>
 #include <react/utils/hash_combine.h>
 
 namespace facebook::react {
@@ -21,6 +22,9 @@ namespace facebook::react {
  * (aka spanned string).
  * `AttributedString` is basically a list of `Fragments` which have `string` and
  * `textAttributes` + `shadowNode` associated with the `string`.
+ * Strings and text attributes of fragments are interned, so copying an
+ * `AttributedString` doesn't copy them, and they are hashed and compared in
+ * constant time.
  */
 class AttributedString : public Sealable, public DebugStringConvertible {
  public:
@@ -28,8 +32,8 @@ class AttributedString : public Sealable, public DebugStringConvertible {
    public:
     static std::string AttachmentCharacter();
 
-    std::string string;
-    TextAttributes textAttributes;
+    Interned<std::string> string;
+    Interned<TextAttributes> textAttributes;
     ShadowView parentShadowView;
 
     /*
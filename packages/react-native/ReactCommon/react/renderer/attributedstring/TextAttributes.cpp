@@ -174,6 +174,75 @@ bool TextAttributes::operator==(const TextAttributes& rhs) const {
       floatEquality(textShadowRadius, rhs.textShadowRadius);
 }
 
+namespace {
+
+// Unlike `==`, unset (NaN) values are identical to each other.
+bool floatIdentical(Float lhs, Float rhs) {
+  return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+}
+
+} // namespace
+
+bool InternedEqual<TextAttributes>::operator()(
+    const TextAttributes& lhs,
+    const TextAttributes& rhs) const {
+  return std::tie(
+             lhs.foregroundColor,
+             lhs.backgroundColor,
+             lhs.fontFamily,
+             lhs.fontWeight,
+             lhs.fontStyle,
+             lhs.fontVariant,
+             lhs.allowFontScaling,
+             lhs.dynamicTypeRamp,
+             lhs.textTransform,
+             lhs.alignment,
+             lhs.baseWritingDirection,
+             lhs.lineBreakStrategy,
+             lhs.lineBreakMode,
+             lhs.textDecorationColor,
+             lhs.textDecorationLineType,
+             lhs.textDecorationStyle,
+             lhs.textShadowOffset,
+             lhs.textShadowColor,
+             lhs.isHighlighted,
+             lhs.isPressable,
+             lhs.layoutDirection,
+             lhs.accessibilityRole,
+             lhs.role) ==
+      std::tie(
+             rhs.foregroundColor,
+             rhs.backgroundColor,
+             rhs.fontFamily,
+             rhs.fontWeight,
+             rhs.fontStyle,
+             rhs.fontVariant,
+             rhs.allowFontScaling,
+             rhs.dynamicTypeRamp,
+             rhs.textTransform,
+             rhs.alignment,
+             rhs.baseWritingDirection,
+             rhs.lineBreakStrategy,
+             rhs.lineBreakMode,
+             rhs.textDecorationColor,
+             rhs.textDecorationLineType,
+             rhs.textDecorationStyle,
+             rhs.textShadowOffset,
+             rhs.textShadowColor,
+             rhs.isHighlighted,
+             rhs.isPressable,
+             rhs.layoutDirection,
+             rhs.accessibilityRole,
+             rhs.role) &&
+      floatIdentical(lhs.opacity, rhs.opacity) &&
+      floatIdentical(lhs.fontSize, rhs.fontSize) &&
+      floatIdentical(lhs.fontSizeMultiplier, rhs.fontSizeMultiplier) &&
+      floatIdentical(lhs.maxFontSizeMultiplier, rhs.maxFontSizeMultiplier) &&
+      floatIdentical(lhs.letterSpacing, rhs.letterSpacing) &&
+      floatIdentical(lhs.lineHeight, rhs.lineHeight) &&
+      floatIdentical(lhs.textShadowRadius, rhs.textShadowRadius);
+}
+
 TextAttributes TextAttributes::defaultTextAttributes() {
   static auto textAttributes = [] {
     auto textAttributes = TextAttributes{};
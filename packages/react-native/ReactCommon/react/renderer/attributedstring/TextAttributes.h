@@ -19,6 +19,7 @@
 #include <react/renderer/graphics/Color.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Size.h>
+#include <react/utils/Interned.h>
 #include <react/utils/hash_combine.h>
 
 namespace facebook::react {
@@ -101,6 +102,15 @@ class TextAttributes : public DebugStringConvertible {
 #endif
 };
 
+/*
+ * `TextAttributes::operator==` ignores `lineBreakMode` and compares floats
+ * with a tolerance, so interned attributes are compared field by field.
+ */
+template <>
+struct InternedEqual<TextAttributes> {
+  bool operator()(const TextAttributes& lhs, const TextAttributes& rhs) const;
+};
+
 } // namespace facebook::react
 
 namespace std {
@@ -1237,7 +1237,7 @@ inline MapBuffer toMapBuffer(const TextAttributes& textAttributes) {
 inline MapBuffer toMapBuffer(const AttributedString::Fragment& fragment) {
   auto builder = MapBufferBuilder();
 
-  builder.putString(FR_KEY_STRING, fragment.string);
+  builder.putString(FR_KEY_STRING, *fragment.string);
   if (fragment.parentShadowView.componentHandle) {
     builder.putInt(FR_KEY_REACT_TAG, fragment.parentShadowView.tag);
   }
@@ -1249,7 +1249,7 @@ inline MapBuffer toMapBuffer(const AttributedString::Fragment& fragment) {
         FR_KEY_HEIGHT,
         fragment.parentShadowView.layoutMetrics.frame.size.height);
   }
-  auto textAttributesMap = toMapBuffer(fragment.textAttributes);
+  auto textAttributesMap = toMapBuffer(*fragment.textAttributes);
   builder.putMapBuffer(FR_KEY_TEXT_ATTRIBUTES, textAttributesMap);
 
   return builder.build();
@@ -1259,7 +1259,7 @@ inline MapBuffer toMapBuffer(const AttributedString& attributedString) {
   auto fragmentsBuilder = MapBufferBuilder();
 
   int index = 0;
-  for (auto fragment : attributedString.getFragments()) {
+  for (const auto& fragment : attributedString.getFragments()) {
     fragmentsBuilder.putMapBuffer(index++, toMapBuffer(fragment));
   }
 
@@ -13,6 +13,9 @@
 #include <react/renderer/components/text/TextShadowNode.h>
 #include <react/renderer/mounting/ShadowView.h>
 
+#include <optional>
+#include <string>
+
 namespace facebook::react {
 
 inline ShadowView shadowViewFromShadowNode(const ShadowNode& shadowNode) {
@@ -29,32 +32,41 @@ void BaseTextShadowNode::buildAttributedString(
     const ShadowNode& parentNode,
     AttributedString& outAttributedString,
     Attachments& outAttachments) {
-  bool lastFragmentWasRawText = false;
+  // Consecutive raw texts are merged into a single fragment, whose string is
+  // only interned once all of them were concatenated.
+  std::optional<std::string> pendingRawText;
+  auto appendPendingRawText = [&]() {
+    if (!pendingRawText) {
+      return;
+    }
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = std::move(*pendingRawText);
+    fragment.textAttributes = baseTextAttributes;
+
+    // Storing a retaining pointer to `ParagraphShadowNode` inside
+    // `attributedString` causes a retain cycle (besides that fact that we
+    // don't need it at all). Storing a `ShadowView` instance instead of
+    // `ShadowNode` should properly fix this problem.
+    fragment.parentShadowView = shadowViewFromShadowNode(parentNode);
+    outAttributedString.appendFragment(std::move(fragment));
+    pendingRawText.reset();
+  };
+
   for (const auto& childNode : parentNode.getChildren()) {
     // RawShadowNode
     auto rawTextShadowNode =
         dynamic_cast<const RawTextShadowNode*>(childNode.get());
     if (rawTextShadowNode != nullptr) {
       const auto& rawText = rawTextShadowNode->getConcreteProps().text;
-      if (lastFragmentWasRawText) {
-        outAttributedString.getFragments().back().string += rawText;
+      if (pendingRawText) {
+        *pendingRawText += rawText;
       } else {
-        auto fragment = AttributedString::Fragment{};
-        fragment.string = rawText;
-        fragment.textAttributes = baseTextAttributes;
-
-        // Storing a retaining pointer to `ParagraphShadowNode` inside
-        // `attributedString` causes a retain cycle (besides that fact that we
-        // don't need it at all). Storing a `ShadowView` instance instead of
-        // `ShadowNode` should properly fix this problem.
-        fragment.parentShadowView = shadowViewFromShadowNode(parentNode);
-        outAttributedString.appendFragment(std::move(fragment));
-        lastFragmentWasRawText = true;
+        pendingRawText = rawText;
       }
       continue;
     }
 
-    lastFragmentWasRawText = false;
+    appendPendingRawText();
 
     // TextShadowNode
     auto textShadowNode = dynamic_cast<const TextShadowNode*>(childNode.get());
@@ -79,6 +91,8 @@ void BaseTextShadowNode::buildAttributedString(
     outAttachments.push_back(Attachment{
         childNode.get(), outAttributedString.getFragments().size() - 1});
   }
+
+  appendPendingRawText();
 }
 
 } // namespace facebook::react
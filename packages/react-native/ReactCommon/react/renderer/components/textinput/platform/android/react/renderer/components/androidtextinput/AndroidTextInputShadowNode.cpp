@@ -180,13 +180,13 @@ AttributedString AndroidTextInputShadowNode::getAttributedString(
     auto textAttributes = TextAttributes::defaultTextAttributes();
     textAttributes.apply(getConcreteProps().textAttributes);
     textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
-    auto fragment = AttributedString::Fragment{};
-    fragment.string = getConcreteProps().text;
-    fragment.textAttributes = textAttributes;
     // If the TextInput opacity is 0 < n < 1, the opacity of the TextInput and
     // text value's background will stack. This is a hack/workaround to prevent
     // that effect.
-    fragment.textAttributes.backgroundColor = clearColor();
+    textAttributes.backgroundColor = clearColor();
+    auto fragment = AttributedString::Fragment{};
+    fragment.string = getConcreteProps().text;
+    fragment.textAttributes = textAttributes;
     fragment.parentShadowView = ShadowView(*this);
     attributedString.prependFragment(std::move(fragment));
   }
@@ -36,11 +36,14 @@ static inline void interpolateViewProps(
 
   interpolatedProps->opacity = oldViewProps->opacity +
       (newViewProps->opacity - oldViewProps->opacity) * animationProgress;
-  interpolatedProps->transform = Transform::Interpolate(
+  // The interpolated props are a clone of the new ones, so the storage of
+  // their transform operations is reused.
+  Transform::Interpolate(
       animationProgress,
       oldViewProps->transform,
       newViewProps->transform,
-      size);
+      size,
+      interpolatedProps->transform);
 
   // Android uses RawProps, not props, to update props on the platform...
   // Since interpolated props don't interpolate at all using RawProps, we need
@@ -12,6 +12,8 @@
 #include <react/renderer/graphics/Rect.h>
 #include <react/renderer/graphics/Size.h>
 #include <cmath>
+#include <optional>
+#include <unordered_map>
 
 namespace facebook::react::dom {
 
@@ -154,6 +156,166 @@ Rect getScrollableContentBounds(
   return Rect{Point{minX, minY}, Size{maxX - minX, maxY - minY}};
 }
 
+bool isTranslation(const Transform& transform) {
+  const auto& matrix = transform.matrix;
+  for (size_t i = 0; i < 12; i++) {
+    if (matrix[i] != ((i % 5 == 0) ? 1 : 0)) {
+      return false;
+    }
+  }
+  return matrix[15] == 1;
+}
+
+/*
+ * Computes frames relative to the root of a revision for many nodes, sharing
+ * the work done for their common ancestors. For every ancestor it caches the
+ * translation from its content coordinate space to the root, which is valid
+ * as long as all the transforms applied along the way are translations.
+ * Otherwise (e.g. a rotated or scaled ancestor), it falls back to
+ * `LayoutableShadowNode::computeRelativeLayoutMetrics`, which applies the
+ * transforms one node at a time.
+ */
+class LayoutBatchResolver {
+ public:
+  LayoutBatchResolver(
+      const RootShadowNode& rootShadowNode,
+      LayoutableShadowNode::LayoutInspectingPolicy policy)
+      : rootShadowNode_(rootShadowNode), policy_(policy) {}
+
+  /*
+   * Returns the frame relative to the root of the node at `depth` in the
+   * given ancestor list (where `ancestors.size()` refers to the node the list
+   * was computed for), or an empty optional if it isn't displayed.
+   */
+  std::optional<Rect> getFrameFromRoot(
+      const ShadowNodeFamily::AncestorList& ancestors,
+      size_t depth) {
+    if (depth == 0) {
+      auto layoutMetrics = rootShadowNode_.getLayoutMetrics();
+      if (layoutMetrics.displayType == DisplayType::None) {
+        return std::nullopt;
+      }
+      // Like in `computeRelativeLayoutMetrics`, the origin of the root is
+      // irrelevant, and the frames of its descendants don't include it.
+      auto frame = layoutMetrics.frame;
+      frame.origin = {0, 0};
+      return policy_.includeTransform ? frame * rootShadowNode_.getTransform()
+                                      : frame;
+    }
+
+    const auto& parentOffset = getAncestorOffset(ancestors, depth - 1);
+    if (!parentOffset.isDisplayed) {
+      return std::nullopt;
+    }
+
+    if (!parentOffset.isTranslation) {
+      auto layoutMetrics = LayoutableShadowNode::computeRelativeLayoutMetrics(
+          ShadowNodeFamily::AncestorList{
+              ancestors.begin(),
+              ancestors.begin() + static_cast<std::ptrdiff_t>(depth)},
+          policy_);
+      if (layoutMetrics == EmptyLayoutMetrics) {
+        return std::nullopt;
+      }
+      return layoutMetrics.frame;
+    }
+
+    const auto& pair = ancestors.at(depth - 1);
+    auto layoutableShadowNode = dynamic_cast<const LayoutableShadowNode*>(
+        pair.first.get().getChildren().at(pair.second).get());
+    if (layoutableShadowNode == nullptr) {
+      return std::nullopt;
+    }
+
+    const auto& layoutMetrics = layoutableShadowNode->getLayoutMetrics();
+    if (layoutMetrics.displayType == DisplayType::None) {
+      return std::nullopt;
+    }
+
+    auto frame = layoutMetrics.frame;
+    if (shouldApplyTransform(*layoutableShadowNode)) {
+      frame = layoutableShadowNode->getTransform().applyWithCenter(
+          frame, layoutMetrics.frame.getCenter());
+    }
+    frame.origin += parentOffset.offset;
+    return frame;
+  }
+
+ private:
+  struct AncestorOffset {
+    // Whether the ancestor and all its ancestors are displayed.
+    bool isDisplayed{true};
+    // Whether all the transforms applied from the ancestor to the root are
+    // translations (so `offset` can be used).
+    bool isTranslation{true};
+    // Translation from the content coordinate space of the ancestor to the
+    // coordinate space of the root.
+    Point offset{};
+  };
+
+  bool shouldApplyTransform(
+      const LayoutableShadowNode& layoutableShadowNode) const {
+    auto isRootNode = layoutableShadowNode.getTraits().check(
+        ShadowNodeTraits::Trait::RootNodeKind);
+    return (policy_.includeTransform && !isRootNode) ||
+        (policy_.includeViewportOffset && isRootNode);
+  }
+
+  const AncestorOffset& getAncestorOffset(
+      const ShadowNodeFamily::AncestorList& ancestors,
+      size_t depth) {
+    const auto& shadowNode = ancestors.at(depth).first.get();
+
+    auto it = cache_.find(&shadowNode);
+    if (it != cache_.end()) {
+      return it->second;
+    }
+
+    auto ancestorOffset = AncestorOffset{};
+    auto layoutableShadowNode =
+        dynamic_cast<const LayoutableShadowNode*>(&shadowNode);
+
+    if (layoutableShadowNode == nullptr ||
+        layoutableShadowNode->getLayoutMetrics().displayType ==
+            DisplayType::None) {
+      ancestorOffset.isDisplayed = false;
+    } else {
+      // Like in `computeRelativeLayoutMetrics`, the chain of ancestors ends at
+      // the closest node with the `RootNodeKind` trait, whose origin is
+      // irrelevant.
+      auto isEndOfChain = depth == 0 ||
+          shadowNode.getTraits().check(ShadowNodeTraits::Trait::RootNodeKind);
+
+      if (!isEndOfChain) {
+        ancestorOffset = getAncestorOffset(ancestors, depth - 1);
+        ancestorOffset.offset +=
+            layoutableShadowNode->getLayoutMetrics().frame.origin;
+      }
+
+      if (shouldApplyTransform(*layoutableShadowNode)) {
+        auto transform = layoutableShadowNode->getTransform();
+        if (isTranslation(transform)) {
+          ancestorOffset.offset +=
+              Point{transform.matrix[12], transform.matrix[13]};
+        } else {
+          ancestorOffset.isTranslation = false;
+        }
+      }
+
+      if (policy_.includeTransform) {
+        ancestorOffset.offset +=
+            layoutableShadowNode->getContentOriginOffset(true);
+      }
+    }
+
+    return cache_.emplace(&shadowNode, ancestorOffset).first->second;
+  }
+
+  const RootShadowNode& rootShadowNode_;
+  LayoutableShadowNode::LayoutInspectingPolicy policy_;
+  std::unordered_map<const ShadowNode*, AncestorOffset> cache_;
+};
+
 } // namespace
 
 std::shared_ptr<const ShadowNode> getParentNode(
@@ -470,6 +632,149 @@ std::string getTagName(const ShadowNode& shadowNode) {
   return canonicalComponentName;
 }
 
+size_t getLayoutQueryStride(DOMLayoutQuery query) {
+  switch (query) {
+    case DOMLayoutQuery::BoundingClientRect:
+    case DOMLayoutQuery::BoundingClientRectWithoutTransform:
+      return 4;
+    case DOMLayoutQuery::ScrollPosition:
+    case DOMLayoutQuery::Offset:
+      return 2;
+  }
+  return 0;
+}
+
+std::vector<double> getLayoutBatch(
+    const RootShadowNode::Shared& currentRevision,
+    const std::vector<std::shared_ptr<const ShadowNode>>& shadowNodes,
+    DOMLayoutQuery query) {
+  auto stride = getLayoutQueryStride(query);
+  auto result = std::vector<double>(shadowNodes.size() * stride, 0);
+
+  auto policy = LayoutableShadowNode::LayoutInspectingPolicy{};
+  switch (query) {
+    case DOMLayoutQuery::BoundingClientRect:
+      policy = {.includeTransform = true, .includeViewportOffset = true};
+      break;
+    case DOMLayoutQuery::BoundingClientRectWithoutTransform:
+      policy = {.includeTransform = false, .includeViewportOffset = true};
+      break;
+    case DOMLayoutQuery::ScrollPosition:
+      policy = {.includeTransform = true};
+      break;
+    case DOMLayoutQuery::Offset:
+      policy = {.includeTransform = false};
+      break;
+  }
+
+  auto resolver = LayoutBatchResolver{*currentRevision, policy};
+
+  for (size_t i = 0; i < shadowNodes.size(); i++) {
+    const auto& shadowNode = shadowNodes[i];
+    if (shadowNode == nullptr) {
+      continue;
+    }
+
+    auto values = result.data() + i * stride;
+
+    auto isRoot = ShadowNode::sameFamily(*currentRevision, *shadowNode);
+    auto ancestors = isRoot
+        ? ShadowNodeFamily::AncestorList{}
+        : shadowNode->getFamily().getAncestors(*currentRevision);
+    if (!isRoot && ancestors.empty()) {
+      // The node isn't connected.
+      continue;
+    }
+
+    switch (query) {
+      case DOMLayoutQuery::BoundingClientRect:
+      case DOMLayoutQuery::BoundingClientRectWithoutTransform: {
+        auto frame = resolver.getFrameFromRoot(ancestors, ancestors.size());
+        if (frame) {
+          values[0] = frame->origin.x;
+          values[1] = frame->origin.y;
+          values[2] = frame->size.width;
+          values[3] = frame->size.height;
+        }
+        break;
+      }
+      case DOMLayoutQuery::ScrollPosition: {
+        if (!resolver.getFrameFromRoot(ancestors, ancestors.size())) {
+          break;
+        }
+        const auto& shadowNodeInCurrentRevision = isRoot
+            ? *currentRevision
+            : *ancestors.back().first.get().getChildren().at(
+                  ancestors.back().second);
+        auto layoutableShadowNode = dynamic_cast<const LayoutableShadowNode*>(
+            &shadowNodeInCurrentRevision);
+        if (layoutableShadowNode == nullptr) {
+          break;
+        }
+        auto scrollPosition =
+            layoutableShadowNode->getContentOriginOffset(false);
+        values[0] = scrollPosition.x == 0 ? 0 : -scrollPosition.x;
+        values[1] = scrollPosition.y == 0 ? 0 : -scrollPosition.y;
+        break;
+      }
+      case DOMLayoutQuery::Offset: {
+        // The root node doesn't have an offset parent.
+        if (isRoot) {
+          break;
+        }
+
+        // Find the depth of the nearest positioned ancestor (or the root).
+        auto positionedAncestorDepth = size_t{0};
+        auto hasLayoutableAncestors = true;
+        for (auto depth = ancestors.size() - 1; depth > 0; depth--) {
+          auto layoutableAncestorShadowNode =
+              dynamic_cast<const LayoutableShadowNode*>(
+                  &ancestors[depth].first.get());
+          if (layoutableAncestorShadowNode == nullptr) {
+            hasLayoutableAncestors = false;
+            break;
+          }
+          if (layoutableAncestorShadowNode->getLayoutMetrics().positionType !=
+              PositionType::Static) {
+            positionedAncestorDepth = depth;
+            break;
+          }
+        }
+        if (!hasLayoutableAncestors) {
+          break;
+        }
+
+        auto frame = resolver.getFrameFromRoot(ancestors, ancestors.size());
+        auto positionedAncestorFrame =
+            resolver.getFrameFromRoot(ancestors, positionedAncestorDepth);
+        if (!frame || !positionedAncestorFrame) {
+          break;
+        }
+
+        auto positionedAncestorLayoutableShadowNode =
+            dynamic_cast<const LayoutableShadowNode*>(
+                &ancestors[positionedAncestorDepth].first.get());
+        if (positionedAncestorLayoutableShadowNode == nullptr) {
+          break;
+        }
+        auto borderWidth = positionedAncestorLayoutableShadowNode
+                               ->getLayoutMetrics()
+                               .borderWidth;
+
+        // On the Web, offsets are computed from the inner border of the
+        // parent.
+        values[0] = frame->origin.y - positionedAncestorFrame->origin.y -
+            borderWidth.top;
+        values[1] = frame->origin.x - positionedAncestorFrame->origin.x -
+            borderWidth.left;
+        break;
+      }
+    }
+  }
+
+  return result;
+}
+
 RNMeasureRect measure(
     const RootShadowNode::Shared& currentRevision,
     const ShadowNode& shadowNode) {
@@ -60,6 +60,30 @@ struct DOMBorderWidthRounded {
   int left = 0;
 };
 
+/*
+ * Layout reads that can be performed for many nodes at once via
+ * `getLayoutBatch`. The values are part of the `NativeDOM` JS API, so they
+ * must not be reordered.
+ */
+enum class DOMLayoutQuery : uint_fast8_t {
+  // [x, y, width, height], same as `getBoundingClientRect` including
+  // transforms (and as `measureInWindow`).
+  BoundingClientRect = 0,
+  // [x, y, width, height], same as `getBoundingClientRect` excluding
+  // transforms.
+  BoundingClientRectWithoutTransform = 1,
+  // [scrollLeft, scrollTop], same as `getScrollPosition`.
+  ScrollPosition = 2,
+  // [top, left], same as `getOffset` (without the offset parent).
+  // Must remain the last value, as `NativeDOM` validates queries against it.
+  Offset = 3,
+};
+
+/*
+ * Returns the number of values written by `getLayoutBatch` for each node.
+ */
+size_t getLayoutQueryStride(DOMLayoutQuery query);
+
 std::shared_ptr<const ShadowNode> getParentNode(
     const RootShadowNode::Shared& currentRevision,
     const ShadowNode& shadowNode);
@@ -108,6 +132,19 @@ DOMBorderWidthRounded getBorderWidth(
 
 std::string getTagName(const ShadowNode& shadowNode);
 
+/*
+ * Performs `query` for all the given shadow nodes against the same revision
+ * and returns the results as a flat list (`getLayoutQueryStride(query)`
+ * values per node, in the same order as the nodes). Nodes that aren't
+ * connected or displayed produce zeros, as the single-node methods do.
+ * Ancestor chains are resolved once per node, and the offsets of ancestors
+ * shared between nodes (e.g. the cells of a list) are only accumulated once.
+ */
+std::vector<double> getLayoutBatch(
+    const RootShadowNode::Shared& currentRevision,
+    const std::vector<std::shared_ptr<const ShadowNode>>& shadowNodes,
+    DOMLayoutQuery query);
+
 // Non-standard methods from React Native
 
 RNMeasureRect measure(
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/dom/DOM.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook::react {
+
+namespace {
+
+LayoutMetrics makeLayoutMetrics(
+    Point origin,
+    Size size,
+    PositionType positionType = PositionType::Relative) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame.origin = origin;
+  layoutMetrics.frame.size = size;
+  layoutMetrics.positionType = positionType;
+  return layoutMetrics;
+}
+
+/*
+ * Performs `query` for every node with the single-node methods, in the
+ * format of `dom::getLayoutBatch`.
+ */
+std::vector<double> getLayoutOneByOne(
+    const RootShadowNode::Shared& currentRevision,
+    const std::vector<std::shared_ptr<const ShadowNode>>& shadowNodes,
+    dom::DOMLayoutQuery query) {
+  auto result = std::vector<double>{};
+  for (const auto& shadowNode : shadowNodes) {
+    switch (query) {
+      case dom::DOMLayoutQuery::BoundingClientRect:
+      case dom::DOMLayoutQuery::BoundingClientRectWithoutTransform: {
+        auto rect = dom::getBoundingClientRect(
+            currentRevision,
+            *shadowNode,
+            query == dom::DOMLayoutQuery::BoundingClientRect);
+        result.insert(
+            result.end(), {rect.x, rect.y, rect.width, rect.height});
+        break;
+      }
+      case dom::DOMLayoutQuery::ScrollPosition: {
+        auto point = dom::getScrollPosition(currentRevision, *shadowNode);
+        result.insert(result.end(), {point.x, point.y});
+        break;
+      }
+      case dom::DOMLayoutQuery::Offset: {
+        auto offset = dom::getOffset(currentRevision, *shadowNode);
+        result.insert(result.end(), {offset.top, offset.left});
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+} // namespace
+
+class DOMTest : public ::testing::Test {
+ protected:
+  /*
+   * <Root viewportOffset={{x: 5, y: 7}}>
+   *   <View>
+   *     <View transform={[{translateX: 5}, {translateY: 5}]}>
+   *       <View />
+   *     </View>
+   *     <View transform={[{scale: 0.5}]}>
+   *       <View />
+   *     </View>
+   *     <ScrollView position="static" contentOffset={{x: 0, y: 50}}>
+   *       <View position="static">
+   *         <View />
+   *       </View>
+   *     </ScrollView>
+   *   </View>
+   * </Root>
+   */
+  DOMTest() {
+    auto builder = simpleComponentBuilder();
+
+    // clang-format off
+    auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode_)
+        .props([] {
+          auto sharedProps = std::make_shared<RootProps>();
+          sharedProps->layoutContext.viewportOffset = {5, 7};
+          return sharedProps;
+        })
+        .finalize([](RootShadowNode &shadowNode) {
+          shadowNode.setLayoutMetrics(
+              makeLayoutMetrics({0, 0}, {1000, 1000}));
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .reference(containerShadowNode_)
+            .finalize([](ViewShadowNode &shadowNode) {
+              shadowNode.setLayoutMetrics(
+                  makeLayoutMetrics({10, 20}, {500, 500}));
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .reference(translatedShadowNode_)
+                .props([] {
+                  auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                  sharedProps->transform = Transform::Translate(5, 5, 0);
+                  return sharedProps;
+                })
+                .finalize([](ViewShadowNode &shadowNode) {
+                  shadowNode.setLayoutMetrics(
+                      makeLayoutMetrics({30, 40}, {100, 100}));
+                })
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(translatedChildShadowNode_)
+                    .finalize([](ViewShadowNode &shadowNode) {
+                      shadowNode.setLayoutMetrics(
+                          makeLayoutMetrics({1, 2}, {10, 10}));
+                    })
+                }),
+              Element<ViewShadowNode>()
+                .reference(scaledShadowNode_)
+                .props([] {
+                  auto sharedProps = std::make_shared<ViewShadowNodeProps>();
+                  sharedProps->transform = Transform::Scale(0.5, 0.5, 1);
+                  return sharedProps;
+                })
+                .finalize([](ViewShadowNode &shadowNode) {
+                  shadowNode.setLayoutMetrics(
+                      makeLayoutMetrics({100, 100}, {200, 200}));
+                })
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(scaledChildShadowNode_)
+                    .finalize([](ViewShadowNode &shadowNode) {
+                      shadowNode.setLayoutMetrics(
+                          makeLayoutMetrics({10, 10}, {20, 20}));
+                    })
+                }),
+              Element<ScrollViewShadowNode>()
+                .reference(scrollViewShadowNode_)
+                .stateData([](ScrollViewState &data) {
+                  data.contentOffset = {0, 50};
+                })
+                .finalize([](ScrollViewShadowNode &shadowNode) {
+                  shadowNode.setLayoutMetrics(makeLayoutMetrics(
+                      {200, 0}, {100, 100}, PositionType::Static));
+                })
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(scrolledShadowNode_)
+                    .finalize([](ViewShadowNode &shadowNode) {
+                      shadowNode.setLayoutMetrics(makeLayoutMetrics(
+                          {0, 150}, {50, 50}, PositionType::Static));
+                    })
+                    .children({
+                      Element<ViewShadowNode>()
+                        .reference(scrolledChildShadowNode_)
+                        .finalize([](ViewShadowNode &shadowNode) {
+                          shadowNode.setLayoutMetrics(
+                              makeLayoutMetrics({5, 5}, {10, 10}));
+                        })
+                    })
+                })
+            })
+        });
+    // clang-format on
+
+    builder.build(element);
+  }
+
+  void expectParity(
+      const std::vector<std::shared_ptr<const ShadowNode>>& shadowNodes) {
+    for (auto query :
+         {dom::DOMLayoutQuery::BoundingClientRect,
+          dom::DOMLayoutQuery::BoundingClientRectWithoutTransform,
+          dom::DOMLayoutQuery::ScrollPosition,
+          dom::DOMLayoutQuery::Offset}) {
+      auto expected = getLayoutOneByOne(rootShadowNode_, shadowNodes, query);
+      auto actual = dom::getLayoutBatch(rootShadowNode_, shadowNodes, query);
+
+      ASSERT_EQ(actual.size(), expected.size());
+      for (size_t i = 0; i < actual.size(); i++) {
+        EXPECT_NEAR(actual[i], expected[i], 0.001)
+            << "query " << static_cast<int>(query) << ", value " << i;
+      }
+    }
+  }
+
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> containerShadowNode_;
+  std::shared_ptr<ViewShadowNode> translatedShadowNode_;
+  std::shared_ptr<ViewShadowNode> translatedChildShadowNode_;
+  std::shared_ptr<ViewShadowNode> scaledShadowNode_;
+  std::shared_ptr<ViewShadowNode> scaledChildShadowNode_;
+  std::shared_ptr<ScrollViewShadowNode> scrollViewShadowNode_;
+  std::shared_ptr<ViewShadowNode> scrolledShadowNode_;
+  std::shared_ptr<ViewShadowNode> scrolledChildShadowNode_;
+};
+
+TEST_F(DOMTest, getLayoutBatchMatchesSingleNodeMethodsForNestedNodes) {
+  expectParity({containerShadowNode_, translatedChildShadowNode_});
+
+  auto values = dom::getLayoutBatch(
+      rootShadowNode_,
+      {containerShadowNode_},
+      dom::DOMLayoutQuery::BoundingClientRectWithoutTransform);
+  EXPECT_EQ(values, (std::vector<double>{15, 27, 500, 500}));
+}
+
+TEST_F(DOMTest, getLayoutBatchMatchesSingleNodeMethodsForTransformedNodes) {
+  expectParity(
+      {translatedShadowNode_,
+       translatedChildShadowNode_,
+       scaledShadowNode_,
+       scaledChildShadowNode_});
+
+  auto values = dom::getLayoutBatch(
+      rootShadowNode_,
+      {translatedChildShadowNode_},
+      dom::DOMLayoutQuery::BoundingClientRect);
+  EXPECT_EQ(values, (std::vector<double>{51, 74, 10, 10}));
+}
+
+TEST_F(DOMTest, getLayoutBatchMatchesSingleNodeMethodsForScrolledNodes) {
+  expectParity(
+      {scrollViewShadowNode_, scrolledShadowNode_, scrolledChildShadowNode_});
+
+  auto values = dom::getLayoutBatch(
+      rootShadowNode_,
+      {scrollViewShadowNode_},
+      dom::DOMLayoutQuery::ScrollPosition);
+  EXPECT_EQ(values, (std::vector<double>{0, 50}));
+}
+
+TEST_F(DOMTest, getLayoutBatchMatchesSingleNodeMethodsForRootNode) {
+  expectParity({rootShadowNode_});
+
+  auto values = dom::getLayoutBatch(
+      rootShadowNode_, {rootShadowNode_}, dom::DOMLayoutQuery::Offset);
+  EXPECT_EQ(values, (std::vector<double>{0, 0}));
+}
+
+TEST_F(DOMTest, getLayoutBatchMatchesSingleNodeMethodsForAllNodesAtOnce) {
+  // Nodes share ancestors, in an order different from the tree order.
+  expectParity(
+      {scrolledChildShadowNode_,
+       rootShadowNode_,
+       scaledChildShadowNode_,
+       containerShadowNode_,
+       translatedChildShadowNode_,
+       scrolledShadowNode_,
+       scaledShadowNode_,
+       scrollViewShadowNode_,
+       translatedShadowNode_});
+}
+
+} // namespace facebook::react
@@ -15,6 +15,188 @@
 
 namespace facebook::react {
 
+namespace {
+
+using Matrix = std::array<Float, 16>;
+
+constexpr Matrix kIdentityMatrix{
+    {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+
+/*
+ * Multiplies `lhs` by `rhs` into `result`, which must not be any of them.
+ */
+void multiplyMatrices(const Matrix& lhs, const Matrix& rhs, Matrix& result) {
+  if (Transform::isAffine2D(lhs) && Transform::isAffine2D(rhs)) {
+    // Only the 2x2 linear part and the translation differ from the identity
+    // matrix.
+    result = kIdentityMatrix;
+    result[0] = rhs[0] * lhs[0] + rhs[1] * lhs[4];
+    result[1] = rhs[0] * lhs[1] + rhs[1] * lhs[5];
+    result[4] = rhs[4] * lhs[0] + rhs[5] * lhs[4];
+    result[5] = rhs[4] * lhs[1] + rhs[5] * lhs[5];
+    result[12] = rhs[12] * lhs[0] + rhs[13] * lhs[4] + lhs[12];
+    result[13] = rhs[12] * lhs[1] + rhs[13] * lhs[5] + lhs[13];
+    return;
+  }
+
+  // Every row of the result is a linear combination of the rows of `lhs`.
+  // Computing it a whole row at a time lets the compiler vectorize it.
+  for (int row = 0; row < 16; row += 4) {
+    auto rhs0 = rhs[row];
+    auto rhs1 = rhs[row + 1];
+    auto rhs2 = rhs[row + 2];
+    auto rhs3 = rhs[row + 3];
+    for (int column = 0; column < 4; column++) {
+      result[row + column] = rhs0 * lhs[column] + rhs1 * lhs[4 + column] +
+          rhs2 * lhs[8 + column] + rhs3 * lhs[12 + column];
+    }
+  }
+}
+
+/*
+ * Concatenates `transform` with the transform of an operation of the given
+ * type and with the given (resolved) values, as multiplying it with the
+ * result of `Transform::Scale`, `Transform::Rotate`, etc. does, but without
+ * creating a temporary transform.
+ */
+void appendOperation(
+    Transform& transform,
+    TransformOperationType type,
+    Float x,
+    Float y,
+    Float z) {
+  auto& operations = transform.operations;
+  auto wasIdentity = transform.isIdentity();
+  auto operationCount = operations.size();
+  auto matrix = kIdentityMatrix;
+  auto Zero = ValueUnit(0, UnitType::Point);
+
+  switch (type) {
+    case TransformOperationType::Perspective: {
+      operations.push_back(TransformOperation{
+          TransformOperationType::Perspective,
+          ValueUnit(x, UnitType::Point),
+          Zero,
+          Zero});
+      matrix[11] = -1 / x;
+      break;
+    }
+    case TransformOperationType::Scale: {
+      Float xprime = isZero(x) ? 0 : x;
+      Float yprime = isZero(y) ? 0 : y;
+      Float zprime = isZero(z) ? 0 : z;
+      if (xprime != 1 || yprime != 1 || zprime != 1) {
+        operations.push_back(TransformOperation{
+            TransformOperationType::Scale,
+            ValueUnit(xprime, UnitType::Point),
+            ValueUnit(yprime, UnitType::Point),
+            ValueUnit(zprime, UnitType::Point)});
+        matrix[0] = xprime;
+        matrix[5] = yprime;
+        matrix[10] = zprime;
+      }
+      break;
+    }
+    case TransformOperationType::Translate: {
+      Float xprime = isZero(x) ? 0 : x;
+      Float yprime = isZero(y) ? 0 : y;
+      Float zprime = isZero(z) ? 0 : z;
+      if (xprime != 0 || yprime != 0 || zprime != 0) {
+        operations.push_back(TransformOperation{
+            TransformOperationType::Translate,
+            ValueUnit(xprime, UnitType::Point),
+            ValueUnit(yprime, UnitType::Point),
+            ValueUnit(zprime, UnitType::Point)});
+        matrix[12] = xprime;
+        matrix[13] = yprime;
+        matrix[14] = zprime;
+      }
+      break;
+    }
+    case TransformOperationType::Skew: {
+      Float xprime = isZero(x) ? 0 : x;
+      Float yprime = isZero(y) ? 0 : y;
+      operations.push_back(TransformOperation{
+          TransformOperationType::Skew,
+          ValueUnit(xprime, UnitType::Point),
+          ValueUnit(yprime, UnitType::Point),
+          ValueUnit(0, UnitType::Point)});
+      matrix[4] = std::tan(xprime);
+      matrix[1] = std::tan(yprime);
+      break;
+    }
+    case TransformOperationType::Rotate: {
+      // Rotations around the X, Y and Z axes, in this order.
+      auto rotate = [&](const Matrix& rotation) {
+        if (operations.size() == operationCount + 1) {
+          matrix = rotation;
+        } else {
+          auto product = Matrix{};
+          multiplyMatrices(matrix, rotation, product);
+          matrix = product;
+        }
+      };
+      if (!isZero(x)) {
+        operations.push_back(TransformOperation{
+            TransformOperationType::Rotate,
+            ValueUnit(x, UnitType::Point),
+            Zero,
+            Zero});
+        auto rotation = kIdentityMatrix;
+        rotation[5] = std::cos(x);
+        rotation[6] = std::sin(x);
+        rotation[9] = -std::sin(x);
+        rotation[10] = std::cos(x);
+        rotate(rotation);
+      }
+      if (!isZero(y)) {
+        operations.push_back(TransformOperation{
+            TransformOperationType::Rotate,
+            Zero,
+            ValueUnit(y, UnitType::Point),
+            Zero});
+        auto rotation = kIdentityMatrix;
+        rotation[0] = std::cos(y);
+        rotation[2] = -std::sin(y);
+        rotation[8] = std::sin(y);
+        rotation[10] = std::cos(y);
+        rotate(rotation);
+      }
+      if (!isZero(z)) {
+        operations.push_back(TransformOperation{
+            TransformOperationType::Rotate,
+            Zero,
+            Zero,
+            ValueUnit(z, UnitType::Point)});
+        auto rotation = kIdentityMatrix;
+        rotation[0] = std::cos(z);
+        rotation[1] = std::sin(z);
+        rotation[4] = -std::sin(z);
+        rotation[5] = std::cos(z);
+        rotate(rotation);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+
+  if (operations.size() == operationCount) {
+    // The operation is an identity transform.
+    return;
+  }
+
+  if (wasIdentity) {
+    transform.matrix = matrix;
+  } else {
+    auto product = Matrix{};
+    multiplyMatrices(transform.matrix, matrix, product);
+    transform.matrix = product;
+  }
+}
+
+} // namespace
+
 Transform Transform::Identity() {
   return {};
 }
@@ -29,128 +211,44 @@ Transform Transform::HorizontalInversion() {
 
 Transform Transform::Perspective(Float perspective) {
   auto transform = Transform{};
-  auto Zero = ValueUnit(0, UnitType::Point);
-  transform.operations.push_back(TransformOperation{
-      TransformOperationType::Perspective,
-      ValueUnit(perspective, UnitType::Point),
-      Zero,
-      Zero});
-  transform.matrix[11] = -1 / perspective;
+  appendOperation(
+      transform, TransformOperationType::Perspective, perspective, 0, 0);
   return transform;
 }
 
 Transform Transform::Scale(Float x, Float y, Float z) {
   auto transform = Transform{};
-  Float xprime = isZero(x) ? 0 : x;
-  Float yprime = isZero(y) ? 0 : y;
-  Float zprime = isZero(z) ? 0 : z;
-  if (xprime != 1 || yprime != 1 || zprime != 1) {
-    transform.operations.push_back(TransformOperation{
-        TransformOperationType::Scale,
-        ValueUnit(xprime, UnitType::Point),
-        ValueUnit(yprime, UnitType::Point),
-        ValueUnit(zprime, UnitType::Point)});
-    transform.matrix[0] = xprime;
-    transform.matrix[5] = yprime;
-    transform.matrix[10] = zprime;
-  }
+  appendOperation(transform, TransformOperationType::Scale, x, y, z);
   return transform;
 }
 
 Transform Transform::Translate(Float x, Float y, Float z) {
   auto transform = Transform{};
-  Float xprime = isZero(x) ? 0 : x;
-  Float yprime = isZero(y) ? 0 : y;
-  Float zprime = isZero(z) ? 0 : z;
-  if (xprime != 0 || yprime != 0 || zprime != 0) {
-    transform.operations.push_back(TransformOperation{
-        TransformOperationType::Translate,
-        ValueUnit(xprime, UnitType::Point),
-        ValueUnit(yprime, UnitType::Point),
-        ValueUnit(zprime, UnitType::Point)});
-    transform.matrix[12] = xprime;
-    transform.matrix[13] = yprime;
-    transform.matrix[14] = zprime;
-  }
+  appendOperation(transform, TransformOperationType::Translate, x, y, z);
   return transform;
 }
 
 Transform Transform::Skew(Float x, Float y) {
   auto transform = Transform{};
-  Float xprime = isZero(x) ? 0 : x;
-  Float yprime = isZero(y) ? 0 : y;
-  transform.operations.push_back(TransformOperation{
-      TransformOperationType::Skew,
-      ValueUnit(xprime, UnitType::Point),
-      ValueUnit(yprime, UnitType::Point),
-      ValueUnit(0, UnitType::Point)});
-  transform.matrix[4] = std::tan(xprime);
-  transform.matrix[1] = std::tan(yprime);
+  appendOperation(transform, TransformOperationType::Skew, x, y, 0);
   return transform;
 }
 
 Transform Transform::RotateX(Float radians) {
-  auto transform = Transform{};
-  if (!isZero(radians)) {
-    auto Zero = ValueUnit(0, UnitType::Point);
-    transform.operations.push_back(TransformOperation{
-        TransformOperationType::Rotate,
-        ValueUnit(radians, UnitType::Point),
-        Zero,
-        Zero});
-    transform.matrix[5] = std::cos(radians);
-    transform.matrix[6] = std::sin(radians);
-    transform.matrix[9] = -std::sin(radians);
-    transform.matrix[10] = std::cos(radians);
-  }
-  return transform;
+  return Transform::Rotate(radians, 0, 0);
 }
 
 Transform Transform::RotateY(Float radians) {
-  auto transform = Transform{};
-  if (!isZero(radians)) {
-    auto Zero = ValueUnit(0, UnitType::Point);
-    transform.operations.push_back(TransformOperation{
-        TransformOperationType::Rotate,
-        Zero,
-        ValueUnit(radians, UnitType::Point),
-        Zero});
-    transform.matrix[0] = std::cos(radians);
-    transform.matrix[2] = -std::sin(radians);
-    transform.matrix[8] = std::sin(radians);
-    transform.matrix[10] = std::cos(radians);
-  }
-  return transform;
+  return Transform::Rotate(0, radians, 0);
 }
 
 Transform Transform::RotateZ(Float radians) {
-  auto transform = Transform{};
-  if (!isZero(radians)) {
-    auto Zero = ValueUnit(0, UnitType::Point);
-    transform.operations.push_back(TransformOperation{
-        TransformOperationType::Rotate,
-        Zero,
-        Zero,
-        ValueUnit(radians, UnitType::Point)});
-    transform.matrix[0] = std::cos(radians);
-    transform.matrix[1] = std::sin(radians);
-    transform.matrix[4] = -std::sin(radians);
-    transform.matrix[5] = std::cos(radians);
-  }
-  return transform;
+  return Transform::Rotate(0, 0, radians);
 }
 
 Transform Transform::Rotate(Float x, Float y, Float z) {
   auto transform = Transform{};
-  if (!isZero(x)) {
-    transform = transform * Transform::RotateX(x);
-  }
-  if (!isZero(y)) {
-    transform = transform * Transform::RotateY(y);
-  }
-  if (!isZero(z)) {
-    transform = transform * Transform::RotateZ(z);
-  }
+  appendOperation(transform, TransformOperationType::Rotate, x, y, z);
   return transform;
 }
 
@@ -230,10 +328,24 @@ Transform Transform::Interpolate(
     const Transform& lhs,
     const Transform& rhs,
     const Size& size) {
+  auto result = Transform{};
+  Interpolate(animationProgress, lhs, rhs, size, result);
+  return result;
+}
+
+void Transform::Interpolate(
+    Float animationProgress,
+    const Transform& lhs,
+    const Transform& rhs,
+    const Size& size,
+    Transform& result) {
+  react_native_assert(&result != &lhs && &result != &rhs);
+
   // Iterate through operations and reconstruct an interpolated resulting
   // transform If at any point we hit an "Arbitrary" Transform, return at that
   // point
-  Transform result = Transform::Identity();
+  result.operations.clear();
+  result.matrix = kIdentityMatrix;
   for (size_t i = 0, j = 0;
        i < lhs.operations.size() || j < rhs.operations.size();) {
     bool haveLHS = i < lhs.operations.size();
@@ -242,8 +354,8 @@ Transform Transform::Interpolate(
     if ((haveLHS &&
          lhs.operations[i].type == TransformOperationType::Arbitrary) ||
         (haveRHS &&
-         rhs.operations[i].type == TransformOperationType::Arbitrary)) {
-      return result;
+         rhs.operations[j].type == TransformOperationType::Arbitrary)) {
+      return;
     }
     if (haveLHS && lhs.operations[i].type == TransformOperationType::Identity) {
       i++;
@@ -274,31 +386,20 @@ Transform Transform::Interpolate(
     react_native_assert(type == lhsOp.type);
     react_native_assert(type == rhsOp.type);
 
-    result = result *
-        Transform::FromTransformOperation(
-                 TransformOperation{
-                     type,
-                     ValueUnit(
-                         lhsOp.x.resolve(size.width) +
-                             (rhsOp.x.resolve(size.width) -
-                              lhsOp.x.resolve(size.width)) *
-                                 animationProgress,
-                         UnitType::Point),
-                     ValueUnit(
-                         lhsOp.y.resolve(size.height) +
-                             (rhsOp.y.resolve(size.height) -
-                              lhsOp.y.resolve(size.height)) *
-                                 animationProgress,
-                         UnitType::Point),
-                     ValueUnit(
-                         lhsOp.z.resolve(0) +
-                             (rhsOp.z.resolve(0) - lhsOp.z.resolve(0)) *
-                                 animationProgress,
-                         UnitType::Point)},
-                 size);
+    // Concatenated in place, so that `result` doesn't allocate once its
+    // operations have enough capacity.
+    appendOperation(
+        result,
+        type,
+        lhsOp.x.resolve(size.width) +
+            (rhsOp.x.resolve(size.width) - lhsOp.x.resolve(size.width)) *
+                animationProgress,
+        lhsOp.y.resolve(size.height) +
+            (rhsOp.y.resolve(size.height) - lhsOp.y.resolve(size.height)) *
+                animationProgress,
+        lhsOp.z.resolve(0) +
+            (rhsOp.z.resolve(0) - lhsOp.z.resolve(0)) * animationProgress);
   }
-
-  return result;
 }
 
 bool Transform::isVerticalInversion(const Transform& transform) {
@@ -309,6 +410,10 @@ bool Transform::isHorizontalInversion(const Transform& transform) {
   return floatEquality(transform.at(0, 0), static_cast<Float>(-1.0f));
 }
 
+bool Transform::isIdentity() const {
+  return operations.empty() && matrix == kIdentityMatrix;
+}
+
 bool Transform::operator==(const Transform& rhs) const {
   for (auto i = 0; i < 16; i++) {
     if (matrix[i] != rhs.matrix[i]) {
@@ -331,12 +436,13 @@ bool Transform::operator!=(const Transform& rhs) const {
 }
 
 Transform Transform::operator*(const Transform& rhs) const {
-  if (*this == Transform::Identity()) {
+  if (isIdentity()) {
     return rhs;
   }
 
   const auto& lhs = *this;
   auto result = Transform{};
+  result.operations.reserve(lhs.operations.size() + rhs.operations.size());
   for (const auto& op : this->operations) {
     if (op.type == TransformOperationType::Identity &&
         !result.operations.empty()) {
@@ -352,59 +458,7 @@ Transform Transform::operator*(const Transform& rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0];
-  auto lhs01 = lhs.matrix[1];
-  auto lhs02 = lhs.matrix[2];
-  auto lhs03 = lhs.matrix[3];
-  auto lhs10 = lhs.matrix[4];
-  auto lhs11 = lhs.matrix[5];
-  auto lhs12 = lhs.matrix[6];
-  auto lhs13 = lhs.matrix[7];
-  auto lhs20 = lhs.matrix[8];
-  auto lhs21 = lhs.matrix[9];
-  auto lhs22 = lhs.matrix[10];
-  auto lhs23 = lhs.matrix[11];
-  auto lhs30 = lhs.matrix[12];
-  auto lhs31 = lhs.matrix[13];
-  auto lhs32 = lhs.matrix[14];
-  auto lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0];
-  auto rhs1 = rhs.matrix[1];
-  auto rhs2 = rhs.matrix[2];
-  auto rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
+  multiplyMatrices(lhs.matrix, rhs.matrix, result.matrix);
   return result;
 }
 
@@ -417,10 +471,18 @@ const Float& Transform::at(int i, int j) const {
 }
 
 Point operator*(const Point& point, const Transform& transform) {
-  if (transform == Transform::Identity()) {
+  if (transform.isIdentity()) {
     return point;
   }
 
+  if (transform.isAffine2D()) {
+    return {
+        point.x * transform.matrix[0] + point.y * transform.matrix[4] +
+            transform.matrix[12],
+        point.x * transform.matrix[1] + point.y * transform.matrix[5] +
+            transform.matrix[13]};
+  }
+
   auto result = transform * Vector{point.x, point.y, 0, 1};
 
   return {result.x, result.y};
@@ -437,6 +499,15 @@ Rect Transform::applyWithCenter(const Rect& rect, const Point& center) const {
   auto c = Point{rect.getMaxX(), rect.getMaxY()} - center;
   auto d = Point{rect.origin.x, rect.getMaxY()} - center;
 
+  if (isAffine2D()) {
+    auto apply = [&](const Point& point) {
+      return Point{
+          point.x * matrix[0] + point.y * matrix[4] + matrix[12] + center.x,
+          point.x * matrix[1] + point.y * matrix[5] + matrix[13] + center.y};
+    };
+    return Rect::boundingRect(apply(a), apply(b), apply(c), apply(d));
+  }
+
   auto vectorA = *this * Vector{a.x, a.y, 0, 1};
   auto vectorB = *this * Vector{b.x, b.y, 0, 1};
   auto vectorC = *this * Vector{c.x, c.y, 0, 1};
@@ -473,7 +544,7 @@ Vector operator*(const Transform& transform, const Vector& vector) {
 }
 
 Size operator*(const Size& size, const Transform& transform) {
-  if (transform == Transform::Identity()) {
+  if (transform.isIdentity()) {
     return size;
   }
 
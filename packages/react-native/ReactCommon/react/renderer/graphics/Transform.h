@@ -163,9 +163,46 @@ struct Transform {
       const Transform& rhs,
       const Size& size);
 
+  /*
+   * Same as above, but writes the interpolated transform to `result` (which
+   * must not be `lhs` or `rhs`), reusing the storage of its operations. Doesn't
+   * allocate if `result` already has enough capacity, e.g. when it was used
+   * for the previous frame of the same animation.
+   */
+  static void Interpolate(
+      Float animationProgress,
+      const Transform& lhs,
+      const Transform& rhs,
+      const Size& size,
+      Transform& result);
+
   static bool isVerticalInversion(const Transform& transform);
   static bool isHorizontalInversion(const Transform& transform);
 
+  /*
+   * Whether the transform is equal to `Transform::Identity()`, without
+   * constructing it.
+   */
+  bool isIdentity() const;
+
+  /*
+   * Whether the matrix is a 2D affine transform (`[a b 0 0; c d 0 0; 0 0 1 0;
+   * tx ty 0 1]`), i.e. it only scales, skews and rotates around the Z axis,
+   * and translates along the X and Y axes. Most transforms are, and these are
+   * multiplied and applied to points without the terms of the Z axis and of
+   * the perspective.
+   */
+  bool isAffine2D() const {
+    return isAffine2D(matrix);
+  }
+
+  static bool isAffine2D(const std::array<Float, 16>& matrix) {
+    return matrix[2] == 0 && matrix[3] == 0 && matrix[6] == 0 &&
+        matrix[7] == 0 && matrix[8] == 0 && matrix[9] == 0 &&
+        matrix[10] == 1 && matrix[11] == 0 && matrix[14] == 0 &&
+        matrix[15] == 1;
+  }
+
   /*
    * Equality operators.
    */
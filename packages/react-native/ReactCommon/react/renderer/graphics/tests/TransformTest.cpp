@@ -8,7 +8,9 @@
 #include <react/renderer/graphics/Transform.h>
 
 #include <gtest/gtest.h>
+#include <array>
 #include <cmath>
+#include <vector>
 
 using namespace facebook::react;
 
@@ -134,3 +136,101 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, affine2DTransforms) {
+  EXPECT_TRUE(Transform::Identity().isAffine2D());
+  EXPECT_TRUE(Transform::Translate(10, 20, 0).isAffine2D());
+  EXPECT_TRUE(Transform::Scale(2, 3, 1).isAffine2D());
+  EXPECT_TRUE(Transform::RotateZ(M_PI_4).isAffine2D());
+  EXPECT_TRUE(Transform::Skew(0.2, 0.1).isAffine2D());
+
+  EXPECT_FALSE(Transform::Translate(10, 20, 5).isAffine2D());
+  EXPECT_FALSE(Transform::Scale(2, 3, 4).isAffine2D());
+  EXPECT_FALSE(Transform::RotateX(M_PI_4).isAffine2D());
+  EXPECT_FALSE(Transform::Perspective(1000).isAffine2D());
+}
+
+TEST(TransformTest, concatenatingTransforms) {
+  // Reference product of the full 4x4 matrices.
+  auto multiply = [](const Transform& lhs, const Transform& rhs) {
+    auto result = std::array<Float, 16>{};
+    for (int i = 0; i < 4; i++) {
+      for (int j = 0; j < 4; j++) {
+        for (int k = 0; k < 4; k++) {
+          result[i * 4 + j] += rhs.at(i, k) * lhs.at(k, j);
+        }
+      }
+    }
+    return result;
+  };
+
+  auto transforms = std::vector<Transform>{
+      Transform::Translate(10, 20, 0),
+      Transform::Scale(0.5, 2, 1),
+      Transform::RotateZ(M_PI / 6),
+      Transform::Skew(0.3, 0.1),
+      Transform::Perspective(1000),
+      Transform::RotateY(M_PI / 3),
+      Transform::Translate(1, 2, 3)};
+
+  for (const auto& lhs : transforms) {
+    for (const auto& rhs : transforms) {
+      auto product = lhs * rhs;
+      auto expected = multiply(lhs, rhs);
+      for (int i = 0; i < 16; i++) {
+        ASSERT_NEAR(product.matrix[i], expected[i], 0.0001);
+      }
+      EXPECT_EQ(
+          product.operations.size(),
+          lhs.operations.size() + rhs.operations.size());
+      EXPECT_EQ(product.isAffine2D(), lhs.isAffine2D() && rhs.isAffine2D());
+    }
+  }
+}
+
+TEST(TransformTest, transformingPointWithPerspective) {
+  auto point = facebook::react::Point{10, 20};
+  auto transform = Transform::Perspective(1000) * Transform::Translate(5, 5, 0);
+
+  auto transformedPoint = point * transform;
+
+  EXPECT_EQ(transformedPoint.x, 15);
+  EXPECT_EQ(transformedPoint.y, 25);
+}
+
+TEST(TransformTest, interpolatingTransforms) {
+  auto from = Transform::Translate(0, 0, 0) * Transform::RotateZ(0) *
+      Transform::Scale(1, 1, 1);
+  auto to = Transform::Translate(100, 50, 0) * Transform::RotateZ(M_PI_2) *
+      Transform::Scale(2, 2, 1);
+
+  auto halfway = Transform::Interpolate(0.5, from, to, {100, 100});
+  auto expected = Transform::Translate(50, 25, 0) *
+      Transform::RotateZ(M_PI_4) * Transform::Scale(1.5, 1.5, 1);
+
+  EXPECT_EQ(halfway.operations.size(), expected.operations.size());
+  for (int i = 0; i < 16; i++) {
+    ASSERT_NEAR(halfway.matrix[i], expected.matrix[i], 0.0001);
+  }
+}
+
+TEST(TransformTest, interpolatingTransformsInPlace) {
+  auto from = Transform::Perspective(1000) * Transform::RotateY(0) *
+      Transform::Translate(0, 0, 0);
+  auto to = Transform::Perspective(1000) * Transform::RotateY(M_PI) *
+      Transform::Translate(10, 20, 30);
+
+  // Operations that resolve to identity transforms are dropped, so the first
+  // frame is one where all of them are present.
+  auto result = Transform{};
+  Transform::Interpolate(0.5, from, to, {100, 100}, result);
+  auto capacity = result.operations.capacity();
+  const auto* storage = result.operations.data();
+
+  for (auto progress : {0.25, 0.75, 1.0}) {
+    Transform::Interpolate(progress, from, to, {100, 100}, result);
+    EXPECT_EQ(result, Transform::Interpolate(progress, from, to, {100, 100}));
+    EXPECT_EQ(result.operations.capacity(), capacity);
+    EXPECT_EQ(result.operations.data(), storage);
+  }
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/graphics/Transform.h>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Float kPi = 3.14159265358979323846;
+
+/*
+ * The transforms of the ancestors of a deeply nested view, as they are
+ * concatenated when computing its layout metrics or culling it: mostly
+ * translations and scales, with the occasional rotation.
+ */
+std::vector<Transform> makeAffineTransformStack(size_t depth) {
+  auto transforms = std::vector<Transform>{};
+  for (size_t i = 0; i < depth; i++) {
+    switch (i % 4) {
+      case 0:
+        transforms.push_back(Transform::Translate(10, 20, 0));
+        break;
+      case 1:
+        transforms.push_back(Transform::Scale(1.1, 0.9, 1));
+        break;
+      case 2:
+        transforms.push_back(Transform::RotateZ(kPi / 12));
+        break;
+      default:
+        transforms.push_back(Transform::Identity());
+        break;
+    }
+  }
+  return transforms;
+}
+
+/*
+ * Transforms of a stack with a perspective and rotations around the X and Y
+ * axes, as used by 3D card flip animations.
+ */
+std::vector<Transform> makePerspectiveTransformStack(size_t depth) {
+  auto transforms = makeAffineTransformStack(depth);
+  transforms[0] = Transform::Perspective(1000);
+  transforms[depth / 2] = Transform::RotateY(kPi / 6);
+  transforms[depth - 1] = Transform::RotateX(kPi / 8);
+  return transforms;
+}
+
+Transform concatenate(const std::vector<Transform>& transforms) {
+  auto result = Transform::Identity();
+  for (const auto& transform : transforms) {
+    result = result * transform;
+  }
+  return result;
+}
+
+std::vector<Rect> makeRects(size_t count) {
+  auto rects = std::vector<Rect>{};
+  for (size_t i = 0; i < count; i++) {
+    rects.push_back(
+        {{static_cast<Float>(i % 40) * 10, static_cast<Float>(i / 40) * 10},
+         {10, 10}});
+  }
+  return rects;
+}
+
+/*
+ * The start and end transforms of views animated by a layout animation: each
+ * of them moves, rotates and grows.
+ */
+std::vector<std::pair<Transform, Transform>> makeAnimatedTransforms(
+    size_t count) {
+  auto transforms = std::vector<std::pair<Transform, Transform>>{};
+  for (size_t i = 0; i < count; i++) {
+    auto offset = static_cast<Float>(i);
+    transforms.emplace_back(
+        Transform::Translate(offset, 0, 0) * Transform::RotateZ(kPi / 12) *
+            Transform::Scale(1, 1, 1),
+        Transform::Translate(offset, 100, 0) * Transform::RotateZ(kPi / 4) *
+            Transform::Scale(1.5, 1.5, 1));
+  }
+  return transforms;
+}
+
+} // namespace
+
+static void concatenateAffineTransforms(benchmark::State& state) {
+  auto transforms = makeAffineTransformStack(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(concatenate(transforms));
+  }
+  state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(concatenateAffineTransforms)->Arg(4)->Arg(16);
+
+static void concatenatePerspectiveTransforms(benchmark::State& state) {
+  auto transforms = makePerspectiveTransformStack(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(concatenate(transforms));
+  }
+  state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(concatenatePerspectiveTransforms)->Arg(4)->Arg(16);
+
+/*
+ * Maps the frames of 1000 views through a concatenated transform, as culling
+ * and hit testing do.
+ */
+static void transformRects(benchmark::State& state) {
+  auto transform = state.range(0) != 0
+      ? concatenate(makePerspectiveTransformStack(8))
+      : concatenate(makeAffineTransformStack(8));
+  auto rects = makeRects(1000);
+  for (auto _ : state) {
+    for (const auto& rect : rects) {
+      benchmark::DoNotOptimize(rect * transform);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * rects.size());
+}
+BENCHMARK(transformRects)->ArgName("perspective")->Arg(0)->Arg(1);
+
+static void transformPoints(benchmark::State& state) {
+  auto transform = concatenate(makeAffineTransformStack(8));
+  auto rects = makeRects(1000);
+  for (auto _ : state) {
+    for (const auto& rect : rects) {
+      benchmark::DoNotOptimize(rect.origin * transform);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * rects.size());
+}
+BENCHMARK(transformPoints);
+
+/*
+ * A frame of 500 simultaneous layout animations of the transforms of views.
+ */
+static void interpolateTransforms(benchmark::State& state) {
+  auto transforms = makeAnimatedTransforms(500);
+  auto progress = Float{0};
+  for (auto _ : state) {
+    progress = progress < 1 ? progress + Float{0.01} : 0;
+    for (const auto& [from, to] : transforms) {
+      benchmark::DoNotOptimize(
+          Transform::Interpolate(progress, from, to, {100, 100}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(interpolateTransforms);
+
+static void interpolateTransformsInPlace(benchmark::State& state) {
+  auto transforms = makeAnimatedTransforms(500);
+  auto results = std::vector<Transform>(transforms.size());
+  auto progress = Float{0};
+  for (auto _ : state) {
+    progress = progress < 1 ? progress + Float{0.01} : 0;
+    for (size_t i = 0; i < transforms.size(); i++) {
+      const auto& [from, to] = transforms[i];
+      Transform::Interpolate(progress, from, to, {100, 100}, results[i]);
+    }
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(interpolateTransformsInPlace);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -11,6 +11,7 @@
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/renderer/imagemanager/ImageRequestCoalescer.h>
 #include <react/renderer/imagemanager/ImageRequestParams.h>
 #include <react/renderer/imagemanager/primitives.h>
 #include <react/utils/ContextContainer.h>
@@ -24,6 +25,8 @@ using SharedImageManager = std::shared_ptr<ImageManager>;
 /*
  * Cross platform facade for image management (e.g. iOS-specific
  * RCTImageManager)
+ * Requests for the same image are coalesced across surfaces (see
+ * `ImageRequestCoalescer`).
  */
 class ImageManager {
  public:
@@ -42,6 +45,8 @@ class ImageManager {
 
  private:
   void* self_{};
+
+  ImageRequestCoalescer requestCoalescer_;
 };
 
 } // namespace facebook::react
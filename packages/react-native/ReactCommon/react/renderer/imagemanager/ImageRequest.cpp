@@ -19,6 +19,14 @@ ImageRequest::ImageRequest(
       std::move(resumeFunction), std::move(cancelationFunction));
 }
 
+ImageRequest::ImageRequest(
+    ImageSource imageSource,
+    std::shared_ptr<const ImageTelemetry> telemetry,
+    std::shared_ptr<const ImageResponseObserverCoordinator> coordinator)
+    : imageSource_(std::move(imageSource)),
+      telemetry_(std::move(telemetry)),
+      coordinator_(std::move(coordinator)) {}
+
 const ImageSource& ImageRequest::getImageSource() const {
   return imageSource_;
 }
@@ -34,6 +34,15 @@ class ImageRequest final {
       SharedFunction<> resumeFunction = {},
       SharedFunction<> cancelationFunction = {});
 
+  /*
+   * Creates a request sharing the observer coordinator (and so the underlying
+   * image loading) of another request for the same image.
+   */
+  ImageRequest(
+      ImageSource imageSource,
+      std::shared_ptr<const ImageTelemetry> telemetry,
+      std::shared_ptr<const ImageResponseObserverCoordinator> coordinator);
+
   /*
    * The move constructor.
    */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ImageRequestCoalescer.h"
+
+#include <algorithm>
+
+#include <react/utils/hash_combine.h>
+
+namespace facebook::react {
+
+size_t ImageRequestCoalescer::hashImageSource(const ImageSource& imageSource) {
+  auto seed = hash_combine(
+      imageSource.type,
+      imageSource.uri,
+      imageSource.bundle,
+      imageSource.scale,
+      imageSource.size,
+      imageSource.body,
+      imageSource.method,
+      imageSource.cache);
+  for (const auto& [name, value] : imageSource.headers) {
+    hash_combine(seed, name, value);
+  }
+  return seed;
+}
+
+bool ImageRequestCoalescer::areImageSourcesEquivalent(
+    const ImageSource& lhs,
+    const ImageSource& rhs) {
+  // `ImageSource::operator==` only compares types and URIs, but every field
+  // can change the loaded image.
+  return std::tie(
+             lhs.type,
+             lhs.uri,
+             lhs.bundle,
+             lhs.scale,
+             lhs.size,
+             lhs.body,
+             lhs.method,
+             lhs.cache,
+             lhs.headers) ==
+      std::tie(
+             rhs.type,
+             rhs.uri,
+             rhs.bundle,
+             rhs.scale,
+             rhs.size,
+             rhs.body,
+             rhs.method,
+             rhs.cache,
+             rhs.headers);
+}
+
+ImageRequest ImageRequestCoalescer::requestImage(
+    const ImageSource& imageSource,
+    const ImageRequestParams& imageRequestParams,
+    SurfaceId surfaceId,
+    const RequestFactory& requestFactory) const {
+  if (imageSource.type == ImageSource::Type::Invalid ||
+      imageSource.cache == ImageSource::CacheStategy::Reload) {
+    {
+      std::scoped_lock lock(mutex_);
+      requestCount_++;
+    }
+    return requestFactory();
+  }
+
+  auto hash = hashImageSource(imageSource);
+
+  // The lock is held while the request is created, so that concurrent
+  // requests for the same image don't load it twice.
+  std::scoped_lock lock(mutex_);
+  requestCount_++;
+
+  auto [begin, end] = entries_.equal_range(hash);
+  for (auto it = begin; it != end; it++) {
+    const auto& entry = it->second;
+    if (!areImageSourcesEquivalent(entry.imageSource, imageSource) ||
+        entry.imageRequestParams != imageRequestParams) {
+      continue;
+    }
+
+    // Requests which failed are made again, as a new request may succeed.
+    auto coordinator = entry.coordinator.lock();
+    if (!coordinator ||
+        coordinator->getStatus() == ImageResponse::Status::Failed) {
+      entries_.erase(it);
+      break;
+    }
+
+    coalescedRequestCount_++;
+    auto telemetry = entry.hasTelemetry
+        ? std::make_shared<ImageTelemetry>(surfaceId, /* isCoalesced */ true)
+        : nullptr;
+    return {imageSource, std::move(telemetry), std::move(coordinator)};
+  }
+
+  auto imageRequest = requestFactory();
+  entries_.emplace(
+      hash,
+      Entry{
+          .imageSource = imageSource,
+          .imageRequestParams = imageRequestParams,
+          .coordinator = imageRequest.getSharedObserverCoordinator(),
+          .hasTelemetry = imageRequest.getSharedTelemetry() != nullptr});
+
+  if (entries_.size() > removalThreshold_) {
+    removeExpiredEntries();
+    removalThreshold_ =
+        std::max(kMinimumRemovalThreshold, entries_.size() * 2);
+  }
+
+  return imageRequest;
+}
+
+void ImageRequestCoalescer::removeExpiredEntries() const {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.coordinator.expired()) {
+      it = entries_.erase(it);
+    } else {
+      it++;
+    }
+  }
+}
+
+ImageRequestCoalescer::Statistics ImageRequestCoalescer::getStatistics()
+    const {
+  std::scoped_lock lock(mutex_);
+  auto liveRequestCount = static_cast<size_t>(std::count_if(
+      entries_.begin(), entries_.end(), [](const auto& keyAndEntry) {
+        return !keyAndEntry.second.coordinator.expired();
+      }));
+  return {
+      .requestCount = requestCount_,
+      .coalescedRequestCount = coalescedRequestCount_,
+      .liveRequestCount = liveRequestCount};
+}
+
+} // namespace facebook::react
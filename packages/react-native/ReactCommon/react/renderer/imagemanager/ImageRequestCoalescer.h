@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <react/renderer/core/ReactPrimitives.h>
+#include <react/renderer/imagemanager/ImageRequest.h>
+#include <react/renderer/imagemanager/ImageRequestParams.h>
+#include <react/renderer/imagemanager/primitives.h>
+
+namespace facebook::react {
+
+/*
+ * Coalesces requests for the same image across shadow nodes and surfaces.
+ *
+ * Requests for an image source and request params equal to those of a request
+ * which is still alive share its `ImageResponseObserverCoordinator`, so the
+ * image is loaded once and the loaded image is delivered to all observers.
+ * The coordinator (and with it the loaded image) is released once the last
+ * request sharing it is destroyed.
+ *
+ * Requests with the `Reload` cache strategy and requests for invalid sources
+ * are never coalesced, and requests which failed are made again.
+ *
+ * Can be used from any thread.
+ */
+class ImageRequestCoalescer final {
+ public:
+  using RequestFactory = std::function<ImageRequest()>;
+
+  struct Statistics {
+    /*
+     * Number of requests made through the coalescer.
+     */
+    size_t requestCount{0};
+
+    /*
+     * Number of requests which shared the coordinator of a live request.
+     */
+    size_t coalescedRequestCount{0};
+
+    /*
+     * Number of distinct images which are currently requested.
+     */
+    size_t liveRequestCount{0};
+  };
+
+  /*
+   * Returns a request sharing the coordinator of a live request for the same
+   * image, or the request created by `requestFactory` if there is none.
+   * Coalesced requests get their own `ImageTelemetry` for `surfaceId` (marked
+   * as coalesced) if the request they share a coordinator with has one.
+   */
+  ImageRequest requestImage(
+      const ImageSource& imageSource,
+      const ImageRequestParams& imageRequestParams,
+      SurfaceId surfaceId,
+      const RequestFactory& requestFactory) const;
+
+  Statistics getStatistics() const;
+
+ private:
+  static constexpr size_t kMinimumRemovalThreshold = 64;
+
+  struct Entry {
+    ImageSource imageSource;
+    ImageRequestParams imageRequestParams;
+    std::weak_ptr<const ImageResponseObserverCoordinator> coordinator;
+    bool hasTelemetry;
+  };
+
+  static size_t hashImageSource(const ImageSource& imageSource);
+
+  static bool areImageSourcesEquivalent(
+      const ImageSource& lhs,
+      const ImageSource& rhs);
+
+  /*
+   * Removes entries of requests which don't exist anymore.
+   * Must be called with `mutex_` held.
+   */
+  void removeExpiredEntries() const;
+
+  mutable std::mutex mutex_;
+
+  /*
+   * Entries of live requests, by the hash of their image source.
+   * Mutable: protected by mutex_.
+   */
+  mutable std::unordered_multimap<size_t, Entry> entries_;
+
+  /*
+   * Number of entries above which expired entries are removed.
+   * Mutable: protected by mutex_.
+   */
+  mutable size_t removalThreshold_{kMinimumRemovalThreshold};
+
+  /*
+   * Mutable: protected by mutex_.
+   */
+  mutable size_t requestCount_{0};
+  mutable size_t coalescedRequestCount_{0};
+};
+
+} // namespace facebook::react
@@ -15,16 +15,18 @@ namespace facebook::react {
 
 ImageResponseObserverCoordinator::ImageResponseObserverCoordinator(
     SharedFunction<> resumeFunction,
-    SharedFunction<> cancelationFunction)
+    SharedFunction<> cancelationFunction,
+    std::chrono::steady_clock::duration progressInterval)
     : resumeRequest_(std::move(resumeFunction)),
-      cancelRequest_(std::move(cancelationFunction)) {}
+      cancelRequest_(std::move(cancelationFunction)),
+      progressInterval_(progressInterval) {}
 
 void ImageResponseObserverCoordinator::addObserver(
     const ImageResponseObserver& observer) const {
   mutex_.lock();
   switch (status_) {
     case ImageResponse::Status::Loading: {
-      observers_.push_back(&observer);
+      setObservers(appendObserver(observer));
       mutex_.unlock();
       break;
     }
@@ -42,7 +44,7 @@ void ImageResponseObserverCoordinator::addObserver(
       break;
     }
     case ImageResponse::Status::Cancelled: {
-      observers_.push_back(&observer);
+      setObservers(appendObserver(observer));
       status_ = ImageResponse::Status::Loading;
       mutex_.unlock();
       resumeRequest_();
@@ -55,12 +57,21 @@ void ImageResponseObserverCoordinator::removeObserver(
     const ImageResponseObserver& observer) const {
   std::scoped_lock lock(mutex_);
 
-  // We remove only one element to maintain a balance between add/remove calls.
-  auto position = std::find(observers_.begin(), observers_.end(), &observer);
-  if (position != observers_.end()) {
-    observers_.erase(position, observers_.end());
+  if (!observers_) {
+    return;
+  }
 
-    if (observers_.empty() && status_ == ImageResponse::Status::Loading) {
+  // We remove only one element to maintain a balance between add/remove calls.
+  auto position = std::find(observers_->begin(), observers_->end(), &observer);
+  if (position != observers_->end()) {
+    auto observers = std::make_shared<Observers>();
+    observers->reserve(observers_->size() - 1);
+    observers->insert(observers->end(), observers_->begin(), position);
+    observers->insert(observers->end(), position + 1, observers_->end());
+    auto isEmpty = observers->empty();
+    setObservers(std::move(observers));
+
+    if (isEmpty && status_ == ImageResponse::Status::Loading) {
       status_ = ImageResponse::Status::Cancelled;
       cancelRequest_();
     }
@@ -71,14 +82,21 @@ void ImageResponseObserverCoordinator::nativeImageResponseProgress(
     float progress,
     int64_t loaded,
     int64_t total) const {
-  mutex_.lock();
-  auto observers = observers_;
   react_native_assert(
       status_ == ImageResponse::Status::Loading ||
       status_ == ImageResponse::Status::Cancelled);
-  mutex_.unlock();
 
-  for (auto observer : observers) {
+  // The final progress update is always sent.
+  if (loaded < total && !shouldSendProgress()) {
+    return;
+  }
+
+  auto observers = getObservers();
+  if (!observers) {
+    return;
+  }
+
+  for (auto observer : *observers) {
     observer->didReceiveProgress(progress, loaded, total);
   }
 }
@@ -95,7 +113,11 @@ void ImageResponseObserverCoordinator::nativeImageResponseComplete(
   auto observers = observers_;
   mutex_.unlock();
 
-  for (auto observer : observers) {
+  if (!observers) {
+    return;
+  }
+
+  for (auto observer : *observers) {
     observer->didReceiveImage(imageResponse);
   }
 }
@@ -111,9 +133,63 @@ void ImageResponseObserverCoordinator::nativeImageResponseFailed(
   auto observers = observers_;
   mutex_.unlock();
 
-  for (auto observer : observers) {
+  if (!observers) {
+    return;
+  }
+
+  for (auto observer : *observers) {
     observer->didReceiveFailure(loadError);
   }
 }
 
+ImageResponse::Status ImageResponseObserverCoordinator::getStatus() const {
+  return status_;
+}
+
+std::shared_ptr<const ImageResponseObserverCoordinator::Observers>
+ImageResponseObserverCoordinator::getObservers() const {
+  std::scoped_lock lock(observersMutex_);
+  return observers_;
+}
+
+std::shared_ptr<const ImageResponseObserverCoordinator::Observers>
+ImageResponseObserverCoordinator::appendObserver(
+    const ImageResponseObserver& observer) const {
+  auto observers = std::make_shared<Observers>();
+  if (observers_) {
+    // The list is copied once, into storage which already fits the new
+    // observer.
+    observers->reserve(observers_->size() + 1);
+    observers->insert(observers->end(), observers_->begin(), observers_->end());
+  }
+  observers->push_back(&observer);
+  return observers;
+}
+
+void ImageResponseObserverCoordinator::setObservers(
+    std::shared_ptr<const Observers> observers) const {
+  {
+    std::scoped_lock lock(observersMutex_);
+    std::swap(observers_, observers);
+  }
+  // The previous list is released here, without holding `observersMutex_`.
+}
+
+bool ImageResponseObserverCoordinator::shouldSendProgress() const {
+  if (progressInterval_ <= std::chrono::steady_clock::duration::zero()) {
+    return true;
+  }
+
+  auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+  auto lastProgressTime = lastProgressTime_.load(std::memory_order_relaxed);
+  if (lastProgressTime != kNoProgressTime &&
+      now - lastProgressTime < progressInterval_.count()) {
+    return false;
+  }
+
+  // Only one of concurrent updates is sent.
+  return lastProgressTime_.compare_exchange_strong(
+      lastProgressTime, now, std::memory_order_relaxed);
+}
+
 } // namespace facebook::react
@@ -11,6 +11,10 @@
 #include <react/renderer/imagemanager/ImageResponseObserver.h>
 #include <react/utils/SharedFunction.h>
 
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -21,12 +25,24 @@ namespace facebook::react {
  * data from native image loaders and sends events to any observers attached
  * to the coordinator. The Coordinator also keeps track of response status
  * and caches completed images.
+ *
+ * The list of observers is copied on write: adding or removing an observer
+ * publishes a new immutable list, and events are sent to the list which was
+ * published when they were received, without waiting for observers being
+ * added or removed.
  */
 class ImageResponseObserverCoordinator {
  public:
+  /*
+   * Progress updates received less than `progressInterval` after the last
+   * one which was sent to observers are dropped, except the final one.
+   * By default, all progress updates are sent.
+   */
   ImageResponseObserverCoordinator(
       SharedFunction<> resumeFunction,
-      SharedFunction<> cancelationFunction);
+      SharedFunction<> cancelationFunction,
+      std::chrono::steady_clock::duration progressInterval =
+          std::chrono::steady_clock::duration::zero());
 
   /*
    * Interested parties may observe the image response.
@@ -60,18 +76,53 @@ class ImageResponseObserverCoordinator {
    */
   void nativeImageResponseFailed(const ImageLoadError& loadError) const;
 
+  /*
+   * Returns the current status of image loading.
+   */
+  ImageResponse::Status getStatus() const;
+
  private:
+  using Observers = std::vector<const ImageResponseObserver*>;
+
+  static constexpr auto kNoProgressTime =
+      std::numeric_limits<std::chrono::steady_clock::rep>::min();
+
   /*
-   * List of observers.
-   * Mutable: protected by mutex_.
+   * Returns the current list of observers. Might be null if there are none.
+   */
+  std::shared_ptr<const Observers> getObservers() const;
+
+  /*
+   * Returns a copy of the current list of observers with `observer` appended.
+   * Must be called with `mutex_` held.
    */
-  mutable std::vector<const ImageResponseObserver*> observers_;
+  std::shared_ptr<const Observers> appendObserver(
+      const ImageResponseObserver& observer) const;
+
+  /*
+   * Publishes a new list of observers.
+   * Must be called with `mutex_` held.
+   */
+  void setObservers(std::shared_ptr<const Observers> observers) const;
+
+  /*
+   * Whether a progress update received now should be sent to observers.
+   */
+  bool shouldSendProgress() const;
+
+  /*
+   * List of observers. The list is never mutated once it is published.
+   * Mutable: protected by observersMutex_, and only replaced with mutex_
+   * held.
+   */
+  mutable std::shared_ptr<const Observers> observers_;
 
   /*
    * Current status of image loading.
-   * Mutable: protected by mutex_.
+   * Mutable: only changed with mutex_ held.
    */
-  mutable ImageResponse::Status status_{ImageResponse::Status::Loading};
+  mutable std::atomic<ImageResponse::Status> status_{
+      ImageResponse::Status::Loading};
 
   /*
    * Cache image data.
@@ -96,6 +147,12 @@ class ImageResponseObserverCoordinator {
    */
   mutable std::mutex mutex_;
 
+  /*
+   * Protects the pointer to the list of observers only, so that it is only
+   * held while the pointer is copied.
+   */
+  mutable std::mutex observersMutex_;
+
   /*
    * Function we can call to resume image request.
    */
@@ -105,6 +162,18 @@ class ImageResponseObserverCoordinator {
    * Function we can call to cancel image request.
    */
   SharedFunction<> cancelRequest_;
+
+  /*
+   * Minimum interval between two progress events sent to observers.
+   */
+  const std::chrono::steady_clock::duration progressInterval_;
+
+  /*
+   * Time (since the epoch of `std::chrono::steady_clock`) at which the last
+   * progress event was sent to observers, or `kNoProgressTime`.
+   */
+  mutable std::atomic<std::chrono::steady_clock::rep> lastProgressTime_{
+      kNoProgressTime};
 };
 
 } // namespace facebook::react
@@ -17,4 +17,8 @@ TelemetryTimePoint ImageTelemetry::getWillRequestUrlTime() const {
   return willRequestUrlTime_;
 }
 
+bool ImageTelemetry::getIsCoalesced() const {
+  return isCoalesced_;
+}
+
 } // namespace facebook::react
@@ -15,10 +15,13 @@ namespace facebook::react {
 /*
  * Represents telemetry data associated with a image request
  * where the willRequestUrlTime is the time at ImageTelemetry's creation.
+ * A coalesced request shares the image loading of another request for the
+ * same image (see `ImageRequestCoalescer`).
  */
 class ImageTelemetry final {
  public:
-  ImageTelemetry(const SurfaceId surfaceId) : surfaceId_(surfaceId) {
+  ImageTelemetry(const SurfaceId surfaceId, bool isCoalesced = false)
+      : surfaceId_(surfaceId), isCoalesced_(isCoalesced) {
     willRequestUrlTime_ = telemetryTimePointNow();
   }
 
@@ -26,10 +29,14 @@ class ImageTelemetry final {
 
   SurfaceId getSurfaceId() const;
 
+  bool getIsCoalesced() const;
+
  private:
   TelemetryTimePoint willRequestUrlTime_;
 
   const SurfaceId surfaceId_;
+
+  const bool isCoalesced_;
 };
 
 } // namespace facebook::react
@@ -30,7 +30,10 @@ ImageRequest ImageManager::requestImage(
     SurfaceId surfaceId,
     const ImageRequestParams& imageRequestParams,
     Tag tag) const {
-  return {imageSource, nullptr, {}};
+  return requestCoalescer_.requestImage(
+      imageSource, imageRequestParams, surfaceId, [&]() -> ImageRequest {
+        return {imageSource, nullptr};
+      });
 }
 
 } // namespace facebook::react
@@ -28,11 +28,14 @@ ImageRequest ImageManager::requestImage(
 
 ImageRequest ImageManager::requestImage(
     const ImageSource& imageSource,
-    SurfaceId /*surfaceId*/,
-    const ImageRequestParams& /*imageRequestParams*/,
+    SurfaceId surfaceId,
+    const ImageRequestParams& imageRequestParams,
     Tag /*tag*/) const {
-  // Not implemented.
-  return {imageSource, nullptr, {}};
+  return requestCoalescer_.requestImage(
+      imageSource, imageRequestParams, surfaceId, [&]() -> ImageRequest {
+        // Image loading is not implemented.
+        return {imageSource, std::make_shared<ImageTelemetry>(surfaceId)};
+      });
 }
 
 } // namespace facebook::react
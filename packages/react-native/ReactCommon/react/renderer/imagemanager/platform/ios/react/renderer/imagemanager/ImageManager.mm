@@ -42,11 +42,13 @@ ImageRequest ImageManager::requestImage(const ImageSource &imageSource, SurfaceI
 ImageRequest ImageManager::requestImage(
     const ImageSource &imageSource,
     SurfaceId surfaceId,
-    const ImageRequestParams & /*imageRequestParams*/,
+    const ImageRequestParams &imageRequestParams,
     Tag /*tag*/) const
 {
   RCTImageManager *imageManager = (__bridge RCTImageManager *)self_;
-  return [imageManager requestImage:imageSource surfaceId:surfaceId];
+  return requestCoalescer_.requestImage(imageSource, imageRequestParams, surfaceId, [&]() -> ImageRequest {
+    return [imageManager requestImage:imageSource surfaceId:surfaceId];
+  });
 }
 
 } // namespace facebook::react
@@ -6,6 +6,7 @@
  */
 
 #include <memory>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -13,6 +14,172 @@
 
 using namespace facebook::react;
 
-TEST(ImageManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+class CountingImageResponseObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(
+      float /*progress*/,
+      int64_t /*loaded*/,
+      int64_t /*total*/) const override {}
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    imageCount++;
+  }
+
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {
+    failureCount++;
+  }
+
+  mutable int imageCount{0};
+  mutable int failureCount{0};
+};
+
+ImageSource makeImageSource(std::string uri, Size size = {40, 40}) {
+  auto imageSource = ImageSource{};
+  imageSource.type = ImageSource::Type::Remote;
+  imageSource.uri = std::move(uri);
+  imageSource.size = size;
+  return imageSource;
+}
+
+const std::string kAvatarUri = "https://example.com/avatar.png";
+
+} // namespace
+
+TEST(ImageManagerTest, testRequestsForSameImageShareCoordinator) {
+  auto imageManager = ImageManager{std::make_shared<ContextContainer>()};
+
+  auto first = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+  auto second = imageManager.requestImage(makeImageSource(kAvatarUri), 2);
+
+  EXPECT_EQ(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+  EXPECT_FALSE(first.getSharedTelemetry()->getIsCoalesced());
+  EXPECT_TRUE(second.getSharedTelemetry()->getIsCoalesced());
+  EXPECT_EQ(second.getSharedTelemetry()->getSurfaceId(), 2);
+}
+
+TEST(ImageManagerTest, testRequestsForDifferentImagesAreNotCoalesced) {
+  auto imageManager = ImageManager{std::make_shared<ContextContainer>()};
+
+  auto avatar = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+  auto largeAvatar =
+      imageManager.requestImage(makeImageSource(kAvatarUri, {80, 80}), 1);
+  auto icon = imageManager.requestImage(
+      makeImageSource("https://example.com/icon.png"), 1);
+  auto blurredAvatar = imageManager.requestImage(
+      makeImageSource(kAvatarUri), 1, ImageRequestParams{4}, 0);
+
+  EXPECT_NE(
+      avatar.getSharedObserverCoordinator(),
+      largeAvatar.getSharedObserverCoordinator());
+  EXPECT_NE(
+      avatar.getSharedObserverCoordinator(),
+      icon.getSharedObserverCoordinator());
+  EXPECT_NE(
+      avatar.getSharedObserverCoordinator(),
+      blurredAvatar.getSharedObserverCoordinator());
+}
+
+TEST(ImageManagerTest, testReloadRequestsAreNotCoalesced) {
+  auto imageManager = ImageManager{std::make_shared<ContextContainer>()};
+  auto imageSource = makeImageSource(kAvatarUri);
+  imageSource.cache = ImageSource::CacheStategy::Reload;
+
+  auto first = imageManager.requestImage(imageSource, 1);
+  auto second = imageManager.requestImage(imageSource, 1);
+
+  EXPECT_NE(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+}
+
+TEST(ImageManagerTest, testCoordinatorIsReleasedWithLastRequest) {
+  auto imageManager = ImageManager{std::make_shared<ContextContainer>()};
+
+  auto weakCoordinator =
+      std::weak_ptr<const ImageResponseObserverCoordinator>{};
+  {
+    auto first = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+    weakCoordinator = first.getSharedObserverCoordinator();
+    {
+      auto second = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+    }
+    EXPECT_FALSE(weakCoordinator.expired());
+  }
+  EXPECT_TRUE(weakCoordinator.expired());
+
+  auto request = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+  EXPECT_FALSE(request.getSharedTelemetry()->getIsCoalesced());
+}
+
+TEST(ImageManagerTest, testResponseIsDeliveredToAllObservers) {
+  auto imageManager = ImageManager{std::make_shared<ContextContainer>()};
+  auto firstObserver = CountingImageResponseObserver{};
+  auto secondObserver = CountingImageResponseObserver{};
+  auto lateObserver = CountingImageResponseObserver{};
+
+  auto first = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+  auto second = imageManager.requestImage(makeImageSource(kAvatarUri), 2);
+  first.getObserverCoordinator().addObserver(firstObserver);
+  second.getObserverCoordinator().addObserver(secondObserver);
+
+  first.getObserverCoordinator().nativeImageResponseComplete(
+      ImageResponse{std::make_shared<int>(0), nullptr});
+
+  EXPECT_EQ(firstObserver.imageCount, 1);
+  EXPECT_EQ(secondObserver.imageCount, 1);
+
+  // Requests made after the image was loaded get it right away.
+  auto late = imageManager.requestImage(makeImageSource(kAvatarUri), 3);
+  late.getObserverCoordinator().addObserver(lateObserver);
+  EXPECT_EQ(lateObserver.imageCount, 1);
+
+  first.getObserverCoordinator().removeObserver(firstObserver);
+  second.getObserverCoordinator().removeObserver(secondObserver);
+  late.getObserverCoordinator().removeObserver(lateObserver);
+}
+
+TEST(ImageManagerTest, testFailedRequestsAreMadeAgain) {
+  auto imageManager = ImageManager{std::make_shared<ContextContainer>()};
+
+  auto first = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+  first.getObserverCoordinator().nativeImageResponseFailed(
+      ImageLoadError{nullptr});
+
+  auto second = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+  auto third = imageManager.requestImage(makeImageSource(kAvatarUri), 1);
+
+  EXPECT_NE(
+      first.getSharedObserverCoordinator(),
+      second.getSharedObserverCoordinator());
+  EXPECT_EQ(
+      second.getSharedObserverCoordinator(),
+      third.getSharedObserverCoordinator());
+}
+
+TEST(ImageManagerTest, testCoalescerStatistics) {
+  auto coalescer = ImageRequestCoalescer{};
+  auto requestFactory = [](const ImageSource& imageSource) {
+    return [imageSource]() -> ImageRequest {
+      return {imageSource, std::make_shared<ImageTelemetry>(1)};
+    };
+  };
+
+  auto requests = std::vector<ImageRequest>{};
+  for (int i = 0; i < 10; i++) {
+    auto imageSource = makeImageSource(i % 4 == 0 ? "icon" : kAvatarUri);
+    requests.push_back(coalescer.requestImage(
+        imageSource, {}, 1, requestFactory(imageSource)));
+  }
+
+  auto statistics = coalescer.getStatistics();
+  EXPECT_EQ(statistics.requestCount, 10);
+  EXPECT_EQ(statistics.coalescedRequestCount, 8);
+  EXPECT_EQ(statistics.liveRequestCount, 2);
+
+  requests.clear();
+  EXPECT_EQ(coalescer.getStatistics().liveRequestCount, 0);
 }
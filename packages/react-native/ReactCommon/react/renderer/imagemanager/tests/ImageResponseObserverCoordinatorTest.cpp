@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/imagemanager/ImageResponseObserverCoordinator.h>
+
+using namespace facebook::react;
+
+namespace {
+
+class CountingImageResponseObserver : public ImageResponseObserver {
+ public:
+  void didReceiveProgress(
+      float /*progress*/,
+      int64_t /*loaded*/,
+      int64_t /*total*/) const override {
+    progressCount++;
+  }
+
+  void didReceiveImage(const ImageResponse& /*imageResponse*/) const override {
+    imageCount++;
+  }
+
+  void didReceiveFailure(const ImageLoadError& /*error*/) const override {
+    failureCount++;
+  }
+
+  mutable std::atomic<int> progressCount{0};
+  mutable std::atomic<int> imageCount{0};
+  mutable std::atomic<int> failureCount{0};
+};
+
+ImageResponseObserverCoordinator makeCoordinator(
+    std::chrono::steady_clock::duration progressInterval =
+        std::chrono::steady_clock::duration::zero()) {
+  return {SharedFunction<>{}, SharedFunction<>{}, progressInterval};
+}
+
+} // namespace
+
+TEST(ImageResponseObserverCoordinatorTest, testObserversReceiveImage) {
+  auto coordinator = makeCoordinator();
+  auto first = CountingImageResponseObserver{};
+  auto second = CountingImageResponseObserver{};
+
+  coordinator.addObserver(first);
+  coordinator.addObserver(second);
+  coordinator.removeObserver(first);
+  coordinator.nativeImageResponseProgress(0.5, 50, 100);
+  coordinator.nativeImageResponseComplete(ImageResponse{nullptr, nullptr});
+
+  EXPECT_EQ(first.progressCount, 0);
+  EXPECT_EQ(first.imageCount, 0);
+  EXPECT_EQ(second.progressCount, 1);
+  EXPECT_EQ(second.imageCount, 1);
+}
+
+TEST(ImageResponseObserverCoordinatorTest, testRemoveObserverRemovesOnlyOne) {
+  auto coordinator = makeCoordinator();
+  auto first = CountingImageResponseObserver{};
+  auto second = CountingImageResponseObserver{};
+
+  coordinator.addObserver(first);
+  coordinator.addObserver(first);
+  coordinator.addObserver(second);
+  coordinator.removeObserver(first);
+  coordinator.nativeImageResponseFailed(ImageLoadError{nullptr});
+
+  EXPECT_EQ(first.failureCount, 1);
+  EXPECT_EQ(second.failureCount, 1);
+}
+
+TEST(ImageResponseObserverCoordinatorTest, testRemovingLastObserverCancels) {
+  auto cancelCount = 0;
+  auto resumeCount = 0;
+  auto cancelFunction = SharedFunction<>{};
+  auto resumeFunction = SharedFunction<>{};
+  cancelFunction.assign([&]() { cancelCount++; });
+  resumeFunction.assign([&]() { resumeCount++; });
+  auto coordinator =
+      ImageResponseObserverCoordinator{resumeFunction, cancelFunction};
+  auto observer = CountingImageResponseObserver{};
+
+  coordinator.addObserver(observer);
+  coordinator.removeObserver(observer);
+  EXPECT_EQ(cancelCount, 1);
+  EXPECT_EQ(coordinator.getStatus(), ImageResponse::Status::Cancelled);
+
+  coordinator.addObserver(observer);
+  EXPECT_EQ(resumeCount, 1);
+  EXPECT_EQ(coordinator.getStatus(), ImageResponse::Status::Loading);
+}
+
+TEST(ImageResponseObserverCoordinatorTest, testProgressIsCoalesced) {
+  auto coordinator = makeCoordinator(std::chrono::hours(1));
+  auto observer = CountingImageResponseObserver{};
+  coordinator.addObserver(observer);
+
+  for (int loaded = 0; loaded <= 100; loaded++) {
+    coordinator.nativeImageResponseProgress(loaded / 100.0f, loaded, 100);
+  }
+
+  // The first and the final updates.
+  EXPECT_EQ(observer.progressCount, 2);
+}
+
+TEST(ImageResponseObserverCoordinatorTest, testConcurrentObserversAndEvents) {
+  auto coordinator = makeCoordinator(std::chrono::microseconds(10));
+  auto stableObservers = std::vector<CountingImageResponseObserver>(4);
+  auto transientObservers = std::vector<CountingImageResponseObserver>(4);
+  for (const auto& observer : stableObservers) {
+    coordinator.addObserver(observer);
+  }
+
+  // Observers are added and removed while progress is reported, as views
+  // being mounted and unmounted do during a progressive load.
+  auto threads = std::vector<std::thread>{};
+  for (const auto& observer : transientObservers) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < 1000; i++) {
+        coordinator.addObserver(observer);
+        coordinator.removeObserver(observer);
+      }
+    });
+  }
+  threads.emplace_back([&]() {
+    for (int loaded = 0; loaded <= 10000; loaded++) {
+      coordinator.nativeImageResponseProgress(loaded / 1e4f, loaded, 10000);
+    }
+  });
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  coordinator.nativeImageResponseComplete(ImageResponse{nullptr, nullptr});
+
+  for (const auto& observer : stableObservers) {
+    EXPECT_GT(observer.progressCount, 0);
+    EXPECT_LE(observer.progressCount, 10001);
+    EXPECT_EQ(observer.imageCount, 1);
+  }
+  for (const auto& observer : transientObservers) {
+    EXPECT_EQ(observer.imageCount, 0);
+  }
+}
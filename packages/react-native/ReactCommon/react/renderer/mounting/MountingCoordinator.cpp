@@ -22,10 +22,95 @@
 
 namespace facebook::react {
 
+/*
+ * State of the latest diff requested on the background executor.
+ * Only one diff is tracked at a time: scheduling a new one (or revoking)
+ * invalidates the previous one, and tasks for invalidated diffs do nothing.
+ */
+struct MountingCoordinator::BackgroundDiff {
+  enum class Status { Idle, Scheduled, Running, Finished };
+
+  std::mutex mutex;
+  std::condition_variable signal;
+
+  // Status of the diff identified by `generation`.
+  uint64_t generation{0};
+  Status status{Status::Idle};
+
+  // Number of tasks diffing (and retaining shadow nodes) right now, which
+  // might be for previous generations.
+  size_t runningTaskCount{0};
+
+  RootShadowNode::Shared oldRootShadowNode;
+  RootShadowNode::Shared newRootShadowNode;
+
+  ShadowViewMutation::List mutations;
+  TelemetryTimePoint startTime{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint endTime{kTelemetryUndefinedTimePoint};
+
+  // Must be called with `mutex` held.
+  void reset() {
+    generation++;
+    status = Status::Idle;
+    oldRootShadowNode.reset();
+    newRootShadowNode.reset();
+    mutations.clear();
+  }
+
+  static void run(
+      const std::shared_ptr<BackgroundDiff>& backgroundDiff,
+      uint64_t generation) {
+    auto& self = *backgroundDiff;
+
+    auto oldRootShadowNode = RootShadowNode::Shared{};
+    auto newRootShadowNode = RootShadowNode::Shared{};
+    {
+      std::scoped_lock lock(self.mutex);
+      if (self.generation != generation || self.status != Status::Scheduled) {
+        return;
+      }
+      self.status = Status::Running;
+      self.runningTaskCount++;
+      oldRootShadowNode = self.oldRootShadowNode;
+      newRootShadowNode = self.newRootShadowNode;
+    }
+
+    {
+      TraceSection section("MountingCoordinator::backgroundDiff");
+
+      auto startTime = telemetryTimePointNow();
+      auto mutations =
+          calculateShadowViewMutations(*oldRootShadowNode, *newRootShadowNode);
+      auto endTime = telemetryTimePointNow();
+
+      std::scoped_lock lock(self.mutex);
+      if (self.generation == generation) {
+        self.status = Status::Finished;
+        self.mutations = std::move(mutations);
+        self.startTime = startTime;
+        self.endTime = endTime;
+      }
+    }
+
+    // Everything retained by the task (including the mutations of an
+    // invalidated diff) is released at this point.
+    oldRootShadowNode.reset();
+    newRootShadowNode.reset();
+
+    {
+      std::scoped_lock lock(self.mutex);
+      self.runningTaskCount--;
+    }
+
+    self.signal.notify_all();
+  }
+};
+
 MountingCoordinator::MountingCoordinator(const ShadowTreeRevision& baseRevision)
     : surfaceId_(baseRevision.rootShadowNode->getSurfaceId()),
       baseRevision_(baseRevision),
-      telemetryController_(*this) {
+      telemetryController_(*this),
+      backgroundDiff_(std::make_shared<BackgroundDiff>()) {
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   stubViewTree_ = buildStubViewTreeWithoutUsingDifferentiator(
       *baseRevision_.rootShadowNode);
@@ -45,6 +130,10 @@ void MountingCoordinator::push(ShadowTreeRevision revision) const {
 
     if (!lastRevision_.has_value() || lastRevision_->number < revision.number) {
       lastRevision_ = std::move(revision);
+
+      if (backgroundDiffingExecutor_) {
+        scheduleBackgroundDiff();
+      }
     }
   }
 
@@ -59,6 +148,13 @@ void MountingCoordinator::revoke() const {
   // 2. A possible call to `pullTransaction()` should return empty optional.
   baseRevision_.rootShadowNode.reset();
   lastRevision_.reset();
+
+  // A diff running in the background retains shadow nodes too.
+  std::unique_lock backgroundDiffLock(backgroundDiff_->mutex);
+  backgroundDiff_->reset();
+  backgroundDiff_->signal.wait(backgroundDiffLock, [this]() {
+    return backgroundDiff_->runningTaskCount == 0;
+  });
 }
 
 bool MountingCoordinator::waitForTransaction(
@@ -93,15 +189,18 @@ std::optional<MountingTransaction> MountingCoordinator::pullTransaction(
 
     auto telemetry = lastRevision_->telemetry;
 
-    telemetry.willDiff();
+    auto mutations = takeBackgroundDiffResult(telemetry);
+    if (!mutations.has_value()) {
+      telemetry.willDiff();
 
-    auto mutations = calculateShadowViewMutations(
-        *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
+      mutations = calculateShadowViewMutations(
+          *baseRevision_.rootShadowNode, *lastRevision_->rootShadowNode);
 
-    telemetry.didDiff();
+      telemetry.didDiff();
+    }
 
     transaction = MountingTransaction{
-        surfaceId_, number_, std::move(mutations), telemetry};
+        surfaceId_, number_, std::move(*mutations), telemetry};
   }
 
   // Override case
@@ -218,6 +317,78 @@ ShadowTreeRevision MountingCoordinator::getBaseRevision() const {
   return baseRevision_;
 }
 
+void MountingCoordinator::setBackgroundDiffingExecutor(
+    BackgroundExecutor executor) const {
+  std::scoped_lock lock(mutex_);
+  backgroundDiffingExecutor_ = std::move(executor);
+
+  if (!backgroundDiffingExecutor_) {
+    std::scoped_lock backgroundDiffLock(backgroundDiff_->mutex);
+    backgroundDiff_->reset();
+  } else if (lastRevision_.has_value()) {
+    scheduleBackgroundDiff();
+  }
+}
+
+void MountingCoordinator::scheduleBackgroundDiff() const {
+  auto generation = uint64_t{0};
+  {
+    std::scoped_lock lock(backgroundDiff_->mutex);
+    backgroundDiff_->reset();
+    backgroundDiff_->status = BackgroundDiff::Status::Scheduled;
+    backgroundDiff_->oldRootShadowNode = baseRevision_.rootShadowNode;
+    backgroundDiff_->newRootShadowNode = lastRevision_->rootShadowNode;
+    generation = backgroundDiff_->generation;
+  }
+
+  backgroundDiffingExecutor_(
+      [backgroundDiff = backgroundDiff_, generation]() {
+        BackgroundDiff::run(backgroundDiff, generation);
+      });
+}
+
+std::optional<ShadowViewMutation::List>
+MountingCoordinator::takeBackgroundDiffResult(
+    TransactionTelemetry& telemetry) const {
+  std::unique_lock lock(backgroundDiff_->mutex);
+
+  auto& backgroundDiff = *backgroundDiff_;
+  if (backgroundDiff.status == BackgroundDiff::Status::Idle) {
+    return std::nullopt;
+  }
+
+  // The base revision can change after the diff is scheduled (e.g. by a
+  // `MountingOverrideDelegate`), so the result might not be valid anymore.
+  // Diffs that haven't started yet aren't worth waiting for either.
+  if (backgroundDiff.oldRootShadowNode != baseRevision_.rootShadowNode ||
+      backgroundDiff.newRootShadowNode != lastRevision_->rootShadowNode ||
+      backgroundDiff.status == BackgroundDiff::Status::Scheduled) {
+    backgroundDiff.reset();
+    return std::nullopt;
+  }
+
+  auto waitStartTime = telemetryTimePointNow();
+  if (backgroundDiff.status == BackgroundDiff::Status::Running) {
+    TraceSection section("MountingCoordinator::waitForBackgroundDiff");
+    auto generation = backgroundDiff.generation;
+    backgroundDiff.signal.wait(lock, [&]() {
+      return backgroundDiff.generation != generation ||
+          backgroundDiff.status != BackgroundDiff::Status::Running;
+    });
+  }
+  auto waitTime = telemetryTimePointNow() - waitStartTime;
+
+  if (backgroundDiff.status != BackgroundDiff::Status::Finished) {
+    return std::nullopt;
+  }
+
+  auto mutations = std::move(backgroundDiff.mutations);
+  telemetry.didDiffInBackground(
+      backgroundDiff.startTime, backgroundDiff.endTime, waitTime);
+  backgroundDiff.reset();
+  return mutations;
+}
+
 void MountingCoordinator::setMountingOverrideDelegate(
     std::weak_ptr<const MountingOverrideDelegate> delegate) const {
   std::scoped_lock lock(mutex_);
@@ -9,6 +9,8 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <optional>
 
 #include <react/renderer/debug/flags.h>
@@ -33,6 +35,11 @@ namespace facebook::react {
  */
 class MountingCoordinator final {
  public:
+  /*
+   * Schedules the given callback to run on a background thread.
+   */
+  using BackgroundExecutor = std::function<void(std::function<void()>&&)>;
+
   /*
    * The constructor is meant to be used only inside `ShadowTree`, and it's
    * `public` only to enable using with `std::make_shared<>`.
@@ -97,6 +104,15 @@ class MountingCoordinator final {
 
   ShadowTreeRevision getBaseRevision() const;
 
+  /*
+   * Enables diffing eagerly: every pushed revision is diffed against the base
+   * revision on the given executor, and `pullTransaction` reuses the result
+   * (waiting for it if it's in progress) as long as both revisions are still
+   * current. Otherwise it falls back to diffing synchronously.
+   * Pass `nullptr` to disable it.
+   */
+  void setBackgroundDiffingExecutor(BackgroundExecutor executor) const;
+
   /*
    * Methods from this section are meant to be used by
    * `MountingOverrideDelegate` only.
@@ -125,6 +141,22 @@ class MountingCoordinator final {
    */
   void revoke() const;
 
+  struct BackgroundDiff;
+
+  /*
+   * Schedules diffing `baseRevision_` and `lastRevision_` on the background
+   * executor. Must be called with `mutex_` held.
+   */
+  void scheduleBackgroundDiff() const;
+
+  /*
+   * Returns the mutations computed in the background for `baseRevision_` and
+   * `lastRevision_` (if any), updating `telemetry` accordingly.
+   * Must be called with `mutex_` held.
+   */
+  std::optional<ShadowViewMutation::List> takeBackgroundDiffResult(
+      TransactionTelemetry& telemetry) const;
+
  private:
   const SurfaceId surfaceId_;
 
@@ -141,6 +173,12 @@ class MountingCoordinator final {
 
   TelemetryController telemetryController_;
 
+  // Protected by `mutex_`.
+  mutable BackgroundExecutor backgroundDiffingExecutor_;
+
+  // Shared with the scheduled tasks, which can outlive this object.
+  const std::shared_ptr<BackgroundDiff> backgroundDiff_;
+
 #ifdef RN_SHADOW_TREE_INTROSPECTION
   mutable StubViewTree stubViewTree_; // Protected by `mutex_`.
 #endif
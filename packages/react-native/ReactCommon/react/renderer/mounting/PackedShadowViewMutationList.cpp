@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PackedShadowViewMutationList.h"
+
+#include <react/debug/react_native_assert.h>
+
+namespace facebook::react {
+
+using Handle = PackedShadowViewMutationList::Handle;
+
+namespace {
+
+template <typename Map>
+size_t getMapRetainedSize(const Map& map) {
+  // Buckets, plus one node per entry holding the entry, a pointer to the next
+  // node and (for some implementations) the hash of the key.
+  return map.bucket_count() * sizeof(void*) +
+      map.size() *
+      (sizeof(typename Map::value_type) + sizeof(void*) + sizeof(size_t));
+}
+
+template <typename Map>
+void releaseMap(Map& map) {
+  // `clear` keeps the buckets allocated.
+  Map{}.swap(map);
+}
+
+} // namespace
+
+PackedShadowViewMutationList::PackedShadowViewMutationList()
+    : props_({nullptr}),
+      eventEmitters_({nullptr}),
+      states_({nullptr}),
+      layoutMetrics_({EmptyLayoutMetrics}) {}
+
+PackedShadowViewMutationList::PackedShadowViewMutationList(
+    const ShadowViewMutationList& mutations)
+    : PackedShadowViewMutationList() {
+  reserve(mutations.size());
+  for (const auto& mutation : mutations) {
+    push_back(mutation);
+  }
+}
+
+void PackedShadowViewMutationList::push_back(
+    const ShadowViewMutation& mutation) {
+  mutations_.push_back(PackedMutation{
+      .type = mutation.type,
+      .parentTag = mutation.parentTag,
+      .index = mutation.index,
+      .oldChildShadowView = pack(mutation.oldChildShadowView),
+      .newChildShadowView = pack(mutation.newChildShadowView)});
+}
+
+void PackedShadowViewMutationList::reserve(size_t size) {
+  mutations_.reserve(size);
+}
+
+void PackedShadowViewMutationList::finalize() {
+  releaseMap(propsHandles_);
+  releaseMap(eventEmitterHandles_);
+  releaseMap(stateHandles_);
+  releaseMap(layoutMetricsHandlesByTag_);
+}
+
+size_t PackedShadowViewMutationList::size() const {
+  return mutations_.size();
+}
+
+bool PackedShadowViewMutationList::empty() const {
+  return mutations_.empty();
+}
+
+const std::vector<PackedShadowViewMutationList::PackedMutation>&
+PackedShadowViewMutationList::getPackedMutations() const {
+  return mutations_;
+}
+
+const Props::Shared& PackedShadowViewMutationList::getProps(
+    Handle handle) const {
+  return props_[handle];
+}
+
+const EventEmitter::Shared& PackedShadowViewMutationList::getEventEmitter(
+    Handle handle) const {
+  return eventEmitters_[handle];
+}
+
+const State::Shared& PackedShadowViewMutationList::getState(
+    Handle handle) const {
+  return states_[handle];
+}
+
+const LayoutMetrics& PackedShadowViewMutationList::getLayoutMetrics(
+    Handle handle) const {
+  return layoutMetrics_[handle];
+}
+
+size_t PackedShadowViewMutationList::getRetainedSize() const {
+  return sizeof(PackedShadowViewMutationList) +
+      mutations_.capacity() * sizeof(PackedMutation) +
+      props_.capacity() * sizeof(Props::Shared) +
+      eventEmitters_.capacity() * sizeof(EventEmitter::Shared) +
+      states_.capacity() * sizeof(State::Shared) +
+      layoutMetrics_.capacity() * sizeof(LayoutMetrics) +
+      getMapRetainedSize(propsHandles_) +
+      getMapRetainedSize(eventEmitterHandles_) +
+      getMapRetainedSize(stateHandles_) +
+      getMapRetainedSize(layoutMetricsHandlesByTag_);
+}
+
+#pragma mark - Adapters
+
+ShadowView PackedShadowViewMutationList::unpack(
+    const PackedShadowView& shadowView) const {
+  auto result = ShadowView{};
+  result.componentName = shadowView.componentName;
+  result.componentHandle = shadowView.componentHandle;
+  result.surfaceId = shadowView.surfaceId;
+  result.tag = shadowView.tag;
+  result.traits = shadowView.traits;
+  result.props = props_[shadowView.props];
+  result.eventEmitter = eventEmitters_[shadowView.eventEmitter];
+  result.layoutMetrics = layoutMetrics_[shadowView.layoutMetrics];
+  result.state = states_[shadowView.state];
+  return result;
+}
+
+ShadowViewMutation PackedShadowViewMutationList::at(size_t index) const {
+  const auto& mutation = mutations_.at(index);
+  switch (mutation.type) {
+    case ShadowViewMutation::Create:
+      return ShadowViewMutation::CreateMutation(
+          unpack(mutation.newChildShadowView));
+    case ShadowViewMutation::Delete:
+      return ShadowViewMutation::DeleteMutation(
+          unpack(mutation.oldChildShadowView));
+    case ShadowViewMutation::Insert:
+      return ShadowViewMutation::InsertMutation(
+          mutation.parentTag,
+          unpack(mutation.newChildShadowView),
+          mutation.index);
+    case ShadowViewMutation::Remove:
+      return ShadowViewMutation::RemoveMutation(
+          mutation.parentTag,
+          unpack(mutation.oldChildShadowView),
+          mutation.index);
+    case ShadowViewMutation::Update:
+      return ShadowViewMutation::UpdateMutation(
+          unpack(mutation.oldChildShadowView),
+          unpack(mutation.newChildShadowView),
+          mutation.parentTag);
+  }
+  react_native_assert(false && "Unknown mutation type");
+  return ShadowViewMutation::CreateMutation(
+      unpack(mutation.newChildShadowView));
+}
+
+ShadowViewMutationList PackedShadowViewMutationList::unpack() const {
+  auto mutations = ShadowViewMutationList{};
+  mutations.reserve(mutations_.size());
+  for (size_t i = 0; i < mutations_.size(); i++) {
+    mutations.push_back(at(i));
+  }
+  return mutations;
+}
+
+#pragma mark - Private
+
+PackedShadowViewMutationList::PackedShadowView
+PackedShadowViewMutationList::pack(const ShadowView& shadowView) {
+  return PackedShadowView{
+      .componentName = shadowView.componentName,
+      .componentHandle = shadowView.componentHandle,
+      .surfaceId = shadowView.surfaceId,
+      .tag = shadowView.tag,
+      .traits = shadowView.traits,
+      .props = intern(shadowView.props, props_, propsHandles_),
+      .eventEmitter = intern(
+          shadowView.eventEmitter, eventEmitters_, eventEmitterHandles_),
+      .state = intern(shadowView.state, states_, stateHandles_),
+      .layoutMetrics =
+          packLayoutMetrics(shadowView.tag, shadowView.layoutMetrics)};
+}
+
+Handle PackedShadowViewMutationList::packLayoutMetrics(
+    Tag tag,
+    const LayoutMetrics& layoutMetrics) {
+  if (layoutMetrics == EmptyLayoutMetrics) {
+    return 0;
+  }
+
+  // Consecutive mutations for the same view (e.g. `Create` and `Insert`)
+  // usually carry the same layout metrics.
+  auto it = layoutMetricsHandlesByTag_.find(tag);
+  if (it != layoutMetricsHandlesByTag_.end() &&
+      layoutMetrics_[it->second] == layoutMetrics) {
+    return it->second;
+  }
+
+  auto handle = static_cast<Handle>(layoutMetrics_.size());
+  layoutMetrics_.push_back(layoutMetrics);
+  layoutMetricsHandlesByTag_[tag] = handle;
+  return handle;
+}
+
+template <typename T>
+Handle PackedShadowViewMutationList::intern(
+    const std::shared_ptr<const T>& value,
+    std::vector<std::shared_ptr<const T>>& table,
+    std::unordered_map<const T*, Handle>& handles) {
+  if (!value) {
+    return 0;
+  }
+
+  auto [it, inserted] =
+      handles.try_emplace(value.get(), static_cast<Handle>(table.size()));
+  if (inserted) {
+    table.push_back(value);
+  }
+  return it->second;
+}
+
+} // namespace facebook::react
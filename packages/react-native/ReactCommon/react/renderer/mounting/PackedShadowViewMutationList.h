@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <react/renderer/mounting/ShadowViewMutation.h>
+
+namespace facebook::react {
+
+/*
+ * Compact representation of a list of `ShadowViewMutation`s.
+ *
+ * Props, event emitters and states are stored once per list in side tables and
+ * referenced by handle, and layout metrics are stored by value once per tag
+ * (as long as they don't change), so building, copying and iterating the list
+ * doesn't touch reference counts for every view.
+ *
+ * Use `at` or `unpack` to get regular `ShadowViewMutation`s for consumers that
+ * don't support this format.
+ */
+class PackedShadowViewMutationList final {
+ public:
+  /*
+   * Index into one of the side tables. Handle `0` always refers to an empty
+   * value (`nullptr` or `EmptyLayoutMetrics`).
+   */
+  using Handle = uint32_t;
+
+  struct PackedShadowView {
+    ComponentName componentName{};
+    ComponentHandle componentHandle{};
+    SurfaceId surfaceId{};
+    Tag tag{};
+    ShadowNodeTraits traits{};
+    Handle props{0};
+    Handle eventEmitter{0};
+    Handle state{0};
+    Handle layoutMetrics{0};
+  };
+
+  struct PackedMutation {
+    ShadowViewMutation::Type type{ShadowViewMutation::Create};
+    Tag parentTag{-1};
+    int index{-1};
+    PackedShadowView oldChildShadowView{};
+    PackedShadowView newChildShadowView{};
+  };
+
+  PackedShadowViewMutationList();
+
+  /*
+   * Packs the given list of mutations.
+   */
+  explicit PackedShadowViewMutationList(
+      const ShadowViewMutationList& mutations);
+
+  void push_back(const ShadowViewMutation& mutation);
+  void reserve(size_t size);
+
+  /*
+   * Releases the memory only needed while packing. Mutations pushed afterwards
+   * don't share entries of the side tables with the ones pushed before.
+   */
+  void finalize();
+
+  size_t size() const;
+  bool empty() const;
+
+  const std::vector<PackedMutation>& getPackedMutations() const;
+
+  const Props::Shared& getProps(Handle handle) const;
+  const EventEmitter::Shared& getEventEmitter(Handle handle) const;
+  const State::Shared& getState(Handle handle) const;
+  const LayoutMetrics& getLayoutMetrics(Handle handle) const;
+
+  /*
+   * Returns the (approximate) number of bytes retained by the list itself,
+   * including the lookup tables used while packing (until `finalize` is
+   * called), but not the referenced props, event emitters and states.
+   */
+  size_t getRetainedSize() const;
+
+#pragma mark - Adapters
+
+  ShadowView unpack(const PackedShadowView& shadowView) const;
+  ShadowViewMutation at(size_t index) const;
+  ShadowViewMutationList unpack() const;
+
+ private:
+  PackedShadowView pack(const ShadowView& shadowView);
+  Handle packLayoutMetrics(Tag tag, const LayoutMetrics& layoutMetrics);
+
+  template <typename T>
+  static Handle intern(
+      const std::shared_ptr<const T>& value,
+      std::vector<std::shared_ptr<const T>>& table,
+      std::unordered_map<const T*, Handle>& handles);
+
+  std::vector<PackedMutation> mutations_;
+
+  std::vector<Props::Shared> props_;
+  std::vector<EventEmitter::Shared> eventEmitters_;
+  std::vector<State::Shared> states_;
+  std::vector<LayoutMetrics> layoutMetrics_;
+
+  // Used while packing to deduplicate the entries of the tables above, and
+  // released by `finalize`.
+  std::unordered_map<const Props*, Handle> propsHandles_;
+  std::unordered_map<const EventEmitter*, Handle> eventEmitterHandles_;
+  std::unordered_map<const State*, Handle> stateHandles_;
+  std::unordered_map<Tag, Handle> layoutMetricsHandlesByTag_;
+};
+
+} // namespace facebook::react
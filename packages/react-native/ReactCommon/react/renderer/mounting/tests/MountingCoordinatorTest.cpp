@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/MountingCoordinator.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+
+namespace facebook::react {
+
+namespace {
+
+class MountingCoordinatorTestShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode,
+      const ShadowTree::CommitOptions& /*commitOptions*/) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+} // namespace
+
+class MountingCoordinatorTest : public ::testing::Test {
+ protected:
+  MountingCoordinatorTest()
+      : builder_(simpleComponentBuilder()),
+        shadowTree_(
+            SurfaceId{11},
+            LayoutConstraints{},
+            LayoutContext{},
+            shadowTreeDelegate_,
+            contextContainer_) {
+    shadowTree_.getMountingCoordinator()->setBackgroundDiffingExecutor(
+        [this](std::function<void()>&& task) {
+          pendingTasks_.push_back(std::move(task));
+        });
+  }
+
+  /*
+   * Commits a tree with the given number of views and returns its root.
+   */
+  RootShadowNode::Shared commit(int viewCount) {
+    auto children = std::vector<ElementFragment>{};
+    for (int i = 0; i < viewCount; i++) {
+      children.push_back(Element<ViewShadowNode>().props([]() {
+        auto props = std::make_shared<ViewShadowNodeProps>();
+        props->nativeId = "view";
+        return props;
+      }));
+    }
+
+    auto rootShadowNode = std::static_pointer_cast<RootShadowNode>(
+        builder_.build(Element<RootShadowNode>().children(children))
+            ->ShadowNode::clone({}));
+
+    shadowTree_.commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return rootShadowNode;
+        },
+        {});
+
+    return shadowTree_.getCurrentRevision().rootShadowNode;
+  }
+
+  void runPendingTasks() {
+    auto tasks = std::move(pendingTasks_);
+    pendingTasks_.clear();
+    for (auto& task : tasks) {
+      task();
+    }
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer contextContainer_{};
+  MountingCoordinatorTestShadowTreeDelegate shadowTreeDelegate_{};
+  ShadowTree shadowTree_;
+  std::vector<std::function<void()>> pendingTasks_;
+};
+
+TEST_F(MountingCoordinatorTest, reusesMutationsComputedInBackground) {
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+  auto baseRootShadowNode =
+      mountingCoordinator->getBaseRevision().rootShadowNode;
+
+  auto rootShadowNode = commit(3);
+  EXPECT_EQ(pendingTasks_.size(), 1);
+
+  runPendingTasks();
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_TRUE(transaction->getTelemetry().getDiffedInBackground());
+
+  auto expectedMutations =
+      calculateShadowViewMutations(*baseRootShadowNode, *rootShadowNode);
+  const auto& mutations = transaction->getMutations();
+  ASSERT_EQ(mutations.size(), expectedMutations.size());
+  for (size_t i = 0; i < mutations.size(); i++) {
+    EXPECT_EQ(mutations[i].type, expectedMutations[i].type);
+    EXPECT_EQ(
+        mutations[i].newChildShadowView,
+        expectedMutations[i].newChildShadowView);
+  }
+}
+
+TEST_F(MountingCoordinatorTest, diffsSynchronouslyIfBackgroundDiffDidNotStart) {
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+
+  commit(3);
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_FALSE(transaction->getTelemetry().getDiffedInBackground());
+  EXPECT_FALSE(transaction->getMutations().empty());
+
+  // The scheduled task is a no-op now.
+  runPendingTasks();
+  EXPECT_FALSE(mountingCoordinator->pullTransaction().has_value());
+}
+
+TEST_F(MountingCoordinatorTest, onlyDiffsLatestRevision) {
+  auto mountingCoordinator = shadowTree_.getMountingCoordinator();
+
+  commit(3);
+  commit(5);
+  EXPECT_EQ(pendingTasks_.size(), 2);
+
+  runPendingTasks();
+
+  auto transaction = mountingCoordinator->pullTransaction();
+  ASSERT_TRUE(transaction.has_value());
+  EXPECT_TRUE(transaction->getTelemetry().getDiffedInBackground());
+
+  auto insertCount = 0;
+  for (const auto& mutation : transaction->getMutations()) {
+    if (mutation.type == ShadowViewMutation::Insert) {
+      insertCount++;
+    }
+  }
+  EXPECT_EQ(insertCount, 5);
+}
+
+} // namespace facebook::react
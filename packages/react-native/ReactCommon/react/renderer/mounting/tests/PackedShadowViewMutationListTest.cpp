@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/mounting/PackedShadowViewMutationList.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+ShadowView makeShadowView(Tag tag, Float y) {
+  auto shadowView = ShadowView{};
+  shadowView.componentName = "View";
+  shadowView.surfaceId = 1;
+  shadowView.tag = tag;
+  shadowView.props = std::make_shared<const ViewProps>();
+  shadowView.eventEmitter =
+      std::make_shared<const EventEmitter>(nullptr, EventDispatcher::Weak{});
+  shadowView.layoutMetrics.frame = {{0, y}, {100, 100}};
+  return shadowView;
+}
+
+ShadowViewMutationList makeMutations() {
+  auto parent = makeShadowView(1, 0);
+  auto child = makeShadowView(2, 0);
+  auto updatedChild = child;
+  updatedChild.layoutMetrics.frame.origin.y = 50;
+
+  return {
+      ShadowViewMutation::CreateMutation(child),
+      ShadowViewMutation::InsertMutation(parent.tag, child, 0),
+      ShadowViewMutation::UpdateMutation(child, updatedChild, parent.tag),
+      ShadowViewMutation::RemoveMutation(parent.tag, updatedChild, 0),
+      ShadowViewMutation::DeleteMutation(updatedChild),
+  };
+}
+
+void expectEqual(
+    const ShadowViewMutation& lhs,
+    const ShadowViewMutation& rhs) {
+  EXPECT_EQ(lhs.type, rhs.type);
+  EXPECT_EQ(lhs.parentTag, rhs.parentTag);
+  EXPECT_EQ(lhs.index, rhs.index);
+  EXPECT_EQ(lhs.oldChildShadowView, rhs.oldChildShadowView);
+  EXPECT_EQ(lhs.newChildShadowView, rhs.newChildShadowView);
+  EXPECT_EQ(
+      lhs.oldChildShadowView.traits.get(), rhs.oldChildShadowView.traits.get());
+  EXPECT_EQ(
+      lhs.newChildShadowView.traits.get(), rhs.newChildShadowView.traits.get());
+}
+
+} // namespace
+
+TEST(PackedShadowViewMutationListTest, unpacksToOriginalMutations) {
+  auto mutations = makeMutations();
+  auto packedMutations = PackedShadowViewMutationList{mutations};
+
+  ASSERT_EQ(packedMutations.size(), mutations.size());
+
+  auto unpackedMutations = packedMutations.unpack();
+  ASSERT_EQ(unpackedMutations.size(), mutations.size());
+  for (size_t i = 0; i < mutations.size(); i++) {
+    expectEqual(unpackedMutations[i], mutations[i]);
+  }
+}
+
+TEST(PackedShadowViewMutationListTest, deduplicatesSharedValues) {
+  auto packedMutations = PackedShadowViewMutationList{makeMutations()};
+  const auto& mutations = packedMutations.getPackedMutations();
+
+  const auto& created = mutations[0].newChildShadowView;
+  const auto& inserted = mutations[1].newChildShadowView;
+  const auto& updated = mutations[2].newChildShadowView;
+  const auto& deleted = mutations[4].oldChildShadowView;
+
+  // `Create` and `Insert` reference the same values.
+  EXPECT_EQ(created.props, inserted.props);
+  EXPECT_EQ(created.eventEmitter, inserted.eventEmitter);
+  EXPECT_EQ(created.layoutMetrics, inserted.layoutMetrics);
+
+  // New layout metrics get a new entry, which is reused afterwards.
+  EXPECT_NE(created.layoutMetrics, updated.layoutMetrics);
+  EXPECT_EQ(updated.layoutMetrics, deleted.layoutMetrics);
+
+  // Empty values always use the null handle.
+  EXPECT_EQ(mutations[0].oldChildShadowView.props, 0);
+  EXPECT_EQ(mutations[0].oldChildShadowView.layoutMetrics, 0);
+  EXPECT_EQ(packedMutations.getProps(0), nullptr);
+}
+
+TEST(PackedShadowViewMutationListTest, finalizeReleasesLookupTables) {
+  auto packedMutations = PackedShadowViewMutationList{makeMutations()};
+  auto retainedSize = packedMutations.getRetainedSize();
+
+  packedMutations.finalize();
+  EXPECT_LT(packedMutations.getRetainedSize(), retainedSize);
+
+  // Finalized lists can still be unpacked.
+  auto unpackedMutations = packedMutations.unpack();
+  auto mutations = makeMutations();
+  ASSERT_EQ(unpackedMutations.size(), mutations.size());
+  EXPECT_EQ(
+      unpackedMutations[2].newChildShadowView.layoutMetrics,
+      mutations[2].newChildShadowView.layoutMetrics);
+}
+
+} // namespace facebook::react
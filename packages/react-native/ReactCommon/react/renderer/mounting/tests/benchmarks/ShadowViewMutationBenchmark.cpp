@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/mounting/PackedShadowViewMutationList.h>
+#include <react/renderer/mounting/ShadowViewMutation.h>
+#include <memory>
+
+namespace facebook::react {
+
+/*
+ * Mutations of an initial render of `viewCount` views followed by a relayout
+ * of all of them: `Create` and `Insert` for every view, then `Update`.
+ */
+static ShadowViewMutationList initialRenderMutations(int viewCount) {
+  auto mutations = ShadowViewMutationList{};
+  mutations.reserve(viewCount * 3);
+
+  for (int i = 0; i < viewCount; i++) {
+    auto shadowView = ShadowView{};
+    shadowView.componentName = "View";
+    shadowView.surfaceId = 1;
+    shadowView.tag = i + 2;
+    shadowView.props = std::make_shared<const ViewProps>();
+    shadowView.eventEmitter =
+        std::make_shared<const EventEmitter>(nullptr, EventDispatcher::Weak{});
+    shadowView.layoutMetrics.frame = {
+        {0, static_cast<Float>(i * 10)}, {100, 10}};
+
+    mutations.push_back(ShadowViewMutation::CreateMutation(shadowView));
+    mutations.push_back(ShadowViewMutation::InsertMutation(1, shadowView, i));
+  }
+
+  for (int i = 0; i < viewCount; i++) {
+    const auto& oldShadowView = mutations[i * 2].newChildShadowView;
+    auto newShadowView = oldShadowView;
+    newShadowView.layoutMetrics.frame.size.height = 20;
+    mutations.push_back(
+        ShadowViewMutation::UpdateMutation(oldShadowView, newShadowView, 1));
+  }
+
+  return mutations;
+}
+
+static size_t retainedSize(const ShadowViewMutationList& mutations) {
+  return sizeof(ShadowViewMutationList) +
+      mutations.capacity() * sizeof(ShadowViewMutation);
+}
+
+static void copyMutationList(benchmark::State& state) {
+  auto mutations = initialRenderMutations(state.range(0));
+  for (auto _ : state) {
+    auto copy = mutations;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["bytes"] = retainedSize(mutations);
+}
+BENCHMARK(copyMutationList)->Arg(1000)->Arg(10000);
+
+static void packMutationList(benchmark::State& state) {
+  auto mutations = initialRenderMutations(state.range(0));
+  for (auto _ : state) {
+    auto packedMutations = PackedShadowViewMutationList{mutations};
+    benchmark::DoNotOptimize(packedMutations);
+  }
+}
+BENCHMARK(packMutationList)->Arg(1000)->Arg(10000);
+
+static void copyPackedMutationList(benchmark::State& state) {
+  auto packedMutations =
+      PackedShadowViewMutationList{initialRenderMutations(state.range(0))};
+  // The lookup tables are only needed while packing.
+  packedMutations.finalize();
+  for (auto _ : state) {
+    auto copy = packedMutations;
+    benchmark::DoNotOptimize(copy);
+  }
+  state.counters["bytes"] = packedMutations.getRetainedSize();
+}
+BENCHMARK(copyPackedMutationList)->Arg(1000)->Arg(10000);
+
+static void iterateMutationList(benchmark::State& state) {
+  auto mutations = initialRenderMutations(state.range(0));
+  for (auto _ : state) {
+    Float height = 0;
+    for (const auto& mutation : mutations) {
+      height += mutation.newChildShadowView.layoutMetrics.frame.size.height;
+    }
+    benchmark::DoNotOptimize(height);
+  }
+}
+BENCHMARK(iterateMutationList)->Arg(1000)->Arg(10000);
+
+static void iteratePackedMutationList(benchmark::State& state) {
+  auto packedMutations =
+      PackedShadowViewMutationList{initialRenderMutations(state.range(0))};
+  for (auto _ : state) {
+    Float height = 0;
+    for (const auto& mutation : packedMutations.getPackedMutations()) {
+      height += packedMutations
+                    .getLayoutMetrics(mutation.newChildShadowView.layoutMetrics)
+                    .frame.size.height;
+    }
+    benchmark::DoNotOptimize(height);
+  }
+}
+BENCHMARK(iteratePackedMutationList)->Arg(1000)->Arg(10000);
+
+static void unpackMutationList(benchmark::State& state) {
+  auto packedMutations =
+      PackedShadowViewMutationList{initialRenderMutations(state.range(0))};
+  for (auto _ : state) {
+    auto mutations = packedMutations.unpack();
+    benchmark::DoNotOptimize(mutations);
+  }
+}
+BENCHMARK(unpackMutationList)->Arg(1000)->Arg(10000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -11,6 +11,7 @@
 #include <react/renderer/core/ShadowNodeFamily.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Rect.h>
+#include <atomic>
 #include <memory>
 #include "IntersectionObserverState.h"
 
@@ -60,10 +61,28 @@ class IntersectionObserver {
     return targetShadowNodeFamily_;
   }
 
+  std::optional<ShadowNodeFamily::Shared> getObservationRootShadowNodeFamily()
+      const {
+    return observationRootShadowNodeFamily_;
+  }
+
   std::vector<Float> getThresholds() const {
     return thresholds_;
   }
 
+  /*
+   * Whether the observation was computed at least once for a mounted revision
+   * of the shadow tree. Until then, it needs to be computed on every mount
+   * even if the layout of the target didn't change.
+   */
+  bool hasMountedObservation() const {
+    return hasMountedObservation_;
+  }
+
+  void setHasMountedObservation() {
+    hasMountedObservation_ = true;
+  }
+
  private:
   std::optional<IntersectionObserverEntry> setIntersectingState(
       const Rect& rootBoundingRect,
@@ -86,6 +105,7 @@ class IntersectionObserver {
   std::optional<std::vector<Float>> rootThresholds_;
   mutable IntersectionObserverState state_ =
       IntersectionObserverState::Initial();
+  std::atomic_bool hasMountedObservation_{false};
 };
 
 } // namespace facebook::react
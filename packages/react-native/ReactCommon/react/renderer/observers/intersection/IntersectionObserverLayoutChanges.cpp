@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "IntersectionObserverLayoutChanges.h"
+#include <react/renderer/core/LayoutableShadowNode.h>
+#include <unordered_map>
+
+namespace facebook::react {
+
+namespace {
+
+bool hasGeometryChanged(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode) {
+  auto oldLayoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&oldShadowNode);
+  auto newLayoutableShadowNode =
+      dynamic_cast<const LayoutableShadowNode*>(&newShadowNode);
+
+  if (oldLayoutableShadowNode == nullptr ||
+      newLayoutableShadowNode == nullptr) {
+    return oldLayoutableShadowNode != newLayoutableShadowNode;
+  }
+
+  return oldLayoutableShadowNode->getLayoutMetrics() !=
+      newLayoutableShadowNode->getLayoutMetrics() ||
+      oldLayoutableShadowNode->getTransform() !=
+      newLayoutableShadowNode->getTransform() ||
+      oldLayoutableShadowNode->getContentOriginOffset(true) !=
+      newLayoutableShadowNode->getContentOriginOffset(true);
+}
+
+/*
+ * Compares two versions of the same node (where `nullptr` means that the node
+ * was inserted or removed).
+ */
+void collectFamiliesWithLayoutChanges(
+    const ShadowNode* oldShadowNode,
+    const ShadowNode* newShadowNode,
+    bool hasAncestorChanged,
+    const ShadowNodeFamilySet& observedFamilies,
+    ShadowNodeFamilySet& result) {
+  if (!hasAncestorChanged && oldShadowNode == newShadowNode) {
+    return;
+  }
+
+  auto hasChanged = hasAncestorChanged || oldShadowNode == nullptr ||
+      newShadowNode == nullptr ||
+      hasGeometryChanged(*oldShadowNode, *newShadowNode);
+
+  const auto& family = newShadowNode != nullptr ? newShadowNode->getFamily()
+                                                : oldShadowNode->getFamily();
+  if (hasChanged && observedFamilies.contains(&family)) {
+    result.insert(&family);
+  }
+
+  if (newShadowNode == nullptr) {
+    for (const auto& oldChild : oldShadowNode->getChildren()) {
+      collectFamiliesWithLayoutChanges(
+          oldChild.get(), nullptr, true, observedFamilies, result);
+    }
+    return;
+  }
+
+  if (oldShadowNode == nullptr) {
+    for (const auto& newChild : newShadowNode->getChildren()) {
+      collectFamiliesWithLayoutChanges(
+          nullptr, newChild.get(), true, observedFamilies, result);
+    }
+    return;
+  }
+
+  const auto& oldChildren = oldShadowNode->getChildren();
+  const auto& newChildren = newShadowNode->getChildren();
+
+  // In most cases children keep their positions, so we only index the old
+  // children by family when they don't.
+  auto oldChildrenByFamily =
+      std::unordered_map<const ShadowNodeFamily*, const ShadowNode*>{};
+  auto matchedOldChildCount = size_t{0};
+
+  for (size_t i = 0; i < newChildren.size(); i++) {
+    const auto& newChild = newChildren[i];
+    const ShadowNode* oldChild = nullptr;
+
+    if (i < oldChildren.size() &&
+        ShadowNode::sameFamily(*oldChildren[i], *newChild)) {
+      oldChild = oldChildren[i].get();
+    } else {
+      if (oldChildrenByFamily.empty()) {
+        for (const auto& child : oldChildren) {
+          oldChildrenByFamily.emplace(&child->getFamily(), child.get());
+        }
+      }
+      auto it = oldChildrenByFamily.find(&newChild->getFamily());
+      if (it != oldChildrenByFamily.end()) {
+        oldChild = it->second;
+      }
+    }
+
+    if (oldChild != nullptr) {
+      matchedOldChildCount++;
+    }
+
+    collectFamiliesWithLayoutChanges(
+        oldChild, newChild.get(), hasChanged, observedFamilies, result);
+  }
+
+  if (matchedOldChildCount == oldChildren.size()) {
+    return;
+  }
+
+  // Some children were removed.
+  auto newChildFamilies = ShadowNodeFamilySet{};
+  for (const auto& newChild : newChildren) {
+    newChildFamilies.insert(&newChild->getFamily());
+  }
+  for (const auto& oldChild : oldChildren) {
+    if (!newChildFamilies.contains(&oldChild->getFamily())) {
+      collectFamiliesWithLayoutChanges(
+          oldChild.get(), nullptr, true, observedFamilies, result);
+    }
+  }
+}
+
+} // namespace
+
+ShadowNodeFamilySet findFamiliesWithLayoutChanges(
+    const ShadowNode& oldRootShadowNode,
+    const ShadowNode& newRootShadowNode,
+    const ShadowNodeFamilySet& observedFamilies) {
+  auto result = ShadowNodeFamilySet{};
+
+  if (observedFamilies.empty()) {
+    return result;
+  }
+
+  collectFamiliesWithLayoutChanges(
+      &oldRootShadowNode,
+      &newRootShadowNode,
+      false,
+      observedFamilies,
+      result);
+
+  return result;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeFamily.h>
+#include <unordered_set>
+
+namespace facebook::react {
+
+using ShadowNodeFamilySet = std::unordered_set<const ShadowNodeFamily*>;
+
+/*
+ * Returns the families in `observedFamilies` whose position or size relative
+ * to the root could be different in `newRootShadowNode` than in
+ * `oldRootShadowNode`. That is the case for nodes that were inserted or
+ * removed, and for nodes where the layout metrics, the transform or the
+ * content offset of the node itself or of any of its ancestors changed.
+ *
+ * Subtrees shared by both revisions are skipped unless one of their ancestors
+ * changed, so the cost is proportional to the parts of the tree affected by
+ * the commits between the two revisions.
+ */
+ShadowNodeFamilySet findFamiliesWithLayoutChanges(
+    const ShadowNode& oldRootShadowNode,
+    const ShadowNode& newRootShadowNode,
+    const ShadowNodeFamilySet& observedFamilies);
+
+} // namespace facebook::react
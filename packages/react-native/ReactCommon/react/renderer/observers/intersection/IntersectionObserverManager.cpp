@@ -9,8 +9,10 @@
 #include <cxxreact/JSExecutor.h>
 #include <cxxreact/TraceSection.h>
 #include <react/debug/react_native_assert.h>
+#include <iterator>
 #include <utility>
 #include "IntersectionObserver.h"
+#include "IntersectionObserverLayoutChanges.h"
 
 namespace facebook::react {
 
@@ -33,9 +35,29 @@ RootShadowNode::Shared getRootShadowNode(
     return it->second;
   }
 }
+
+bool hasLayoutChanges(
+    const IntersectionObserver& observer,
+    const ShadowNodeFamilySet& familiesWithLayoutChanges) {
+  if (familiesWithLayoutChanges.contains(
+          observer.getTargetShadowNodeFamily().get())) {
+    return true;
+  }
+  auto observationRootShadowNodeFamily =
+      observer.getObservationRootShadowNodeFamily();
+  return observationRootShadowNodeFamily &&
+      familiesWithLayoutChanges.contains(
+             observationRootShadowNodeFamily->get());
+}
 } // namespace
 
-IntersectionObserverManager::IntersectionObserverManager() = default;
+IntersectionObserverManager::IntersectionObserverManager(
+    BackgroundExecutor backgroundExecutor)
+    : backgroundExecutor_(std::move(backgroundExecutor)) {}
+
+IntersectionObserverManager::~IntersectionObserverManager() {
+  waitForPendingAsyncUpdates();
+}
 
 void IntersectionObserverManager::observe(
     IntersectionObserverObserverId intersectionObserverId,
@@ -107,6 +129,9 @@ void IntersectionObserverManager::unobserve(
 
     if (observers.empty()) {
       observersBySurfaceId_.erase(surfaceId);
+
+      std::unique_lock lastMountedLock(lastMountedRootShadowNodesMutex_);
+      lastMountedRootShadowNodeBySurfaceId_.erase(surfaceId);
     }
   }
 
@@ -122,6 +147,17 @@ void IntersectionObserverManager::unobserve(
                   entry.sameShadowNodeFamily(*shadowNodeFamily);
             }),
         pendingEntries_.end());
+
+    // The remaining entries may have moved, so the index is rebuilt.
+    if (!pendingEntryIndices_.empty()) {
+      pendingEntryIndices_.clear();
+      for (size_t i = 0; i < pendingEntries_.size(); i++) {
+        const auto& pendingEntry = pendingEntries_[i];
+        pendingEntryIndices_[{
+            pendingEntry.intersectionObserverId,
+            pendingEntry.shadowNodeFamily.get()}] = i;
+      }
+    }
   }
 }
 
@@ -141,6 +177,7 @@ void IntersectionObserverManager::connect(
   runtimeScheduler.setIntersectionObserverDelegate(this);
   uiManager.registerMountHook(*this);
   shadowTreeRegistry_ = &uiManager.getShadowTreeRegistry();
+  runtimeScheduler_ = &runtimeScheduler;
   mountHookRegistered_ = true;
 }
 
@@ -156,7 +193,9 @@ void IntersectionObserverManager::disconnect(
 
   runtimeScheduler.setIntersectionObserverDelegate(nullptr);
   uiManager.unregisterMountHook(*this);
+  waitForPendingAsyncUpdates();
   shadowTreeRegistry_ = nullptr;
+  runtimeScheduler_ = nullptr;
   mountHookRegistered_ = false;
   notifyIntersectionObserversCallback_ = nullptr;
 }
@@ -169,6 +208,7 @@ IntersectionObserverManager::takeRecords() {
 
   std::vector<IntersectionObserverEntry> entries;
   pendingEntries_.swap(entries);
+  pendingEntryIndices_.clear();
   return entries;
 }
 
@@ -221,10 +261,7 @@ void IntersectionObserverManager::updateIntersectionObservations(
     auto entry = observer->updateIntersectionObservation(
         *rootShadowNode, HighResTimeStamp::now());
     if (entry) {
-      {
-        std::unique_lock lock(pendingEntriesMutex_);
-        pendingEntries_.push_back(std::move(entry).value());
-      }
+      addPendingEntries({std::move(entry).value()});
       notifyObserversIfNecessary();
     }
   }
@@ -238,14 +275,31 @@ void IntersectionObserverManager::shadowTreeDidMount(
     const RootShadowNode::Shared& rootShadowNode,
     HighResTimeStamp time) noexcept {
   TraceSection s("IntersectionObserverManager::shadowTreeDidMount");
+
+  if (backgroundExecutor_) {
+    scheduleAsyncUpdate([this, rootShadowNode, time]() {
+      updateIntersectionObservations(
+          rootShadowNode->getSurfaceId(), rootShadowNode, time);
+    });
+    return;
+  }
+
   updateIntersectionObservations(
-      rootShadowNode->getSurfaceId(), rootShadowNode.get(), time);
+      rootShadowNode->getSurfaceId(), rootShadowNode, time);
 }
 
 void IntersectionObserverManager::shadowTreeDidUnmount(
     SurfaceId surfaceId,
     HighResTimeStamp time) noexcept {
   TraceSection s("IntersectionObserverManager::shadowTreeDidUnmount");
+
+  if (backgroundExecutor_) {
+    scheduleAsyncUpdate([this, surfaceId, time]() {
+      updateIntersectionObservations(surfaceId, nullptr, time);
+    });
+    return;
+  }
+
   updateIntersectionObservations(surfaceId, nullptr, time);
 }
 
@@ -253,7 +307,7 @@ void IntersectionObserverManager::shadowTreeDidUnmount(
 
 void IntersectionObserverManager::updateIntersectionObservations(
     SurfaceId surfaceId,
-    const RootShadowNode* rootShadowNode,
+    const RootShadowNode::Shared& rootShadowNode,
     HighResTimeStamp time) {
   std::vector<IntersectionObserverEntry> entries;
 
@@ -266,17 +320,64 @@ void IntersectionObserverManager::updateIntersectionObservations(
       return;
     }
 
+    auto& observers = observersIt->second;
+
+    // Only kept for surfaces with observers, as it retains a whole revision.
+    // `unobserve` releases it when the last observer of the surface is
+    // removed.
+    RootShadowNode::Shared lastMountedRootShadowNode;
+    {
+      std::unique_lock lastMountedLock(lastMountedRootShadowNodesMutex_);
+      if (rootShadowNode != nullptr) {
+        lastMountedRootShadowNode = std::exchange(
+            lastMountedRootShadowNodeBySurfaceId_[surfaceId], rootShadowNode);
+      } else {
+        lastMountedRootShadowNodeBySurfaceId_.erase(surfaceId);
+      }
+    }
+
+    // Observations only need to be recomputed if the layout of their target
+    // or their root changed since the last mounted revision, so we find the
+    // nodes that changed between both revisions first.
+    auto isIncrementalUpdate =
+        rootShadowNode != nullptr && lastMountedRootShadowNode != nullptr;
+    ShadowNodeFamilySet familiesWithLayoutChanges;
+    if (isIncrementalUpdate) {
+      ShadowNodeFamilySet observedFamilies;
+      for (const auto& observer : observers) {
+        observedFamilies.insert(observer->getTargetShadowNodeFamily().get());
+        auto observationRootShadowNodeFamily =
+            observer->getObservationRootShadowNodeFamily();
+        if (observationRootShadowNodeFamily) {
+          observedFamilies.insert(observationRootShadowNodeFamily->get());
+        }
+      }
+
+      TraceSection s(
+          "IntersectionObserverManager::findFamiliesWithLayoutChanges",
+          "observedFamilyCount",
+          observedFamilies.size());
+      familiesWithLayoutChanges = findFamiliesWithLayoutChanges(
+          *lastMountedRootShadowNode, *rootShadowNode, observedFamilies);
+    }
+
     TraceSection s(
         "IntersectionObserverManager::updateIntersectionObservations(mount)",
         "observerCount",
-        observersIt->second.size());
+        observers.size(),
+        "changedFamilyCount",
+        familiesWithLayoutChanges.size());
 
-    auto& observers = observersIt->second;
     for (auto& observer : observers) {
       std::optional<IntersectionObserverEntry> entry;
 
       if (rootShadowNode != nullptr) {
+        if (isIncrementalUpdate && observer->hasMountedObservation() &&
+            !hasLayoutChanges(*observer, familiesWithLayoutChanges)) {
+          continue;
+        }
         entry = observer->updateIntersectionObservation(*rootShadowNode, time);
+        observer->setHasMountedObservation();
       } else {
         entry = observer->updateIntersectionObservationForSurfaceUnmount(time);
       }
@@ -287,13 +388,67 @@ void IntersectionObserverManager::updateIntersectionObservations(
     }
   }
 
-  {
-    std::unique_lock lock(pendingEntriesMutex_);
+  addPendingEntries(std::move(entries));
+  notifyObserversIfNecessary();
+}
+
+void IntersectionObserverManager::addPendingEntries(
+    std::vector<IntersectionObserverEntry>&& entries) {
+  if (entries.empty()) {
+    return;
+  }
+
+  std::unique_lock lock(pendingEntriesMutex_);
+
+  if (!backgroundExecutor_) {
     pendingEntries_.insert(
-        pendingEntries_.end(), entries.begin(), entries.end());
+        pendingEntries_.end(),
+        std::make_move_iterator(entries.begin()),
+        std::make_move_iterator(entries.end()));
+    return;
   }
 
-  notifyObserversIfNecessary();
+  // In async mode, observers are notified with idle priority, so several
+  // revisions can be processed before JS consumes the entries. We only keep
+  // the latest entry for each observer and target, which reflects its current
+  // state.
+  for (auto& entry : entries) {
+    auto [it, inserted] = pendingEntryIndices_.try_emplace(
+        {entry.intersectionObserverId, entry.shadowNodeFamily.get()},
+        pendingEntries_.size());
+    if (inserted) {
+      pendingEntries_.push_back(std::move(entry));
+    } else {
+      pendingEntries_[it->second] = std::move(entry);
+    }
+  }
+}
+
+void IntersectionObserverManager::scheduleAsyncUpdate(
+    std::function<void()>&& update) {
+  {
+    std::unique_lock lock(pendingAsyncUpdatesMutex_);
+    pendingAsyncUpdateCount_++;
+  }
+
+  backgroundExecutor_([this, update = std::move(update)]() {
+    {
+      TraceSection s("IntersectionObserverManager::asyncUpdate");
+      update();
+    }
+
+    {
+      std::unique_lock lock(pendingAsyncUpdatesMutex_);
+      pendingAsyncUpdateCount_--;
+    }
+    pendingAsyncUpdatesCondition_.notify_all();
+  });
+}
+
+void IntersectionObserverManager::waitForPendingAsyncUpdates() {
+  std::unique_lock lock(pendingAsyncUpdatesMutex_);
+  pendingAsyncUpdatesCondition_.wait(
+      lock, [this]() { return pendingAsyncUpdateCount_ == 0; });
 }
 
 /**
@@ -321,6 +476,24 @@ void IntersectionObserverManager::notifyObserversIfNecessary() {
 
 void IntersectionObserverManager::notifyObservers() {
   TraceSection s("IntersectionObserverManager::notifyObservers");
+
+  if (backgroundExecutor_ && runtimeScheduler_ != nullptr) {
+    // Deliver the entries when JS is idle, so observations computed for
+    // several revisions in a row are reported together.
+    // The legacy scheduler doesn't support idle tasks (and returns `nullptr`),
+    // in which case we notify immediately.
+    auto task = runtimeScheduler_->scheduleIdleTask(
+        [notifyIntersectionObserversCallback =
+             notifyIntersectionObserversCallback_](jsi::Runtime& /*runtime*/) {
+          if (notifyIntersectionObserversCallback) {
+            notifyIntersectionObserversCallback();
+          }
+        });
+    if (task != nullptr) {
+      return;
+    }
+  }
+
   notifyIntersectionObserversCallback_();
 }
 
@@ -13,7 +13,11 @@
 #include <react/renderer/runtimescheduler/RuntimeSchedulerIntersectionObserverDelegate.h>
 #include <react/renderer/uimanager/UIManager.h>
 #include <react/renderer/uimanager/UIManagerMountHook.h>
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 #include "IntersectionObserver.h"
 
@@ -23,7 +27,19 @@ class IntersectionObserverManager final
     : public UIManagerMountHook,
       public RuntimeSchedulerIntersectionObserverDelegate {
  public:
-  IntersectionObserverManager();
+  /*
+   * If a `backgroundExecutor` is provided, the observations for mounted
+   * revisions are computed asynchronously on it (against the immutable
+   * revision that was mounted) instead of synchronously in the mount hook.
+   * The executor must run the callbacks serially and in order.
+   * In this mode, the pending entries for the same observer and target are
+   * coalesced (so only the latest one is reported to JS) and observers are
+   * notified with idle priority.
+   */
+  explicit IntersectionObserverManager(
+      BackgroundExecutor backgroundExecutor = nullptr);
+
+  ~IntersectionObserverManager();
 
   void observe(
       IntersectionObserverObserverId intersectionObserverId,
@@ -80,20 +96,52 @@ class IntersectionObserverManager final
 
   mutable std::function<void()> notifyIntersectionObserversCallback_;
 
+  BackgroundExecutor backgroundExecutor_;
+  RuntimeScheduler* runtimeScheduler_{nullptr};
+
+  // Number of observation updates scheduled on `backgroundExecutor_` that
+  // haven't finished yet. We wait for them on `disconnect` and on destruction
+  // because they retain a reference to this object.
+  size_t pendingAsyncUpdateCount_{0};
+  std::mutex pendingAsyncUpdatesMutex_;
+  std::condition_variable pendingAsyncUpdatesCondition_;
+
   mutable std::vector<IntersectionObserverEntry> pendingEntries_;
   mutable std::mutex pendingEntriesMutex_;
 
+  // In async mode, the index in `pendingEntries_` of the entry for each
+  // observer and target, used to coalesce entries. Guarded by
+  // `pendingEntriesMutex_`.
+  std::map<
+      std::pair<IntersectionObserverObserverId, const ShadowNodeFamily*>,
+      size_t>
+      pendingEntryIndices_;
+
+  // The last revision of each surface that was mounted, which is the revision
+  // that all the observations of the surface were last computed for. We use it
+  // to only recompute the observations for targets whose layout changed.
+  // Only set for surfaces with observers. Guarded by `observersMutex_` (shared
+  // or unique) and by its own mutex.
+  std::unordered_map<SurfaceId, RootShadowNode::Shared>
+      lastMountedRootShadowNodeBySurfaceId_;
+  std::mutex lastMountedRootShadowNodesMutex_;
+
   mutable bool notifiedIntersectionObservers_{};
   mutable bool mountHookRegistered_{};
 
   void notifyObserversIfNecessary();
   void notifyObservers();
 
+  void scheduleAsyncUpdate(std::function<void()>&& update);
+  void waitForPendingAsyncUpdates();
+
+  void addPendingEntries(std::vector<IntersectionObserverEntry>&& entries);
+
   // Equivalent to
   // https://w3c.github.io/IntersectionObserver/#update-intersection-observations-algo
   void updateIntersectionObservations(
       SurfaceId surfaceId,
-      const RootShadowNode* rootShadowNode,
+      const RootShadowNode::Shared& rootShadowNode,
       HighResTimeStamp time);
 
   const IntersectionObserver& getRegisteredIntersectionObserver(
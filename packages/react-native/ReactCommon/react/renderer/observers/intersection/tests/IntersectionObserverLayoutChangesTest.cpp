@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/observers/intersection/IntersectionObserverLayoutChanges.h>
+#include <memory>
+
+namespace facebook::react {
+
+namespace {
+
+LayoutMetrics makeLayoutMetrics(Rect frame) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  return layoutMetrics;
+}
+
+/*
+ * Returns a new revision of `rootShadowNode` where `shadowNode` has the given
+ * frame. Its ancestors are cloned without changes.
+ */
+std::shared_ptr<ShadowNode> setFrame(
+    const ShadowNode& rootShadowNode,
+    const ShadowNode& shadowNode,
+    Rect frame) {
+  return rootShadowNode.cloneTree(
+      shadowNode.getFamily(), [&](const ShadowNode& oldShadowNode) {
+        auto clone = oldShadowNode.clone({});
+        dynamic_cast<LayoutableShadowNode&>(*clone).setLayoutMetrics(
+            makeLayoutMetrics(frame));
+        return clone;
+      });
+}
+
+} // namespace
+
+class IntersectionObserverLayoutChangesTest : public ::testing::Test {
+ protected:
+  /*
+   * <Root>
+   *   <View A>
+   *     <View B />
+   *   </View>
+   *   <View C>
+   *     <View D />
+   *   </View>
+   *   <View E>
+   *     <View F />
+   *   </View>
+   * </Root>
+   */
+  IntersectionObserverLayoutChangesTest() {
+    auto builder = simpleComponentBuilder();
+
+    // clang-format off
+    auto element =
+      Element<RootShadowNode>()
+        .reference(rootShadowNode_)
+        .finalize([](RootShadowNode &shadowNode) {
+          shadowNode.setLayoutMetrics(makeLayoutMetrics({{0, 0}, {100, 100}}));
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .reference(a_)
+            .finalize([](ViewShadowNode &shadowNode) {
+              shadowNode.setLayoutMetrics(
+                  makeLayoutMetrics({{0, 0}, {100, 30}}));
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .reference(b_)
+                .finalize([](ViewShadowNode &shadowNode) {
+                  shadowNode.setLayoutMetrics(
+                      makeLayoutMetrics({{10, 10}, {10, 10}}));
+                })
+            }),
+          Element<ViewShadowNode>()
+            .reference(c_)
+            .finalize([](ViewShadowNode &shadowNode) {
+              shadowNode.setLayoutMetrics(
+                  makeLayoutMetrics({{0, 30}, {100, 30}}));
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .reference(d_)
+                .finalize([](ViewShadowNode &shadowNode) {
+                  shadowNode.setLayoutMetrics(
+                      makeLayoutMetrics({{10, 10}, {10, 10}}));
+                })
+            }),
+          Element<ViewShadowNode>()
+            .reference(e_)
+            .finalize([](ViewShadowNode &shadowNode) {
+              shadowNode.setLayoutMetrics(
+                  makeLayoutMetrics({{0, 60}, {100, 30}}));
+            })
+            .children({
+              Element<ViewShadowNode>()
+                .reference(f_)
+                .finalize([](ViewShadowNode &shadowNode) {
+                  shadowNode.setLayoutMetrics(
+                      makeLayoutMetrics({{10, 10}, {10, 10}}));
+                })
+            })
+        });
+    // clang-format on
+
+    builder.build(element);
+  }
+
+  /*
+   * Returns a new revision of the root without `E` (and its subtree).
+   */
+  std::shared_ptr<ShadowNode> removeE() const {
+    auto children = std::make_shared<ShadowNode::ListOfShared>(
+        ShadowNode::ListOfShared{a_, c_});
+    return rootShadowNode_->ShadowNode::clone({.children = children});
+  }
+
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> a_;
+  std::shared_ptr<ViewShadowNode> b_;
+  std::shared_ptr<ViewShadowNode> c_;
+  std::shared_ptr<ViewShadowNode> d_;
+  std::shared_ptr<ViewShadowNode> e_;
+  std::shared_ptr<ViewShadowNode> f_;
+};
+
+TEST_F(IntersectionObserverLayoutChangesTest, sameRevisionHasNoChanges) {
+  auto observedFamilies = ShadowNodeFamilySet{
+      &b_->getFamily(), &d_->getFamily(), &f_->getFamily()};
+
+  EXPECT_TRUE(findFamiliesWithLayoutChanges(
+                  *rootShadowNode_, *rootShadowNode_, observedFamilies)
+                  .empty());
+}
+
+TEST_F(IntersectionObserverLayoutChangesTest, skipsUnchangedTargets) {
+  auto newRootShadowNode = setFrame(*rootShadowNode_, *d_, {{20, 20}, {5, 5}});
+
+  // `C` is cloned as the parent of `D`, but its layout didn't change, and `B`
+  // is in a subtree shared by both revisions.
+  auto observedFamilies = ShadowNodeFamilySet{
+      &b_->getFamily(), &c_->getFamily(), &d_->getFamily()};
+
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(
+          *rootShadowNode_, *newRootShadowNode, observedFamilies),
+      (ShadowNodeFamilySet{&d_->getFamily()}));
+}
+
+TEST_F(IntersectionObserverLayoutChangesTest, propagatesAncestorMoves) {
+  auto newRootShadowNode = setFrame(*rootShadowNode_, *a_, {{0, 5}, {100, 30}});
+
+  // `B` didn't change, but it moved with its parent.
+  auto observedFamilies =
+      ShadowNodeFamilySet{&b_->getFamily(), &d_->getFamily()};
+
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(
+          *rootShadowNode_, *newRootShadowNode, observedFamilies),
+      (ShadowNodeFamilySet{&b_->getFamily()}));
+}
+
+TEST_F(IntersectionObserverLayoutChangesTest, reportsRemovedTargets) {
+  auto newRootShadowNode = removeE();
+
+  auto observedFamilies = ShadowNodeFamilySet{
+      &b_->getFamily(), &e_->getFamily(), &f_->getFamily()};
+
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(
+          *rootShadowNode_, *newRootShadowNode, observedFamilies),
+      (ShadowNodeFamilySet{&e_->getFamily(), &f_->getFamily()}));
+}
+
+TEST_F(IntersectionObserverLayoutChangesTest, reportsInsertedTargets) {
+  auto oldRootShadowNode = removeE();
+
+  auto observedFamilies = ShadowNodeFamilySet{
+      &b_->getFamily(), &e_->getFamily(), &f_->getFamily()};
+
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(
+          *oldRootShadowNode, *rootShadowNode_, observedFamilies),
+      (ShadowNodeFamilySet{&e_->getFamily(), &f_->getFamily()}));
+}
+
+TEST_F(IntersectionObserverLayoutChangesTest, reportsCustomRoots) {
+  // `C` is the custom root of an observation of `D`.
+  auto observedFamilies =
+      ShadowNodeFamilySet{&c_->getFamily(), &d_->getFamily()};
+
+  // Moving the custom root moves the target too.
+  auto newRootShadowNode =
+      setFrame(*rootShadowNode_, *c_, {{0, 40}, {100, 30}});
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(
+          *rootShadowNode_, *newRootShadowNode, observedFamilies),
+      (ShadowNodeFamilySet{&c_->getFamily(), &d_->getFamily()}));
+
+  // Moving the target doesn't affect the custom root.
+  newRootShadowNode = setFrame(*rootShadowNode_, *d_, {{20, 20}, {5, 5}});
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(
+          *rootShadowNode_, *newRootShadowNode, observedFamilies),
+      (ShadowNodeFamilySet{&d_->getFamily()}));
+}
+
+TEST_F(IntersectionObserverLayoutChangesTest, comparesSubtreesOfCustomRoots) {
+  auto newRootShadowNode = setFrame(*rootShadowNode_, *d_, {{20, 20}, {5, 5}});
+  const auto& newC = *newRootShadowNode->getChildren()[1];
+
+  // Only the subtree of the custom root `C` is traversed, so `B` and `F`
+  // are never reported even if they are observed.
+  auto observedFamilies = ShadowNodeFamilySet{
+      &b_->getFamily(), &d_->getFamily(), &f_->getFamily()};
+
+  EXPECT_EQ(
+      findFamiliesWithLayoutChanges(*c_, newC, observedFamilies),
+      (ShadowNodeFamilySet{&d_->getFamily()}));
+  EXPECT_TRUE(
+      findFamiliesWithLayoutChanges(*c_, *c_, observedFamilies).empty());
+}
+
+} // namespace facebook::react
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/observers/intersection/IntersectionObserverManager.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <memory>
+
+#include "../../../runtimescheduler/tests/StubQueue.h"
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Float kViewportSize = 100;
+
+void setFrame(ShadowNode& shadowNode, Rect frame) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  static_cast<LayoutableShadowNode&>(shadowNode)
+      .setLayoutMetrics(layoutMetrics);
+}
+
+class IntersectionObserverManagerTestFeatureFlags
+    : public ReactNativeFeatureFlagsDefaults {
+ public:
+  bool enableBridgelessArchitecture() override {
+    return true;
+  }
+};
+
+} // namespace
+
+class IntersectionObserverManagerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Idle tasks are only supported by the modern RuntimeScheduler.
+    ReactNativeFeatureFlags::override(
+        std::make_unique<IntersectionObserverManagerTestFeatureFlags>());
+
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    jsQueue_ = std::make_unique<StubQueue>();
+    backgroundQueue_ = std::make_unique<StubQueue>();
+
+    RuntimeExecutor runtimeExecutor =
+        [this](std::function<void(jsi::Runtime & runtime)>&& callback) {
+          jsQueue_->runOnQueue([this, callback = std::move(callback)]() {
+            callback(*runtime_);
+          });
+        };
+
+    runtimeScheduler_ = std::make_unique<RuntimeScheduler>(runtimeExecutor);
+    uiManager_ = std::make_unique<UIManager>(
+        runtimeExecutor, std::make_shared<ContextContainer>());
+
+    intersectionObserverManager_ =
+        std::make_unique<IntersectionObserverManager>(
+            [this](std::function<void()>&& callback) {
+              backgroundQueue_->runOnQueue(std::move(callback));
+            });
+    intersectionObserverManager_->connect(
+        *runtimeScheduler_, *uiManager_, [this]() { notificationCount_++; });
+
+    auto builder = simpleComponentBuilder();
+    auto target = std::shared_ptr<ViewShadowNode>{};
+    // clang-format off
+    auto element =
+      Element<RootShadowNode>()
+        .finalize([](RootShadowNode& shadowNode) {
+          setFrame(shadowNode, {{0, 0}, {kViewportSize, kViewportSize}});
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .finalize([](ViewShadowNode& shadowNode) {
+              setFrame(shadowNode, {{0, 0}, {10, 10}});
+            })
+            .reference(target)
+        });
+    // clang-format on
+    rootShadowNode_ = builder.build(element);
+    targetFamily_ = target->getFamilyShared();
+  }
+
+  void TearDown() override {
+    backgroundQueue_->flush();
+    intersectionObserverManager_->disconnect(*runtimeScheduler_, *uiManager_);
+    intersectionObserverManager_.reset();
+    ReactNativeFeatureFlags::dangerouslyReset();
+  }
+
+  /*
+   * Returns a new revision where the target is at the given vertical offset.
+   */
+  RootShadowNode::Shared buildRevision(Float targetOffsetY) {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode_->cloneTree(
+            *targetFamily_, [&](const ShadowNode& oldShadowNode) {
+              auto newShadowNode = oldShadowNode.clone({});
+              setFrame(*newShadowNode, {{0, targetOffsetY}, {10, 10}});
+              return newShadowNode;
+            }));
+  }
+
+  void observeTarget() {
+    intersectionObserverManager_->observe(
+        1, std::nullopt, targetFamily_, {0}, std::nullopt, *uiManager_);
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::unique_ptr<StubQueue> jsQueue_;
+  std::unique_ptr<StubQueue> backgroundQueue_;
+  std::unique_ptr<RuntimeScheduler> runtimeScheduler_;
+  std::unique_ptr<UIManager> uiManager_;
+  std::unique_ptr<IntersectionObserverManager> intersectionObserverManager_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  ShadowNodeFamily::Shared targetFamily_;
+  int notificationCount_{0};
+};
+
+TEST_F(IntersectionObserverManagerTest, computesObservationsInBackground) {
+  observeTarget();
+
+  intersectionObserverManager_->shadowTreeDidMount(
+      buildRevision(0), HighResTimeStamp::now());
+
+  // Nothing is computed in the mount hook itself.
+  EXPECT_EQ(backgroundQueue_->size(), 1);
+  EXPECT_TRUE(intersectionObserverManager_->takeRecords().empty());
+
+  backgroundQueue_->flush();
+
+  auto entries = intersectionObserverManager_->takeRecords();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_TRUE(entries[0].isIntersectingAboveThresholds);
+  EXPECT_EQ(entries[0].targetRect, (Rect{{0, 0}, {10, 10}}));
+}
+
+TEST_F(IntersectionObserverManagerTest, coalescesEntriesPerTarget) {
+  observeTarget();
+
+  // The target enters, leaves and enters the viewport again before JS gets
+  // to process the entries.
+  for (auto offsetY : {Float{0}, Float{200}, Float{50}}) {
+    intersectionObserverManager_->shadowTreeDidMount(
+        buildRevision(offsetY), HighResTimeStamp::now());
+  }
+  backgroundQueue_->flush();
+
+  auto entries = intersectionObserverManager_->takeRecords();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_TRUE(entries[0].isIntersectingAboveThresholds);
+  EXPECT_EQ(entries[0].targetRect, (Rect{{0, 50}, {10, 10}}));
+}
+
+TEST_F(IntersectionObserverManagerTest, notifiesObserversWithIdlePriority) {
+  observeTarget();
+
+  intersectionObserverManager_->shadowTreeDidMount(
+      buildRevision(0), HighResTimeStamp::now());
+  backgroundQueue_->flush();
+
+  // The notification is scheduled in the JS thread but not dispatched yet.
+  EXPECT_EQ(notificationCount_, 0);
+  EXPECT_EQ(jsQueue_->size(), 1);
+
+  jsQueue_->flush();
+
+  EXPECT_EQ(notificationCount_, 1);
+}
+
+TEST_F(IntersectionObserverManagerTest, handlesBurstsOfRevisions) {
+  constexpr int kRevisionCount = 1000;
+
+  observeTarget();
+
+  auto mountStart = HighResTimeStamp::now();
+  for (int i = 0; i < kRevisionCount; i++) {
+    // Alternate between intersecting and not intersecting, so every revision
+    // produces a new entry.
+    intersectionObserverManager_->shadowTreeDidMount(
+        buildRevision(i % 2 == 0 ? 0 : 200), HighResTimeStamp::now());
+  }
+  auto mountDuration = HighResTimeStamp::now() - mountStart;
+
+  auto evaluationStart = HighResTimeStamp::now();
+  backgroundQueue_->flush();
+  auto evaluationDuration = HighResTimeStamp::now() - evaluationStart;
+
+  jsQueue_->flush();
+
+  // All the revisions result in a single notification with a single entry
+  // reflecting the state of the last revision.
+  EXPECT_EQ(notificationCount_, 1);
+  auto entries = intersectionObserverManager_->takeRecords();
+  ASSERT_EQ(entries.size(), 1);
+  EXPECT_FALSE(entries[0].isIntersectingAboveThresholds);
+
+  RecordProperty(
+      "mountThreadMicrosecondsPerRevision",
+      std::to_string(
+          mountDuration.toNanoseconds() / 1000.0 / kRevisionCount));
+  RecordProperty(
+      "backgroundMicrosecondsPerRevision",
+      std::to_string(
+          evaluationDuration.toNanoseconds() / 1000.0 / kRevisionCount));
+}
+
+} // namespace facebook::react
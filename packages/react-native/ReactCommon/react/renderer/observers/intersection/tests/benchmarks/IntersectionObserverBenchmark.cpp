@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/observers/intersection/IntersectionObserver.h>
+#include <react/renderer/observers/intersection/IntersectionObserverLayoutChanges.h>
+#include <memory>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kObservedTargetCount = 1000;
+constexpr Float kViewportWidth = 400;
+constexpr Float kViewportHeight = 800;
+constexpr Float kCellHeight = 50;
+
+void setFrame(ShadowNode& shadowNode, Rect frame) {
+  auto layoutMetrics = EmptyLayoutMetrics;
+  layoutMetrics.frame = frame;
+  static_cast<LayoutableShadowNode&>(shadowNode)
+      .setLayoutMetrics(layoutMetrics);
+}
+
+/*
+ * A surface with a header and a list of `kObservedTargetCount` cells, where
+ * every cell is observed by an `IntersectionObserver` (like in a virtualized
+ * list tracking impressions).
+ */
+struct ObservedList {
+  ObservedList() {
+    auto builder = simpleComponentBuilder();
+
+    auto cells = std::vector<ElementFragment>{};
+    cells.reserve(kObservedTargetCount);
+    for (int i = 0; i < kObservedTargetCount; i++) {
+      cells.push_back(
+          Element<ViewShadowNode>()
+              .finalize([i](ViewShadowNode& shadowNode) {
+                setFrame(
+                    shadowNode,
+                    {{0, static_cast<Float>(i) * kCellHeight},
+                     {kViewportWidth, kCellHeight}});
+              })
+              .reference([this](const auto& shadowNode) {
+                observers.push_back(std::make_unique<IntersectionObserver>(
+                    1,
+                    std::nullopt,
+                    shadowNode->getFamilyShared(),
+                    std::vector<Float>{0}));
+              }));
+    }
+
+    // clang-format off
+    auto element =
+      Element<RootShadowNode>()
+        .finalize([](RootShadowNode& shadowNode) {
+          setFrame(shadowNode, {{0, 0}, {kViewportWidth, kViewportHeight}});
+        })
+        .children({
+          Element<ViewShadowNode>()
+            .finalize([](ViewShadowNode& shadowNode) {
+              setFrame(shadowNode, {{0, 0}, {kViewportWidth, 100}});
+            })
+            .reference(header),
+          Element<ViewShadowNode>()
+            .finalize([](ViewShadowNode& shadowNode) {
+              setFrame(
+                  shadowNode,
+                  {{0, 100},
+                   {kViewportWidth, kObservedTargetCount * kCellHeight}});
+            })
+            .reference(list)
+            .children(cells)
+        });
+    // clang-format on
+
+    rootShadowNode = builder.build(element);
+
+    for (const auto& observer : observers) {
+      observedFamilies.insert(observer->getTargetShadowNodeFamily().get());
+      observer->updateIntersectionObservation(
+          *rootShadowNode, HighResTimeStamp::now());
+    }
+  }
+
+  /*
+   * Returns a new revision where the node of the given family was moved by
+   * `offsetY`.
+   */
+  RootShadowNode::Shared move(
+      const RootShadowNode& rootShadowNode,
+      const ShadowNodeFamily& family,
+      Float offsetY) const {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode.cloneTree(
+            family, [&](const ShadowNode& oldShadowNode) {
+              auto newShadowNode = oldShadowNode.clone({});
+              auto frame = static_cast<const LayoutableShadowNode&>(
+                               oldShadowNode)
+                               .getLayoutMetrics()
+                               .frame;
+              frame.origin.y += offsetY;
+              setFrame(*newShadowNode, frame);
+              return newShadowNode;
+            }));
+  }
+
+  std::shared_ptr<RootShadowNode> rootShadowNode;
+  std::shared_ptr<ViewShadowNode> header;
+  std::shared_ptr<ViewShadowNode> list;
+  std::vector<std::unique_ptr<IntersectionObserver>> observers;
+  ShadowNodeFamilySet observedFamilies;
+};
+
+/*
+ * Simulates the mount of a revision by recomputing all the observations
+ * (`incremental == false`) or only the ones for targets with layout changes
+ * (`incremental == true`).
+ */
+void updateObservations(
+    ObservedList& observedList,
+    const RootShadowNode& oldRootShadowNode,
+    const RootShadowNode& newRootShadowNode,
+    bool incremental,
+    benchmark::State& state) {
+  auto time = HighResTimeStamp::now();
+
+  if (!incremental) {
+    for (const auto& observer : observedList.observers) {
+      benchmark::DoNotOptimize(
+          observer->updateIntersectionObservation(newRootShadowNode, time));
+    }
+    return;
+  }
+
+  auto familiesWithLayoutChanges = findFamiliesWithLayoutChanges(
+      oldRootShadowNode, newRootShadowNode, observedList.observedFamilies);
+  for (const auto& observer : observedList.observers) {
+    if (familiesWithLayoutChanges.contains(
+            observer->getTargetShadowNodeFamily().get())) {
+      benchmark::DoNotOptimize(
+          observer->updateIntersectionObservation(newRootShadowNode, time));
+    }
+  }
+  state.counters["updatedObservations"] = benchmark::Counter(
+      static_cast<double>(familiesWithLayoutChanges.size()),
+      benchmark::Counter::kAvgIterations);
+}
+
+} // namespace
+
+/*
+ * Scrolling the list moves all the observed targets, so all the observations
+ * need to be recomputed in both modes.
+ */
+static void scrollObservedList(benchmark::State& state) {
+  auto incremental = state.range(0) != 0;
+  auto observedList = ObservedList{};
+  RootShadowNode::Shared rootShadowNode = observedList.rootShadowNode;
+
+  for (auto _ : state) {
+    auto newRootShadowNode = observedList.move(
+        *rootShadowNode, observedList.list->getFamily(), -kCellHeight / 10);
+    updateObservations(
+        observedList, *rootShadowNode, *newRootShadowNode, incremental, state);
+    rootShadowNode = newRootShadowNode;
+  }
+}
+BENCHMARK(scrollObservedList)->ArgName("incremental")->Arg(0)->Arg(1);
+
+/*
+ * Updating a node that doesn't contain any observed targets (e.g. a header
+ * collapsing as an overlay) doesn't require recomputing any observations in
+ * incremental mode.
+ */
+static void updateNodeOutsideObservedList(benchmark::State& state) {
+  auto incremental = state.range(0) != 0;
+  auto observedList = ObservedList{};
+  RootShadowNode::Shared rootShadowNode = observedList.rootShadowNode;
+
+  auto offsetY = Float{1};
+  for (auto _ : state) {
+    auto newRootShadowNode = observedList.move(
+        *rootShadowNode, observedList.header->getFamily(), offsetY);
+    updateObservations(
+        observedList, *rootShadowNode, *newRootShadowNode, incremental, state);
+    rootShadowNode = newRootShadowNode;
+    offsetY = -offsetY;
+  }
+}
+BENCHMARK(updateNodeOutsideObservedList)
+    ->ArgName("incremental")
+    ->Arg(0)
+    ->Arg(1);
+
+/*
+ * Moving a single cell (e.g. when its content is resized) only requires
+ * recomputing the observation of that cell in incremental mode.
+ */
+static void updateSingleObservedTarget(benchmark::State& state) {
+  auto incremental = state.range(0) != 0;
+  auto observedList = ObservedList{};
+  RootShadowNode::Shared rootShadowNode = observedList.rootShadowNode;
+  const auto& targetFamily =
+      *observedList.observers[kObservedTargetCount / 2]
+           ->getTargetShadowNodeFamily();
+
+  auto offsetY = Float{1};
+  for (auto _ : state) {
+    auto newRootShadowNode =
+        observedList.move(*rootShadowNode, targetFamily, offsetY);
+    updateObservations(
+        observedList, *rootShadowNode, *newRootShadowNode, incremental, state);
+    rootShadowNode = newRootShadowNode;
+    offsetY = -offsetY;
+  }
+}
+BENCHMARK(updateSingleObservedTarget)
+    ->ArgName("incremental")
+    ->Arg(0)
+    ->Arg(1);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
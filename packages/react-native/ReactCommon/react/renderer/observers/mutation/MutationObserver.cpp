@@ -50,21 +50,88 @@ static std::shared_ptr<const ShadowNode> getShadowNodeInTree(
   return pair->first.get().getChildren().at(pair->second);
 }
 
-static std::shared_ptr<const ShadowNode> findNodeOfSameFamily(
-    const ShadowNode::ListOfShared& list,
-    const ShadowNode& node) {
-  for (auto& current : list) {
-    if (ShadowNode::sameFamily(node, *current)) {
-      return current;
+static ShadowNodeChildrenDiff computeChildrenDiff(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode) {
+  const auto& oldChildren = oldShadowNode.getChildren();
+  const auto& newChildren = newShadowNode.getChildren();
+
+  ShadowNodeChildrenDiff diff;
+
+  // Fast path: in most commits children keep their positions, so we only
+  // need to check the common prefix for changed instances.
+  size_t index = 0;
+  for (; index < oldChildren.size() && index < newChildren.size(); index++) {
+    const auto& oldChild = oldChildren[index];
+    const auto& newChild = newChildren[index];
+    if (!ShadowNode::sameFamily(*oldChild, *newChild)) {
+      break;
+    }
+    if (oldChild != newChild) {
+      diff.updatedShadowNodes.emplace_back(oldChild, newChild);
+    }
+  }
+
+  if (index == oldChildren.size() && index == newChildren.size()) {
+    return diff;
+  }
+
+  // Match the remaining children by family, so large lists aren't compared
+  // quadratically.
+  std::unordered_map<const ShadowNodeFamily*, const ShadowNode::Shared*>
+      remainingNewChildren;
+  remainingNewChildren.reserve(newChildren.size() - index);
+  for (size_t i = index; i < newChildren.size(); i++) {
+    remainingNewChildren.emplace(&newChildren[i]->getFamily(), &newChildren[i]);
+  }
+
+  std::unordered_set<const ShadowNodeFamily*> remainingOldFamilies;
+  remainingOldFamilies.reserve(oldChildren.size() - index);
+  for (size_t i = index; i < oldChildren.size(); i++) {
+    const auto& oldChild = oldChildren[i];
+    remainingOldFamilies.insert(&oldChild->getFamily());
+
+    auto newChildIt = remainingNewChildren.find(&oldChild->getFamily());
+    if (newChildIt == remainingNewChildren.end()) {
+      diff.removedShadowNodes.push_back(oldChild);
+    } else if (*newChildIt->second != oldChild) {
+      diff.updatedShadowNodes.emplace_back(oldChild, *newChildIt->second);
+    }
+  }
+
+  for (size_t i = index; i < newChildren.size(); i++) {
+    const auto& newChild = newChildren[i];
+    if (!remainingOldFamilies.contains(&newChild->getFamily())) {
+      diff.addedShadowNodes.push_back(newChild);
     }
   }
-  return nullptr;
+
+  return diff;
+}
+
+const ShadowNodeChildrenDiff& MutationObservationContext::getChildrenDiff(
+    const ShadowNode& oldShadowNode,
+    const ShadowNode& newShadowNode) {
+  auto it = childrenDiffs_.find(&oldShadowNode);
+  if (it == childrenDiffs_.end()) {
+    it = childrenDiffs_
+             .emplace(
+                 &oldShadowNode,
+                 computeChildrenDiff(oldShadowNode, newShadowNode))
+             .first;
+  }
+  return it->second;
+}
+
+size_t MutationObservationContext::getDiffedShadowNodeCount() const {
+  return childrenDiffs_.size();
 }
 
 void MutationObserver::recordMutations(
     const RootShadowNode& oldRootShadowNode,
     const RootShadowNode& newRootShadowNode,
-    std::vector<MutationRecord>& recordedMutations) const {
+    std::vector<MutationRecord>& recordedMutations,
+    MutationObservationContext& context) const {
   // This tracks the nodes that have already been processed by this observer,
   // so we avoid unnecessary work and duplicated entries.
   SetOfShadowNodePointers processedNodes;
@@ -78,7 +145,8 @@ void MutationObserver::recordMutations(
         newRootShadowNode,
         true,
         recordedMutations,
-        processedNodes);
+        processedNodes,
+        context);
   }
 
   for (const auto& targetShadowNodeFamily :
@@ -89,7 +157,8 @@ void MutationObserver::recordMutations(
         newRootShadowNode,
         false,
         recordedMutations,
-        processedNodes);
+        processedNodes,
+        context);
   }
 }
 
@@ -99,7 +168,8 @@ void MutationObserver::recordMutationsInTarget(
     const RootShadowNode& newRootShadowNode,
     bool observeSubtree,
     std::vector<MutationRecord>& recordedMutations,
-    SetOfShadowNodePointers& processedNodes) const {
+    SetOfShadowNodePointers& processedNodes,
+    MutationObservationContext& context) const {
   // If the node isnt't present in the old tree, it's either:
   // - A new node. In that case, the mutation happened in its parent, not in the
   //   node itself.
@@ -125,7 +195,8 @@ void MutationObserver::recordMutationsInTarget(
       newTargetShadowNode,
       observeSubtree,
       recordedMutations,
-      processedNodes);
+      processedNodes,
+      context);
 }
 
 void MutationObserver::recordMutationsInSubtrees(
@@ -133,7 +204,8 @@ void MutationObserver::recordMutationsInSubtrees(
     const std::shared_ptr<const ShadowNode>& newNode,
     bool observeSubtree,
     std::vector<MutationRecord>& recordedMutations,
-    SetOfShadowNodePointers& processedNodes) const {
+    SetOfShadowNodePointers& processedNodes,
+    MutationObservationContext& context) const {
   bool isSameNode = oldNode.get() == newNode.get();
   // If the nodes are referentially equal, their children are also the same.
   if (isSameNode ||
@@ -143,43 +215,30 @@ void MutationObserver::recordMutationsInSubtrees(
 
   processedNodes.insert(oldNode.get());
 
-  auto oldChildren = oldNode->getChildren();
-  auto newChildren = newNode->getChildren();
-
-  std::vector<std::shared_ptr<const ShadowNode>> addedNodes;
-  std::vector<std::shared_ptr<const ShadowNode>> removedNodes;
+  // The diff is shared with other observers of the same nodes in this
+  // commit, so it's copied into the record instead of moved.
+  const auto& diff = context.getChildrenDiff(*oldNode, *newNode);
 
-  // Check for removed nodes (and equal nodes for further inspection)
-  for (auto& oldChild : oldChildren) {
-    auto newChild = findNodeOfSameFamily(newChildren, *oldChild);
-    if (!newChild) {
-      removedNodes.push_back(oldChild);
-    } else if (observeSubtree) {
-      // Nodes are present in both tress. If `subtree` is set to true,
-      // we continue checking their children.
+  // Nodes are present in both tress. If `subtree` is set to true, we continue
+  // checking their children.
+  if (observeSubtree) {
+    for (const auto& [oldChild, newChild] : diff.updatedShadowNodes) {
       recordMutationsInSubtrees(
           oldChild,
           newChild,
           observeSubtree,
           recordedMutations,
-          processedNodes);
-    }
-  }
-
-  // Check for added nodes
-  for (auto& newChild : newChildren) {
-    auto oldChild = findNodeOfSameFamily(oldChildren, *newChild);
-    if (!oldChild) {
-      addedNodes.push_back(newChild);
+          processedNodes,
+          context);
     }
   }
 
-  if (!addedNodes.empty() || !removedNodes.empty()) {
+  if (!diff.addedShadowNodes.empty() || !diff.removedShadowNodes.empty()) {
     recordedMutations.emplace_back(MutationRecord{
         mutationObserverId_,
         oldNode,
-        std::move(addedNodes),
-        std::move(removedNodes)});
+        diff.addedShadowNodes,
+        diff.removedShadowNodes});
   }
 }
 
@@ -10,6 +10,10 @@
 #include <react/renderer/components/root/RootShadowNode.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/ShadowNodeFamily.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace facebook::react {
 
@@ -22,6 +26,42 @@ struct MutationRecord {
   std::vector<std::shared_ptr<const ShadowNode>> removedShadowNodes;
 };
 
+/*
+ * Children added, removed and updated between two revisions of the same
+ * shadow node.
+ */
+struct ShadowNodeChildrenDiff {
+  std::vector<std::shared_ptr<const ShadowNode>> addedShadowNodes;
+  std::vector<std::shared_ptr<const ShadowNode>> removedShadowNodes;
+
+  // Children present in both revisions that aren't the same instance (so
+  // their own children could have changed), in the order of the old revision.
+  std::vector<std::pair<
+      std::shared_ptr<const ShadowNode>,
+      std::shared_ptr<const ShadowNode>>>
+      updatedShadowNodes;
+};
+
+/*
+ * State shared by all the observers processing the same commit.
+ * The children of each node are compared at most once per commit, regardless
+ * of how many observers (or observed targets) include that node.
+ */
+class MutationObservationContext {
+ public:
+  const ShadowNodeChildrenDiff& getChildrenDiff(
+      const ShadowNode& oldShadowNode,
+      const ShadowNode& newShadowNode);
+
+  size_t getDiffedShadowNodeCount() const;
+
+ private:
+  // Keyed by the node in the old revision. There can only be one node of the
+  // same family in the new revision, so that identifies the pair.
+  std::unordered_map<const ShadowNode*, ShadowNodeChildrenDiff>
+      childrenDiffs_;
+};
+
 class MutationObserver {
  public:
   explicit MutationObserver(MutationObserverId mutationObserverId);
@@ -45,7 +85,8 @@ class MutationObserver {
   void recordMutations(
       const RootShadowNode& oldRootShadowNode,
       const RootShadowNode& newRootShadowNode,
-      std::vector<MutationRecord>& recordedMutations) const;
+      std::vector<MutationRecord>& recordedMutations,
+      MutationObservationContext& context) const;
 
  private:
   MutationObserverId mutationObserverId_;
@@ -62,14 +103,16 @@ class MutationObserver {
       const RootShadowNode& newRootShadowNode,
       bool observeSubtree,
       std::vector<MutationRecord>& recordedMutations,
-      SetOfShadowNodePointers& processedNodes) const;
+      SetOfShadowNodePointers& processedNodes,
+      MutationObservationContext& context) const;
 
   void recordMutationsInSubtrees(
       const std::shared_ptr<const ShadowNode>& oldNode,
       const std::shared_ptr<const ShadowNode>& newNode,
       bool observeSubtree,
       std::vector<MutationRecord>& recordedMutations,
-      SetOfShadowNodePointers& processedNodes) const;
+      SetOfShadowNodePointers& processedNodes,
+      MutationObservationContext& context) const;
 };
 
 } // namespace facebook::react
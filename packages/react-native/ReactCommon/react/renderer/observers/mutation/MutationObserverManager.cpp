@@ -7,6 +7,8 @@
 
 #include "MutationObserverManager.h"
 #include <cxxreact/TraceSection.h>
+#include <jsinspector-modern/tracing/PerformanceTracer.h>
+#include <react/timing/primitives.h>
 #include <utility>
 #include "MutationObserver.h"
 
@@ -112,12 +114,28 @@ void MutationObserverManager::runMutationObservations(
     return;
   }
 
+  auto start = HighResTimeStamp::now();
+
   std::vector<MutationRecord> mutationRecords;
+  MutationObservationContext context;
 
   auto& observers = observersIt->second;
   for (const auto& [mutationObserverId, observer] : observers) {
     observer.recordMutations(
-        oldRootShadowNode, newRootShadowNode, mutationRecords);
+        oldRootShadowNode, newRootShadowNode, mutationRecords, context);
+  }
+
+  // Reports the cost of the commit as a counter in performance traces.
+  auto& tracer = jsinspector_modern::tracing::PerformanceTracer::getInstance();
+  if (tracer.isTracing()) {
+    auto end = HighResTimeStamp::now();
+    tracer.reportCounters(
+        "Mutation observers",
+        end,
+        folly::dynamic::object(
+            "duration", (end - start).toDOMHighResTimeStamp())(
+            "diffedShadowNodes", context.getDiffedShadowNodeCount())(
+            "mutationRecords", mutationRecords.size()));
   }
 
   if (!mutationRecords.empty()) {
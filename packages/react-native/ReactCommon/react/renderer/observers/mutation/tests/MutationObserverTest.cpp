@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/observers/mutation/MutationObserver.h>
+#include <memory>
+
+namespace facebook::react {
+
+class MutationObserverTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    builder_ = std::make_unique<ComponentBuilder>(simpleComponentBuilder());
+
+    // clang-format off
+    auto element =
+      Element<RootShadowNode>()
+        .children({
+          Element<ViewShadowNode>()
+            .reference(container_)
+            .children({
+              Element<ViewShadowNode>()
+                .reference(childA_)
+                .children({
+                  Element<ViewShadowNode>()
+                    .reference(grandchild_)
+                }),
+              Element<ViewShadowNode>()
+                .reference(childB_),
+              Element<ViewShadowNode>()
+                .reference(childC_),
+              Element<ViewShadowNode>()
+                .reference(childD_)
+            })
+        });
+    // clang-format on
+    rootShadowNode_ = builder_->build(element);
+  }
+
+  std::shared_ptr<const RootShadowNode> cloneWithChildren(
+      const ShadowNodeFamily& family,
+      ShadowNode::ListOfShared children) {
+    return std::static_pointer_cast<const RootShadowNode>(
+        rootShadowNode_->cloneTree(
+            family, [&](const ShadowNode& oldShadowNode) {
+              return oldShadowNode.clone(
+                  {.children = std::make_shared<ShadowNode::ListOfShared>(
+                       std::move(children))});
+            }));
+  }
+
+  std::unique_ptr<ComponentBuilder> builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> container_;
+  std::shared_ptr<ViewShadowNode> childA_;
+  std::shared_ptr<ViewShadowNode> childB_;
+  std::shared_ptr<ViewShadowNode> childC_;
+  std::shared_ptr<ViewShadowNode> childD_;
+  std::shared_ptr<ViewShadowNode> grandchild_;
+};
+
+TEST_F(MutationObserverTest, recordsAddedAndRemovedChildren) {
+  auto newChild = std::shared_ptr<ViewShadowNode>{};
+  builder_->build(Element<ViewShadowNode>().reference(newChild));
+
+  // D is removed, E is added and B and C are reordered.
+  auto newRootShadowNode = cloneWithChildren(
+      container_->getFamily(), {childA_, childC_, childB_, newChild});
+
+  auto observer = MutationObserver{1};
+  observer.observe(container_->getFamilyShared(), false);
+
+  std::vector<MutationRecord> records;
+  MutationObservationContext context;
+  observer.recordMutations(
+      *rootShadowNode_, *newRootShadowNode, records, context);
+
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].mutationObserverId, 1);
+  EXPECT_EQ(records[0].targetShadowNode, container_);
+  ASSERT_EQ(records[0].addedShadowNodes.size(), 1);
+  EXPECT_EQ(records[0].addedShadowNodes[0], newChild);
+  ASSERT_EQ(records[0].removedShadowNodes.size(), 1);
+  EXPECT_EQ(records[0].removedShadowNodes[0], childD_);
+}
+
+TEST_F(MutationObserverTest, recordsMutationsInSubtreeOnlyWhenObserved) {
+  auto newRootShadowNode = cloneWithChildren(childA_->getFamily(), {});
+
+  auto shallowObserver = MutationObserver{1};
+  shallowObserver.observe(container_->getFamilyShared(), false);
+
+  auto deepObserver = MutationObserver{2};
+  deepObserver.observe(container_->getFamilyShared(), true);
+
+  std::vector<MutationRecord> records;
+  MutationObservationContext context;
+  shallowObserver.recordMutations(
+      *rootShadowNode_, *newRootShadowNode, records, context);
+
+  EXPECT_TRUE(records.empty());
+
+  deepObserver.recordMutations(
+      *rootShadowNode_, *newRootShadowNode, records, context);
+
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].mutationObserverId, 2);
+  EXPECT_EQ(records[0].targetShadowNode, childA_);
+  EXPECT_TRUE(records[0].addedShadowNodes.empty());
+  ASSERT_EQ(records[0].removedShadowNodes.size(), 1);
+  EXPECT_EQ(records[0].removedShadowNodes[0], grandchild_);
+}
+
+TEST_F(MutationObserverTest, sharesChildrenDiffsBetweenObservers) {
+  auto newRootShadowNode = cloneWithChildren(childA_->getFamily(), {});
+
+  auto firstObserver = MutationObserver{1};
+  firstObserver.observe(container_->getFamilyShared(), true);
+
+  auto secondObserver = MutationObserver{2};
+  secondObserver.observe(container_->getFamilyShared(), true);
+  secondObserver.observe(childA_->getFamilyShared(), false);
+
+  std::vector<MutationRecord> records;
+  MutationObservationContext context;
+  firstObserver.recordMutations(
+      *rootShadowNode_, *newRootShadowNode, records, context);
+  secondObserver.recordMutations(
+      *rootShadowNode_, *newRootShadowNode, records, context);
+
+  // Each observer gets its own record, but the children of the container and
+  // the changed child are only compared once.
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].mutationObserverId, 1);
+  EXPECT_EQ(records[1].mutationObserverId, 2);
+  EXPECT_EQ(context.getDiffedShadowNodeCount(), 2);
+}
+
+} // namespace facebook::react
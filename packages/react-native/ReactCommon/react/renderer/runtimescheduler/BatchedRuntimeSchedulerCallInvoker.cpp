@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "BatchedRuntimeSchedulerCallInvoker.h"
+#include "RuntimeScheduler.h"
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace facebook::react {
+
+/*
+ * Callbacks are pushed by any thread to a lock-free stack, and moved to a
+ * FIFO list, only accessed from the JS thread, when the batch is drained.
+ */
+class BatchedRuntimeSchedulerCallInvoker::Batch
+    : public std::enable_shared_from_this<Batch> {
+ public:
+  Batch(
+      std::weak_ptr<RuntimeScheduler> runtimeScheduler,
+      std::optional<SchedulerPriority> priority,
+      HighResDuration maxBatchDuration)
+      : runtimeScheduler_(std::move(runtimeScheduler)),
+        priority_(priority),
+        maxBatchDuration_(maxBatchDuration) {}
+
+  ~Batch() {
+    deleteNodes(head_.load(std::memory_order_acquire));
+    deleteNodes(pendingHead_);
+  }
+
+  void push(CallFunc&& func) {
+    auto runtimeScheduler = runtimeScheduler_.lock();
+    if (!runtimeScheduler) {
+      return;
+    }
+
+    auto node = new Node{std::move(func), nullptr};
+    auto head = head_.load(std::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!head_.compare_exchange_weak(
+        head, node, std::memory_order_release, std::memory_order_relaxed));
+
+    // Only the first callback of a batch wakes up the JS thread.
+    if (head == nullptr) {
+      schedule(*runtimeScheduler);
+    }
+  }
+
+ private:
+  struct Node {
+    CallFunc func;
+    Node* next;
+  };
+
+  static void deleteNodes(Node* node) {
+    while (node != nullptr) {
+      delete std::exchange(node, node->next);
+    }
+  }
+
+  void schedule(RuntimeScheduler& runtimeScheduler) {
+    auto callback = [self = shared_from_this()](jsi::Runtime& runtime) {
+      if (auto runtimeScheduler = self->runtimeScheduler_.lock()) {
+        self->drain(*runtimeScheduler, runtime);
+      }
+    };
+
+    if (priority_) {
+      runtimeScheduler.scheduleTask(*priority_, std::move(callback));
+    } else {
+      runtimeScheduler.scheduleWork(std::move(callback));
+    }
+  }
+
+  void takePushedNodes() {
+    auto node = head_.exchange(nullptr, std::memory_order_acquire);
+    if (node == nullptr) {
+      return;
+    }
+
+    // The stack is in reverse order of invocation.
+    auto tail = node;
+    Node* reversed = nullptr;
+    while (node != nullptr) {
+      auto next = node->next;
+      node->next = reversed;
+      reversed = node;
+      node = next;
+    }
+
+    if (pendingTail_ != nullptr) {
+      pendingTail_->next = reversed;
+    } else {
+      pendingHead_ = reversed;
+    }
+    pendingTail_ = tail;
+  }
+
+  Node* popPendingNode() {
+    auto node = pendingHead_;
+    pendingHead_ = node->next;
+    if (pendingHead_ == nullptr) {
+      pendingTail_ = nullptr;
+    }
+    return node;
+  }
+
+  void drain(RuntimeScheduler& runtimeScheduler, jsi::Runtime& runtime) {
+    if (draining_) {
+      // The batch is already being drained further up the stack, which takes
+      // the callbacks pushed in the meantime before returning.
+      return;
+    }
+    draining_ = true;
+
+    takePushedNodes();
+
+    auto start = runtimeScheduler.now();
+    while (pendingHead_ != nullptr) {
+      auto node = std::unique_ptr<Node>(popPendingNode());
+      try {
+        node->func(runtime);
+      } catch (...) {
+        draining_ = false;
+        takePushedNodes();
+        if (pendingHead_ != nullptr) {
+          schedule(runtimeScheduler);
+        }
+        throw;
+      }
+
+      // The task scheduled for callbacks pushed while draining may have run
+      // (and returned early) in a nested drain, so they can't be left in the
+      // stack: later pushes wouldn't schedule a task for them.
+      if (pendingHead_ == nullptr) {
+        takePushedNodes();
+      }
+
+      if (pendingHead_ != nullptr &&
+          runtimeScheduler.now() - start >= maxBatchDuration_) {
+        // Yield to other tasks, the remaining callbacks run in a new task.
+        schedule(runtimeScheduler);
+        break;
+      }
+    }
+
+    draining_ = false;
+  }
+
+  std::weak_ptr<RuntimeScheduler> runtimeScheduler_;
+  const std::optional<SchedulerPriority> priority_;
+  const HighResDuration maxBatchDuration_;
+
+  std::atomic<Node*> head_{nullptr};
+
+  // Only accessed from the JS thread.
+  Node* pendingHead_{nullptr};
+  Node* pendingTail_{nullptr};
+  bool draining_{false};
+};
+
+BatchedRuntimeSchedulerCallInvoker::BatchedRuntimeSchedulerCallInvoker(
+    std::weak_ptr<RuntimeScheduler> runtimeScheduler,
+    HighResDuration maxBatchDuration)
+    : runtimeScheduler_(std::move(runtimeScheduler)) {
+  batches_[0] = std::make_shared<Batch>(
+      runtimeScheduler_, std::nullopt, maxBatchDuration);
+  for (auto priority :
+       {SchedulerPriority::ImmediatePriority,
+        SchedulerPriority::UserBlockingPriority,
+        SchedulerPriority::NormalPriority,
+        SchedulerPriority::LowPriority,
+        SchedulerPriority::IdlePriority}) {
+    batches_[static_cast<size_t>(priority)] =
+        std::make_shared<Batch>(runtimeScheduler_, priority, maxBatchDuration);
+  }
+}
+
+void BatchedRuntimeSchedulerCallInvoker::invokeAsync(CallFunc&& func) noexcept {
+  batches_[0]->push(std::move(func));
+}
+
+void BatchedRuntimeSchedulerCallInvoker::invokeSync(CallFunc&& func) {
+  if (auto runtimeScheduler = runtimeScheduler_.lock()) {
+    runtimeScheduler->executeNowOnTheSameThread(
+        [func = std::move(func)](jsi::Runtime& rt) { func(rt); });
+  }
+}
+
+void BatchedRuntimeSchedulerCallInvoker::invokeAsync(
+    SchedulerPriority priority,
+    CallFunc&& func) noexcept {
+  batches_[static_cast<size_t>(priority)]->push(std::move(func));
+}
+
+} // namespace facebook::react
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <ReactCommon/CallInvoker.h>
+#include <react/timing/primitives.h>
+#include <array>
+#include <memory>
+
+namespace facebook::react {
+
+class RuntimeScheduler;
+
+/*
+ * A `RuntimeSchedulerCallInvoker` that coalesces calls: callbacks invoked
+ * from any thread are pushed to a lock-free queue per priority, and each
+ * queue is drained by a single RuntimeScheduler task, which is only scheduled
+ * when the queue goes from empty to non-empty. A burst of calls from native
+ * modules results in one task instead of one task per call.
+ *
+ * Callbacks run in the order they were invoked (per priority). To bound the
+ * latency of other work, a task stops draining once `maxBatchDuration` has
+ * elapsed and schedules another task for the remaining callbacks.
+ */
+class BatchedRuntimeSchedulerCallInvoker : public CallInvoker {
+ public:
+  static constexpr HighResDuration kDefaultMaxBatchDuration =
+      HighResDuration::fromNanoseconds(5'000'000);
+
+  explicit BatchedRuntimeSchedulerCallInvoker(
+      std::weak_ptr<RuntimeScheduler> runtimeScheduler,
+      HighResDuration maxBatchDuration = kDefaultMaxBatchDuration);
+
+  void invokeAsync(CallFunc&& func) noexcept override;
+  void invokeSync(CallFunc&& func) override;
+  void invokeAsync(SchedulerPriority priority, CallFunc&& func) noexcept
+      override;
+
+ private:
+  class Batch;
+
+  /*
+   * RuntimeScheduler is retained by the runtime. It must not be
+   * retained by anything beyond the runtime.
+   */
+  std::weak_ptr<RuntimeScheduler> runtimeScheduler_;
+
+  // Batch for calls without priority (scheduled with `scheduleWork`),
+  // followed by one batch per `SchedulerPriority`.
+  std::array<std::shared_ptr<Batch>, 6> batches_;
+};
+
+} // namespace facebook::react
@@ -101,6 +101,10 @@ void RuntimeScheduler::callExpiredTasks(jsi::Runtime& runtime) {
   return runtimeSchedulerImpl_->callExpiredTasks(runtime);
 }
 
+void RuntimeScheduler::performMicrotaskCheckpoint(jsi::Runtime& runtime) {
+  return runtimeSchedulerImpl_->performMicrotaskCheckpoint(runtime);
+}
+
 void RuntimeScheduler::scheduleRenderingUpdate(
     SurfaceId surfaceId,
     RuntimeSchedulerRenderingUpdate&& renderingUpdate) {
@@ -52,6 +52,7 @@ class RuntimeSchedulerBase {
   virtual SchedulerPriority getCurrentPriorityLevel() const noexcept = 0;
   virtual HighResTimeStamp now() const noexcept = 0;
   virtual void callExpiredTasks(jsi::Runtime& runtime) = 0;
+  virtual void performMicrotaskCheckpoint(jsi::Runtime& runtime) = 0;
   virtual void scheduleRenderingUpdate(
       SurfaceId surfaceId,
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) = 0;
@@ -163,6 +164,15 @@ class RuntimeScheduler final : RuntimeSchedulerBase {
    */
   void callExpiredTasks(jsi::Runtime& runtime) override;
 
+  /*
+   * Drains the microtask queue of the runtime, reporting the errors thrown by
+   * microtasks. Designed to be called by hosts which run several callbacks in
+   * a single task, after each of them.
+   *
+   * Thread synchronization must be enforced externally.
+   */
+  void performMicrotaskCheckpoint(jsi::Runtime& runtime) override;
+
   void scheduleRenderingUpdate(
       SurfaceId surfaceId,
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
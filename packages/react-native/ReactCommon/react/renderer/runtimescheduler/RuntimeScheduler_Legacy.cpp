@@ -11,6 +11,7 @@
 #include <ReactCommon/RuntimeExecutorSyncUIThreadUtils.h>
 #include <cxxreact/TraceSection.h>
 #include <react/renderer/consistency/ScopedShadowTreeRevisionLock.h>
+#include <react/utils/OnScopeExit.h>
 #include <utility>
 
 namespace facebook::react {
@@ -179,6 +180,46 @@ void RuntimeScheduler_Legacy::callExpiredTasks(jsi::Runtime& runtime) {
   currentPriority_ = previousPriority;
 }
 
+/**
+ * The legacy scheduler does not drain microtasks after its own tasks, but
+ * hosts which run several callbacks in a task may still do so after each of
+ * them. Errors are reported like those of tasks.
+ */
+void RuntimeScheduler_Legacy::performMicrotaskCheckpoint(
+    jsi::Runtime& runtime) {
+  if (performingMicrotaskCheckpoint_) {
+    return;
+  }
+
+  TraceSection s("RuntimeScheduler::performMicrotaskCheckpoint");
+
+  performingMicrotaskCheckpoint_ = true;
+  OnScopeExit restoreFlag([&]() { performingMicrotaskCheckpoint_ = false; });
+
+  uint8_t retries = 0;
+  // A heuristic number to guard infinite or absurd numbers of retries.
+  const static unsigned int kRetriesBound = 255;
+
+  while (retries < kRetriesBound) {
+    try {
+      if (runtime.drainMicrotasks()) {
+        break;
+      }
+    } catch (jsi::JSError& error) {
+      onTaskError_(runtime, error);
+    } catch (std::exception& ex) {
+      jsi::JSError error(
+          runtime, std::string("Non-js exception: ") + ex.what());
+      onTaskError_(runtime, error);
+    }
+    retries++;
+  }
+
+  if (retries == kRetriesBound) {
+    throw std::runtime_error("Hits microtasks retries bound.");
+  }
+}
+
 void RuntimeScheduler_Legacy::scheduleRenderingUpdate(
     SurfaceId /*surfaceId*/,
     RuntimeSchedulerRenderingUpdate&& renderingUpdate) {
@@ -120,6 +120,8 @@ class RuntimeScheduler_Legacy final : public RuntimeSchedulerBase {
    */
   void callExpiredTasks(jsi::Runtime& runtime) override;
 
+  void performMicrotaskCheckpoint(jsi::Runtime& runtime) override;
+
   void scheduleRenderingUpdate(
       SurfaceId surfaceId,
       RuntimeSchedulerRenderingUpdate&& renderingUpdate) override;
@@ -185,6 +187,8 @@ class RuntimeScheduler_Legacy final : public RuntimeSchedulerBase {
    */
   std::atomic_bool isPerformingWork_{false};
 
+  bool performingMicrotaskCheckpoint_{false};
+
   std::atomic<ShadowTreeRevisionConsistencyManager*>
       shadowTreeRevisionConsistencyManager_{nullptr};
 
@@ -131,6 +131,8 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
    */
   void callExpiredTasks(jsi::Runtime& runtime) override;
 
+  void performMicrotaskCheckpoint(jsi::Runtime& runtime) override;
+
   /**
    * Schedules a function that notifies or applies UI changes in the host
    * platform, to be executed during the "Update the rendering" step of the
@@ -201,7 +203,6 @@ class RuntimeScheduler_Modern final : public RuntimeSchedulerBase {
   void updateRendering();
 
   bool performingMicrotaskCheckpoint_{false};
-  void performMicrotaskCheckpoint(jsi::Runtime& runtime);
 
   void reportLongTasks(
       const Task& task,
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/renderer/runtimescheduler/BatchedRuntimeSchedulerCallInvoker.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "StubClock.h"
+#include "StubErrorUtils.h"
+#include "StubQueue.h"
+
+namespace facebook::react {
+
+using namespace std::chrono_literals;
+
+class BatchedRuntimeSchedulerCallInvokerTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    runtime_ = facebook::hermes::makeHermesRuntime();
+    stubErrorUtils_ = StubErrorUtils::createAndInstallIfNeeded(*runtime_);
+    stubQueue_ = std::make_unique<StubQueue>();
+    stubClock_ = std::make_unique<StubClock>();
+
+    RuntimeExecutor runtimeExecutor =
+        [this](
+            std::function<void(facebook::jsi::Runtime & runtime)>&& callback) {
+          stubQueue_->runOnQueue([this, callback = std::move(callback)]() {
+            callback(*runtime_);
+          });
+        };
+
+    runtimeScheduler_ = std::make_shared<RuntimeScheduler>(
+        runtimeExecutor,
+        [this]() -> HighResTimeStamp { return stubClock_->getNow(); });
+
+    callInvoker_ = std::make_shared<BatchedRuntimeSchedulerCallInvoker>(
+        runtimeScheduler_, HighResDuration::fromChrono(1ms));
+  }
+
+  std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
+  std::shared_ptr<StubErrorUtils> stubErrorUtils_;
+  std::unique_ptr<StubQueue> stubQueue_;
+  std::unique_ptr<StubClock> stubClock_;
+  std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
+  std::shared_ptr<BatchedRuntimeSchedulerCallInvoker> callInvoker_;
+};
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, coalescesCallsInOneTask) {
+  std::vector<int> calls;
+  for (int i = 0; i < 100; i++) {
+    callInvoker_->invokeAsync([&calls, i](jsi::Runtime&) {
+      calls.push_back(i);
+    });
+  }
+
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->flush();
+
+  ASSERT_EQ(calls.size(), 100);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(calls[i], i);
+  }
+  EXPECT_EQ(stubQueue_->size(), 0);
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, schedulesNewBatchAfterDrain) {
+  int callCount = 0;
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { callCount++; });
+  stubQueue_->flush();
+  EXPECT_EQ(callCount, 1);
+
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { callCount++; });
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { callCount++; });
+  EXPECT_EQ(stubQueue_->size(), 1);
+
+  stubQueue_->flush();
+  EXPECT_EQ(callCount, 3);
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, callsInvokedWhileDraining) {
+  std::vector<std::string> calls;
+  callInvoker_->invokeAsync([&](jsi::Runtime&) {
+    calls.emplace_back("first");
+    callInvoker_->invokeAsync(
+        [&](jsi::Runtime&) { calls.emplace_back("third"); });
+  });
+  callInvoker_->invokeAsync(
+      [&](jsi::Runtime&) { calls.emplace_back("second"); });
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(calls, (std::vector<std::string>{"first", "second", "third"}));
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, callsInvokedBeforeReentry) {
+  std::vector<std::string> calls;
+  callInvoker_->invokeAsync(
+      SchedulerPriority::ImmediatePriority, [&](jsi::Runtime& runtime) {
+        calls.emplace_back("first");
+        callInvoker_->invokeAsync(
+            SchedulerPriority::ImmediatePriority,
+            [&](jsi::Runtime&) { calls.emplace_back("second"); });
+        // Runs the task scheduled for the second call, while the batch is
+        // still being drained.
+        runtimeScheduler_->callExpiredTasks(runtime);
+      });
+  // Not expired yet, so it's left for the work loop by the nested call.
+  runtimeScheduler_->scheduleTask(
+      SchedulerPriority::LowPriority,
+      [&](jsi::Runtime&) { calls.emplace_back("low"); });
+
+  stubQueue_->flush();
+  EXPECT_EQ(calls, (std::vector<std::string>{"first", "second", "low"}));
+
+  // Later calls still wake up the batch.
+  callInvoker_->invokeAsync(
+      SchedulerPriority::ImmediatePriority,
+      [&](jsi::Runtime&) { calls.emplace_back("third"); });
+  stubQueue_->flush();
+  EXPECT_EQ(
+      calls, (std::vector<std::string>{"first", "second", "low", "third"}));
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, batchesPerPriority) {
+  std::vector<std::string> calls;
+  callInvoker_->invokeAsync(SchedulerPriority::LowPriority, [&](jsi::Runtime&) {
+    calls.emplace_back("low 1");
+  });
+  callInvoker_->invokeAsync(
+      SchedulerPriority::ImmediatePriority,
+      [&](jsi::Runtime&) { calls.emplace_back("immediate 1"); });
+  callInvoker_->invokeAsync(SchedulerPriority::LowPriority, [&](jsi::Runtime&) {
+    calls.emplace_back("low 2");
+  });
+  callInvoker_->invokeAsync(
+      SchedulerPriority::ImmediatePriority,
+      [&](jsi::Runtime&) { calls.emplace_back("immediate 2"); });
+
+  stubQueue_->flush();
+
+  EXPECT_EQ(
+      calls,
+      (std::vector<std::string>{
+          "immediate 1", "immediate 2", "low 1", "low 2"}));
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, yieldsAfterMaxBatchDuration) {
+  std::vector<std::string> calls;
+  callInvoker_->invokeAsync(
+      SchedulerPriority::NormalPriority, [&](jsi::Runtime&) {
+        calls.emplace_back("slow");
+        stubClock_->advanceTimeBy(HighResDuration::fromChrono(2ms));
+        runtimeScheduler_->scheduleTask(
+            SchedulerPriority::ImmediatePriority,
+            [&](jsi::Runtime&) { calls.emplace_back("immediate"); });
+      });
+  callInvoker_->invokeAsync(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime&) { calls.emplace_back("next"); });
+
+  stubQueue_->flush();
+
+  // The batch yields after the slow callback, so the task with a higher
+  // priority runs before the rest of the batch.
+  EXPECT_EQ(calls, (std::vector<std::string>{"slow", "immediate", "next"}));
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, errorsDoNotDropCalls) {
+  std::vector<std::string> calls;
+  callInvoker_->invokeAsync(
+      SchedulerPriority::NormalPriority, [&](jsi::Runtime& runtime) {
+        calls.emplace_back("throws");
+        throw jsi::JSError(runtime, "Test error");
+      });
+  callInvoker_->invokeAsync(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime&) { calls.emplace_back("after"); });
+
+  stubQueue_->flush();
+  EXPECT_EQ(stubErrorUtils_->getReportFatalCallCount(), 1);
+
+  // The scheduler stops its work loop when a task throws, and resumes it
+  // when the next task is scheduled.
+  callInvoker_->invokeAsync(
+      SchedulerPriority::NormalPriority,
+      [&](jsi::Runtime&) { calls.emplace_back("later"); });
+  stubQueue_->flush();
+
+  EXPECT_EQ(calls, (std::vector<std::string>{"throws", "after", "later"}));
+}
+
+TEST_F(BatchedRuntimeSchedulerCallInvokerTest, runtimeSchedulerDestroyed) {
+  bool didRun = false;
+  runtimeScheduler_.reset();
+  callInvoker_->invokeAsync([&](jsi::Runtime&) { didRun = true; });
+  stubQueue_->flush();
+  EXPECT_FALSE(didRun);
+}
+
+} // namespace facebook::react
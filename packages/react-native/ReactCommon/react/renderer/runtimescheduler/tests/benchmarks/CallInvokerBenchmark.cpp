@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/renderer/runtimescheduler/BatchedRuntimeSchedulerCallInvoker.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/renderer/runtimescheduler/RuntimeSchedulerCallInvoker.h>
+
+#include <functional>
+#include <memory>
+#include <queue>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Runs callbacks scheduled on the "JS thread" when flushed, to measure the
+ * cost of invoking calls and of running them, without thread hops. Counts
+ * how many times the JS thread is woken up.
+ */
+class BenchmarkEnvironment {
+ public:
+  BenchmarkEnvironment() : runtime_(facebook::hermes::makeHermesRuntime()) {
+    runtimeScheduler_ = std::make_shared<RuntimeScheduler>(
+        [this](std::function<void(jsi::Runtime & runtime)>&& callback) {
+          wakeUpCount_++;
+          queue_.push(std::move(callback));
+        });
+  }
+
+  void flush() {
+    while (!queue_.empty()) {
+      auto callback = std::move(queue_.front());
+      queue_.pop();
+      callback(*runtime_);
+    }
+  }
+
+  size_t wakeUpCount() const {
+    return wakeUpCount_;
+  }
+
+  std::weak_ptr<RuntimeScheduler> runtimeScheduler() const {
+    return runtimeScheduler_;
+  }
+
+ private:
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::queue<std::function<void(jsi::Runtime&)>> queue_;
+  std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
+  size_t wakeUpCount_{0};
+};
+
+template <typename CallInvokerT>
+void invokeAsync(benchmark::State& state) {
+  auto environment = BenchmarkEnvironment{};
+  auto callInvoker = CallInvokerT{environment.runtimeScheduler()};
+  auto callCount = state.range(0);
+
+  int64_t sum = 0;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < callCount; i++) {
+      callInvoker.invokeAsync([&sum, i](jsi::Runtime&) { sum += i; });
+    }
+    environment.flush();
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * callCount);
+  state.counters["wakeUps"] = benchmark::Counter(
+      static_cast<double>(environment.wakeUpCount()),
+      benchmark::Counter::kAvgIterations);
+}
+
+template <typename CallInvokerT>
+void invokeAsyncWithPriority(benchmark::State& state) {
+  auto environment = BenchmarkEnvironment{};
+  auto callInvoker = CallInvokerT{environment.runtimeScheduler()};
+  auto callCount = state.range(0);
+
+  int64_t sum = 0;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < callCount; i++) {
+      callInvoker.invokeAsync(
+          SchedulerPriority::NormalPriority,
+          [&sum, i](jsi::Runtime&) { sum += i; });
+    }
+    environment.flush();
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * callCount);
+  state.counters["wakeUps"] = benchmark::Counter(
+      static_cast<double>(environment.wakeUpCount()),
+      benchmark::Counter::kAvgIterations);
+}
+
+void runtimeSchedulerCallInvoker(benchmark::State& state) {
+  invokeAsync<RuntimeSchedulerCallInvoker>(state);
+}
+
+void batchedRuntimeSchedulerCallInvoker(benchmark::State& state) {
+  invokeAsync<BatchedRuntimeSchedulerCallInvoker>(state);
+}
+
+void runtimeSchedulerCallInvokerWithPriority(benchmark::State& state) {
+  invokeAsyncWithPriority<RuntimeSchedulerCallInvoker>(state);
+}
+
+void batchedRuntimeSchedulerCallInvokerWithPriority(benchmark::State& state) {
+  invokeAsyncWithPriority<BatchedRuntimeSchedulerCallInvoker>(state);
+}
+
+} // namespace
+
+BENCHMARK(runtimeSchedulerCallInvoker)->Arg(1)->Arg(100)->Arg(1000);
+BENCHMARK(batchedRuntimeSchedulerCallInvoker)->Arg(1)->Arg(100)->Arg(1000);
+BENCHMARK(runtimeSchedulerCallInvokerWithPriority)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(1000);
+BENCHMARK(batchedRuntimeSchedulerCallInvokerWithPriority)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(1000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -58,6 +58,19 @@ void TransactionTelemetry::didDiff() {
   diffEndTime_ = now_();
 }
 
+void TransactionTelemetry::didDiffInBackground(
+    TelemetryTimePoint startTime,
+    TelemetryTimePoint endTime,
+    TelemetryDuration waitTime) {
+  react_native_assert(diffStartTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(diffEndTime_ == kTelemetryUndefinedTimePoint);
+  react_native_assert(startTime <= endTime);
+  diffStartTime_ = startTime;
+  diffEndTime_ = endTime;
+  diffedInBackground_ = true;
+  diffWaitTime_ = waitTime;
+}
+
 void TransactionTelemetry::willLayout() {
   react_native_assert(layoutStartTime_ == kTelemetryUndefinedTimePoint);
   react_native_assert(layoutEndTime_ == kTelemetryUndefinedTimePoint);
@@ -169,4 +182,19 @@ int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
 
+bool TransactionTelemetry::getDiffedInBackground() const {
+  return diffedInBackground_;
+}
+
+TelemetryDuration TransactionTelemetry::getDiffWaitTime() const {
+  if (diffedInBackground_) {
+    return diffWaitTime_;
+  }
+  if (diffStartTime_ == kTelemetryUndefinedTimePoint ||
+      diffEndTime_ == kTelemetryUndefinedTimePoint) {
+    return TelemetryDuration{0};
+  }
+  return diffEndTime_ - diffStartTime_;
+}
+
 } // namespace facebook::react
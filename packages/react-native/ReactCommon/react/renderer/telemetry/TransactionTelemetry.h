@@ -47,6 +47,17 @@ class TransactionTelemetry final {
   void willMount();
   void didMount();
 
+  /*
+   * Records that the mutations of the transaction were computed ahead of time
+   * on a background thread (between `startTime` and `endTime`), and how long
+   * the thread pulling the transaction had to wait for them to be ready.
+   * Use instead of `willDiff` and `didDiff`.
+   */
+  void didDiffInBackground(
+      TelemetryTimePoint startTime,
+      TelemetryTimePoint endTime,
+      TelemetryDuration waitTime);
+
   void setRevisionNumber(int revisionNumber);
 
   /*
@@ -67,6 +78,15 @@ class TransactionTelemetry final {
 
   int getAffectedLayoutNodesCount() const;
 
+  bool getDiffedInBackground() const;
+
+  /*
+   * Time the thread pulling the transaction spent blocked on diffing: the
+   * whole diff if it ran synchronously, or the time waiting for the background
+   * diff to finish otherwise.
+   */
+  TelemetryDuration getDiffWaitTime() const;
+
  private:
   TelemetryTimePoint diffStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint diffEndTime_{kTelemetryUndefinedTimePoint};
@@ -85,6 +105,9 @@ class TransactionTelemetry final {
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
+
+  bool diffedInBackground_{false};
+  TelemetryDuration diffWaitTime_{0};
 };
 
 } // namespace facebook::react
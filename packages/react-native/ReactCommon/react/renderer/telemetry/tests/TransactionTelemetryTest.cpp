@@ -133,6 +133,37 @@ TEST(TransactionTelemetryTest, defaultImplementation) {
   EXPECT_GE(mountDuration, 100);
 }
 
+TEST(TransactionTelemetryTest, diffWaitTime) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+
+  telemetry.willDiff();
+  MockClock::advance_by(std::chrono::milliseconds(100));
+  telemetry.didDiff();
+
+  // Diffing synchronously blocks for the whole diff.
+  EXPECT_FALSE(telemetry.getDiffedInBackground());
+  EXPECT_EQ(telemetryDurationToMilliseconds(telemetry.getDiffWaitTime()), 100);
+
+  auto backgroundTelemetry =
+      TransactionTelemetry{[]() { return MockClock::now(); }};
+  auto diffStartTime = MockClock::now();
+  MockClock::advance_by(std::chrono::milliseconds(300));
+  auto diffEndTime = MockClock::now();
+
+  backgroundTelemetry.didDiffInBackground(
+      diffStartTime, diffEndTime, std::chrono::milliseconds(20));
+
+  EXPECT_TRUE(backgroundTelemetry.getDiffedInBackground());
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(
+          backgroundTelemetry.getDiffEndTime() -
+          backgroundTelemetry.getDiffStartTime()),
+      300);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(backgroundTelemetry.getDiffWaitTime()),
+      20);
+}
+
 TEST(TransactionTelemetryTest, abnormalUseCases) {
   // Calling `did` before `will` should crash.
   EXPECT_DEATH_IF_SUPPORTED(
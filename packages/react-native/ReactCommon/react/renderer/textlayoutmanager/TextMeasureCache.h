@@ -168,9 +168,12 @@ inline size_t textAttributesHashLayoutWise(
 inline bool areAttributedStringFragmentsEquivalentLayoutWise(
     const AttributedString::Fragment& lhs,
     const AttributedString::Fragment& rhs) {
+  // Interned strings and text attributes which are equal usually share their
+  // storage, so most comparisons don't need to look at the values.
   return lhs.string == rhs.string &&
-      areTextAttributesEquivalentLayoutWise(
-             lhs.textAttributes, rhs.textAttributes) &&
+      (&lhs.textAttributes.get() == &rhs.textAttributes.get() ||
+       areTextAttributesEquivalentLayoutWise(
+           lhs.textAttributes, rhs.textAttributes)) &&
       // LayoutMetrics of an attachment fragment affects the size of a measured
       // attributed string.
       (!lhs.isAttachment() ||
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "FontMetrics.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string_view>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Float kAscender = 0.928f;
+constexpr Float kDescender = 0.244f;
+constexpr Float kCapHeight = 0.711f;
+constexpr Float kXHeight = 0.528f;
+
+// clang-format off
+constexpr FontMetrics kSansRegular{
+    .ascender = kAscender,
+    .descender = kDescender,
+    .capHeight = kCapHeight,
+    .xHeight = kXHeight,
+    .asciiAdvances = {
+        // ' ' to '/'
+        278, 278, 355, 556, 556, 889, 667, 191,
+        333, 333, 389, 584, 278, 333, 278, 278,
+        // '0' to '9'
+        556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+        // ':' to '@'
+        278, 278, 584, 584, 584, 556, 1015,
+        // 'A' to 'Z'
+        667, 667, 722, 722, 667, 611, 778, 722, 278, 500, 667, 556, 833,
+        722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611,
+        // '[' to '`'
+        278, 278, 278, 469, 556, 333,
+        // 'a' to 'z'
+        556, 556, 500, 556, 556, 278, 556, 556, 222, 222, 500, 222, 833,
+        556, 556, 556, 556, 333, 500, 278, 556, 500, 722, 500, 500, 500,
+        // '{' to '~'
+        334, 260, 334, 584,
+    },
+};
+
+constexpr FontMetrics kSansBold{
+    .ascender = kAscender,
+    .descender = kDescender,
+    .capHeight = kCapHeight,
+    .xHeight = kXHeight,
+    .asciiAdvances = {
+        // ' ' to '/'
+        278, 333, 474, 556, 556, 889, 722, 238,
+        333, 333, 389, 584, 278, 333, 278, 278,
+        // '0' to '9'
+        556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+        // ':' to '@'
+        333, 333, 584, 584, 584, 611, 975,
+        // 'A' to 'Z'
+        722, 722, 722, 722, 667, 611, 778, 722, 278, 556, 722, 611, 833,
+        722, 778, 667, 778, 722, 667, 611, 722, 667, 944, 667, 667, 611,
+        // '[' to '`'
+        333, 278, 333, 584, 556, 333,
+        // 'a' to 'z'
+        556, 611, 556, 611, 556, 333, 611, 611, 278, 278, 556, 278, 889,
+        611, 611, 611, 611, 389, 556, 333, 611, 556, 778, 556, 556, 500,
+        // '{' to '~'
+        389, 280, 389, 584,
+    },
+};
+// clang-format on
+
+constexpr FontMetrics makeMonospace() {
+  FontMetrics metrics{
+      .ascender = kAscender,
+      .descender = kDescender,
+      .capHeight = kCapHeight,
+      .xHeight = kXHeight,
+      .asciiAdvances = {},
+  };
+  metrics.asciiAdvances.fill(600);
+  return metrics;
+}
+
+constexpr FontMetrics kMonospace = makeMonospace();
+
+bool isMonospaceFamily(std::string_view fontFamily) {
+  constexpr std::string_view kMonospaceFamilies[] = {
+      "monospace",
+      "courier",
+      "courier new",
+      "menlo",
+      "menlo-regular",
+      "monaco",
+      "consolas",
+  };
+  return std::any_of(
+      std::begin(kMonospaceFamilies),
+      std::end(kMonospaceFamilies),
+      [&](std::string_view family) {
+        return family.size() == fontFamily.size() &&
+            std::equal(
+                   family.begin(),
+                   family.end(),
+                   fontFamily.begin(),
+                   [](char a, char b) {
+                     return a == std::tolower(static_cast<unsigned char>(b));
+                   });
+      });
+}
+
+bool isInRange(char32_t codepoint, char32_t first, char32_t last) {
+  return codepoint >= first && codepoint <= last;
+}
+
+} // namespace
+
+const FontMetrics& FontMetrics::get(const TextAttributes& textAttributes) {
+  if (!textAttributes.fontFamily.empty() &&
+      isMonospaceFamily(textAttributes.fontFamily)) {
+    return kMonospace;
+  }
+  if (textAttributes.fontWeight.value_or(FontWeight::Regular) >=
+      FontWeight::Semibold) {
+    return kSansBold;
+  }
+  return kSansRegular;
+}
+
+Float FontMetrics::getAdvance(char32_t codepoint) const {
+  if (codepoint >= 0x20 && codepoint < 0x7F) {
+    return asciiAdvances[codepoint - 0x20] / 1000.0f;
+  }
+
+  // Control characters, combining marks, zero width characters and variation
+  // selectors.
+  if (codepoint < 0x20 || isInRange(codepoint, 0x7F, 0x9F) ||
+      isInRange(codepoint, 0x0300, 0x036F) ||
+      isInRange(codepoint, 0x1AB0, 0x1AFF) ||
+      isInRange(codepoint, 0x1DC0, 0x1DFF) ||
+      isInRange(codepoint, 0x200B, 0x200F) ||
+      isInRange(codepoint, 0x2028, 0x202E) ||
+      isInRange(codepoint, 0x2060, 0x2064) ||
+      isInRange(codepoint, 0x20D0, 0x20FF) ||
+      isInRange(codepoint, 0xFE00, 0xFE0F) ||
+      isInRange(codepoint, 0xFE20, 0xFE2F) || codepoint == 0xFEFF ||
+      isInRange(codepoint, 0x1F3FB, 0x1F3FF) ||
+      isInRange(codepoint, 0xE0000, 0xE01EF)) {
+    return 0;
+  }
+
+  // Spaces
+  if (codepoint == 0xA0 || codepoint == 0x202F) {
+    return asciiAdvances[0] / 1000.0f;
+  }
+  if (isInRange(codepoint, 0x2000, 0x200A) || codepoint == 0x205F) {
+    return 0.25f;
+  }
+
+  // Wide characters: Hangul, CJK, fullwidth forms and emoji.
+  if (isInRange(codepoint, 0x1100, 0x115F) ||
+      isInRange(codepoint, 0x2E80, 0x303E) ||
+      isInRange(codepoint, 0x3040, 0xA4CF) ||
+      isInRange(codepoint, 0xAC00, 0xD7A3) ||
+      isInRange(codepoint, 0xF900, 0xFAFF) ||
+      isInRange(codepoint, 0xFE30, 0xFE4F) ||
+      isInRange(codepoint, 0xFF00, 0xFF60) ||
+      isInRange(codepoint, 0xFFE0, 0xFFE6) ||
+      isInRange(codepoint, 0x1F000, 0x1FAFF) ||
+      isInRange(codepoint, 0x20000, 0x3FFFD)) {
+    return 1.0f;
+  }
+
+  // Average advance of lowercase letters, for other scripts.
+  return asciiAdvances['n' - 0x20] / 1000.0f;
+}
+
+} // namespace facebook::react
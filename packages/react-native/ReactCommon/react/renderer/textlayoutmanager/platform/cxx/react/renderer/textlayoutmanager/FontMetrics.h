@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/renderer/attributedstring/TextAttributes.h>
+#include <react/renderer/graphics/Float.h>
+
+#include <array>
+#include <cstdint>
+
+namespace facebook::react {
+
+/*
+ * Metrics of the built-in fonts of the headless text layout engine, in em
+ * units. Since no font files are available, advances of ASCII characters come
+ * from static tables of a Helvetica-like sans-serif face (regular and bold)
+ * and a fixed-pitch face for monospace families, and other characters use
+ * the average advance of their script. Vertical metrics are those of a
+ * Roboto-like face, to produce line heights close to the platforms.
+ *
+ * Instances are immutable and can be used from any thread.
+ */
+class FontMetrics final {
+ public:
+  /*
+   * Returns the metrics of the font described by `textAttributes`.
+   */
+  static const FontMetrics& get(const TextAttributes& textAttributes);
+
+  /*
+   * Horizontal advance of `codepoint`, in em units.
+   */
+  Float getAdvance(char32_t codepoint) const;
+
+  /*
+   * Distances from the baseline, in em units.
+   */
+  Float ascender;
+  Float descender;
+  Float capHeight;
+  Float xHeight;
+
+  // Advances of the printable ASCII characters, in 1/1000 em.
+  std::array<uint16_t, 95> asciiAdvances;
+};
+
+} // namespace facebook::react
@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "LineBreaker.h"
+
+#include <array>
+
+namespace facebook::react {
+
+namespace {
+
+using C = LineBreakClass;
+
+constexpr std::array<LineBreakClass, 128> makeAsciiLineBreakClasses() {
+  std::array<LineBreakClass, 128> classes{};
+  for (char32_t c = 0; c < 128; c++) {
+    if (c < 0x20 || c == 0x7F) {
+      classes[c] = C::CM;
+    } else if (c >= '0' && c <= '9') {
+      classes[c] = C::NU;
+    } else {
+      classes[c] = C::AL;
+    }
+  }
+  classes['\t'] = C::BA;
+  classes['\n'] = C::LF;
+  classes['\v'] = C::BK;
+  classes['\f'] = C::BK;
+  classes['\r'] = C::CR;
+  classes[' '] = C::SP;
+  classes['!'] = C::EX;
+  classes['"'] = C::QU;
+  classes['$'] = C::PR;
+  classes['%'] = C::PO;
+  classes['\''] = C::QU;
+  classes['('] = C::OP;
+  classes[')'] = C::CP;
+  classes['+'] = C::PR;
+  classes[','] = C::IS;
+  classes['-'] = C::HY;
+  classes['.'] = C::IS;
+  classes['/'] = C::SY;
+  classes[':'] = C::IS;
+  classes[';'] = C::IS;
+  classes['?'] = C::EX;
+  classes['['] = C::OP;
+  classes['\\'] = C::PR;
+  classes[']'] = C::CP;
+  classes['{'] = C::OP;
+  classes['|'] = C::BA;
+  classes['}'] = C::CL;
+  return classes;
+}
+
+constexpr auto kAsciiLineBreakClasses = makeAsciiLineBreakClasses();
+
+bool isInRange(char32_t codepoint, char32_t first, char32_t last) {
+  return codepoint >= first && codepoint <= last;
+}
+
+/*
+ * Pairs of classes which cannot be broken, from rules LB23 to LB30 (numbers,
+ * alphabetic and ideographic characters, and prefixes and postfixes).
+ */
+bool isUnbreakablePair(LineBreakClass before, LineBreakClass after) {
+  switch (before) {
+    case C::AL:
+      // LB24, LB28, LB30
+      return after == C::AL || after == C::NU || after == C::PR ||
+          after == C::PO || after == C::OP;
+    case C::NU:
+      // LB23, LB25, LB30
+      return after == C::AL || after == C::NU || after == C::PR ||
+          after == C::PO || after == C::OP;
+    case C::ID:
+      // LB23a
+      return after == C::PO;
+    case C::PR:
+      // LB23a, LB24, LB25
+      return after == C::ID || after == C::AL || after == C::NU ||
+          after == C::OP;
+    case C::PO:
+      // LB24, LB25
+      return after == C::AL || after == C::NU || after == C::OP;
+    case C::CL:
+      // LB25
+      return after == C::PR || after == C::PO;
+    case C::CP:
+      // LB25, LB30
+      return after == C::PR || after == C::PO || after == C::AL ||
+          after == C::NU;
+    case C::HY:
+    case C::SY:
+      // LB25
+      return after == C::NU;
+    case C::IS:
+      // LB25, LB29
+      return after == C::NU || after == C::AL;
+    default:
+      return false;
+  }
+}
+
+/*
+ * `previous` is the class of the character before `current`, and
+ * `beforeSpaces` the class of the last character before the spaces preceding
+ * `current`, if any (otherwise the same as `previous`).
+ */
+LineBreak getLineBreak(
+    LineBreakClass previous,
+    LineBreakClass beforeSpaces,
+    bool afterZWJ,
+    LineBreakClass current) {
+  // LB4, LB5
+  if (previous == C::BK || previous == C::LF || previous == C::NL) {
+    return LineBreak::Mandatory;
+  }
+  if (previous == C::CR) {
+    return current == C::LF ? LineBreak::None : LineBreak::Mandatory;
+  }
+
+  // LB6, LB7
+  if (current == C::BK || current == C::CR || current == C::LF ||
+      current == C::NL || current == C::SP || current == C::ZW) {
+    return LineBreak::None;
+  }
+
+  // LB8, LB8a
+  if (beforeSpaces == C::ZW) {
+    return LineBreak::Allowed;
+  }
+  if (afterZWJ) {
+    return LineBreak::None;
+  }
+
+  // LB9, LB10: marks after spaces are treated as alphabetic characters.
+  if (current == C::CM || current == C::ZWJ) {
+    return previous == C::SP ? LineBreak::Allowed : LineBreak::None;
+  }
+
+  // LB11, LB12, LB12a
+  if (current == C::WJ || previous == C::WJ || previous == C::GL) {
+    return LineBreak::None;
+  }
+  if (current == C::GL && previous != C::SP && previous != C::BA &&
+      previous != C::HY) {
+    return LineBreak::None;
+  }
+
+  // LB13
+  if (current == C::CL || current == C::CP || current == C::EX ||
+      current == C::IS || current == C::SY) {
+    return LineBreak::None;
+  }
+
+  // LB14, LB15, LB16
+  if (beforeSpaces == C::OP) {
+    return LineBreak::None;
+  }
+  if (beforeSpaces == C::QU && current == C::OP) {
+    return LineBreak::None;
+  }
+  if ((beforeSpaces == C::CL || beforeSpaces == C::CP) && current == C::NS) {
+    return LineBreak::None;
+  }
+
+  // LB18
+  if (previous == C::SP) {
+    return LineBreak::Allowed;
+  }
+
+  // LB19
+  if (current == C::QU || previous == C::QU) {
+    return LineBreak::None;
+  }
+
+  // LB21
+  if (current == C::BA || current == C::HY || current == C::NS ||
+      previous == C::BB) {
+    return LineBreak::None;
+  }
+
+  // LB23 to LB30
+  if (isUnbreakablePair(previous, current)) {
+    return LineBreak::None;
+  }
+
+  // LB31
+  return LineBreak::Allowed;
+}
+
+} // namespace
+
+LineBreakClass getLineBreakClass(char32_t codepoint) {
+  if (codepoint < 128) {
+    return kAsciiLineBreakClasses[codepoint];
+  }
+
+  switch (codepoint) {
+    case 0x0085:
+      return C::NL;
+    case 0x00A0:
+    case 0x0F0C:
+    case 0x180E:
+    case 0x2007:
+    case 0x2011:
+    case 0x202F:
+      return C::GL;
+    case 0x00A1:
+    case 0x00BF:
+    case 0x201A:
+    case 0x201E:
+      return C::OP;
+    case 0x00AB:
+    case 0x00BB:
+    case 0x2018:
+    case 0x2019:
+    case 0x201B:
+    case 0x201C:
+    case 0x201D:
+    case 0x201F:
+    case 0x2039:
+    case 0x203A:
+      return C::QU;
+    case 0x00AD:
+    case 0x2010:
+    case 0x2012:
+    case 0x2013:
+    case 0x2014:
+    case 0x3000:
+      return C::BA;
+    case 0x00B4:
+      return C::BB;
+    case 0x00A2:
+    case 0x00B0:
+    case 0x2030:
+    case 0x2031:
+    case 0x2032:
+    case 0x2033:
+    case 0x2103:
+    case 0x2109:
+      return C::PO;
+    case 0x00A3:
+    case 0x00A4:
+    case 0x00A5:
+    case 0x00B1:
+    case 0x2116:
+      return C::PR;
+    case 0x037E:
+      return C::IS;
+    case 0x200B:
+      return C::ZW;
+    case 0x200C:
+      return C::CM;
+    case 0x200D:
+      return C::ZWJ;
+    case 0x2060:
+    case 0xFEFF:
+      return C::WJ;
+    case 0x2028:
+    case 0x2029:
+      return C::BK;
+    // Ellipses (IN) and East Asian nonstarters (NS, CJ) cannot start a line.
+    case 0x2026:
+    case 0x203C:
+    case 0x2047:
+    case 0x2048:
+    case 0x2049:
+    case 0x3005:
+    case 0x301C:
+    case 0x303B:
+    case 0x3041:
+    case 0x3043:
+    case 0x3045:
+    case 0x3047:
+    case 0x3049:
+    case 0x3063:
+    case 0x3083:
+    case 0x3085:
+    case 0x3087:
+    case 0x308E:
+    case 0x3095:
+    case 0x3096:
+    case 0x309B:
+    case 0x309C:
+    case 0x309D:
+    case 0x309E:
+    case 0x30A0:
+    case 0x30A1:
+    case 0x30A3:
+    case 0x30A5:
+    case 0x30A7:
+    case 0x30A9:
+    case 0x30C3:
+    case 0x30E3:
+    case 0x30E5:
+    case 0x30E7:
+    case 0x30EE:
+    case 0x30F5:
+    case 0x30F6:
+    case 0x30FB:
+    case 0x30FC:
+    case 0x30FD:
+    case 0x30FE:
+    case 0xFF1A:
+    case 0xFF1B:
+    case 0xFF65:
+      return C::NS;
+    case 0x3008:
+    case 0x300A:
+    case 0x300C:
+    case 0x300E:
+    case 0x3010:
+    case 0x3014:
+    case 0x3016:
+    case 0x3018:
+    case 0x301A:
+    case 0x301D:
+    case 0xFF08:
+    case 0xFF3B:
+    case 0xFF5B:
+    case 0xFF5F:
+    case 0xFF62:
+      return C::OP;
+    case 0x3001:
+    case 0x3002:
+    case 0x3009:
+    case 0x300B:
+    case 0x300D:
+    case 0x300F:
+    case 0x3011:
+    case 0x3015:
+    case 0x3017:
+    case 0x3019:
+    case 0x301B:
+    case 0x301E:
+    case 0x301F:
+    case 0xFE50:
+    case 0xFE52:
+    case 0xFF0C:
+    case 0xFF0E:
+    case 0xFF5D:
+    case 0xFF60:
+    case 0xFF61:
+    case 0xFF63:
+    case 0xFF64:
+      return C::CL;
+    case 0xFF09:
+    case 0xFF3D:
+      return C::CP;
+    case 0xFF01:
+    case 0xFF1F:
+      return C::EX;
+    // The object replacement character (CB) stands for attachments, which
+    // can be broken around like ideographs.
+    case 0xFFFC:
+      return C::ID;
+    default:
+      break;
+  }
+
+  if (isInRange(codepoint, 0x0300, 0x036F) ||
+      isInRange(codepoint, 0x0483, 0x0489) ||
+      isInRange(codepoint, 0x0591, 0x05BD) ||
+      isInRange(codepoint, 0x0610, 0x061A) ||
+      isInRange(codepoint, 0x064B, 0x065F) ||
+      isInRange(codepoint, 0x0900, 0x0903) ||
+      isInRange(codepoint, 0x093A, 0x094F) ||
+      isInRange(codepoint, 0x1AB0, 0x1AFF) ||
+      isInRange(codepoint, 0x1DC0, 0x1DFF) ||
+      isInRange(codepoint, 0x20D0, 0x20FF) ||
+      isInRange(codepoint, 0xFE00, 0xFE0F) ||
+      isInRange(codepoint, 0xFE20, 0xFE2F) ||
+      isInRange(codepoint, 0x1F3FB, 0x1F3FF) ||
+      isInRange(codepoint, 0xE0020, 0xE007F) ||
+      isInRange(codepoint, 0xE0100, 0xE01EF)) {
+    return C::CM;
+  }
+
+  if (isInRange(codepoint, 0x0660, 0x0669) ||
+      isInRange(codepoint, 0x06F0, 0x06F9) ||
+      isInRange(codepoint, 0x0966, 0x096F) ||
+      isInRange(codepoint, 0x09E6, 0x09EF)) {
+    return C::NU;
+  }
+
+  if (isInRange(codepoint, 0x2000, 0x2006) ||
+      isInRange(codepoint, 0x2008, 0x200A)) {
+    return C::BA;
+  }
+
+  if (isInRange(codepoint, 0x20A0, 0x20CF)) {
+    return C::PR;
+  }
+
+  // Hangul, CJK, fullwidth forms and pictographs.
+  if (isInRange(codepoint, 0x1100, 0x115F) ||
+      isInRange(codepoint, 0x2600, 0x27BF) ||
+      isInRange(codepoint, 0x2E80, 0x2FFF) ||
+      isInRange(codepoint, 0x3003, 0x4DBF) ||
+      isInRange(codepoint, 0x4E00, 0x9FFF) ||
+      isInRange(codepoint, 0xA000, 0xA4CF) ||
+      isInRange(codepoint, 0xAC00, 0xD7A3) ||
+      isInRange(codepoint, 0xF900, 0xFAFF) ||
+      isInRange(codepoint, 0xFE30, 0xFE4F) ||
+      isInRange(codepoint, 0xFF00, 0xFFEF) ||
+      isInRange(codepoint, 0x1F000, 0x1FAFF) ||
+      isInRange(codepoint, 0x20000, 0x3FFFD)) {
+    return C::ID;
+  }
+
+  return C::AL;
+}
+
+void findLineBreaks(
+    std::span<const char32_t> text,
+    std::span<LineBreak> breaks) {
+  if (text.empty()) {
+    return;
+  }
+
+  auto first = getLineBreakClass(text[0]);
+  auto afterZWJ = first == C::ZWJ;
+  // LB10: marks at the start of the text are treated as alphabetic.
+  auto previous = (first == C::CM || first == C::ZWJ) ? C::AL : first;
+  auto beforeSpaces = previous;
+  breaks[0] = LineBreak::None;
+
+  for (size_t i = 1; i < text.size(); i++) {
+    auto current = getLineBreakClass(text[i]);
+    breaks[i] = getLineBreak(previous, beforeSpaces, afterZWJ, current);
+
+    afterZWJ = current == C::ZWJ;
+    if (current == C::CM || current == C::ZWJ) {
+      // LB9: marks take the class of the character they apply to.
+      if (previous != C::BK && previous != C::CR && previous != C::LF &&
+          previous != C::NL && previous != C::SP && previous != C::ZW) {
+        continue;
+      }
+      current = C::AL;
+    }
+
+    previous = current;
+    if (current != C::SP) {
+      beforeSpaces = current;
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace facebook::react {
+
+/*
+ * Line breaking classes of the Unicode Line Breaking Algorithm (UAX #14)
+ * which are distinguished by `findLineBreaks`. Other classes are resolved to
+ * the closest of these (e.g. H2, H3, EB and CJ are treated as ID).
+ */
+enum class LineBreakClass : uint8_t {
+  BK, // Mandatory break
+  CR, // Carriage return
+  LF, // Line feed
+  NL, // Next line
+  SP, // Space
+  ZW, // Zero width space
+  ZWJ, // Zero width joiner
+  CM, // Combining mark
+  WJ, // Word joiner
+  GL, // Non-breaking ("glue")
+  OP, // Open punctuation
+  CL, // Close punctuation
+  CP, // Close parenthesis
+  QU, // Quotation
+  EX, // Exclamation/interrogation
+  IS, // Infix numeric separator
+  SY, // Symbols allowing break after
+  BA, // Break after
+  BB, // Break before
+  HY, // Hyphen
+  NS, // Nonstarter
+  PR, // Prefix numeric
+  PO, // Postfix numeric
+  NU, // Numeric
+  AL, // Alphabetic
+  ID, // Ideographic
+};
+
+enum class LineBreak : uint8_t {
+  None, // Lines cannot be broken before this character.
+  Allowed, // Lines can be broken before this character.
+  Mandatory, // Lines must be broken before this character.
+};
+
+LineBreakClass getLineBreakClass(char32_t codepoint);
+
+/*
+ * Finds the line break opportunities of `text`, following the rules of the
+ * Unicode Line Breaking Algorithm (UAX #14) for the classes of
+ * `LineBreakClass`, with the simplified number rule of LB25. `breaks[i]` is
+ * set to the opportunity before `text[i]`, and `breaks[0]` is always
+ * `LineBreak::None`.
+ *
+ * `breaks` must have the same size as `text`.
+ */
+void findLineBreaks(
+    std::span<const char32_t> text,
+    std::span<LineBreak> breaks);
+
+} // namespace facebook::react
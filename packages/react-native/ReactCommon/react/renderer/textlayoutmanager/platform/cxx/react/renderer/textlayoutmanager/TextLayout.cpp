@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TextLayout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "FontMetrics.h"
+#include "LineBreaker.h"
+
+namespace facebook::react {
+
+namespace {
+
+constexpr Float kDefaultFontSize = 14;
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+constexpr char32_t kObjectReplacementCharacter = 0xFFFC;
+
+struct FragmentStyle {
+  const FontMetrics* fontMetrics{nullptr};
+  Float fontSize{kDefaultFontSize};
+  // NaN if the fragment doesn't set a line height.
+  Float lineHeight{std::numeric_limits<Float>::quiet_NaN()};
+  // Set for attachments only.
+  Size attachmentSize{};
+  bool isAttachment{false};
+};
+
+struct Glyph {
+  char32_t codepoint;
+  uint32_t fragmentIndex;
+  // Offset of the character in the text of the paragraph, in bytes.
+  uint32_t byteOffset;
+  Float advance;
+};
+
+struct Line {
+  // Range of glyphs, including trailing spaces and line terminators.
+  size_t start;
+  size_t end;
+  Float width;
+};
+
+struct LineMetrics {
+  Float ascender{0};
+  Float descender{0};
+  Float capHeight{0};
+  Float xHeight{0};
+  Float height{0};
+};
+
+FragmentStyle getFragmentStyle(const AttributedString::Fragment& fragment) {
+  const auto& textAttributes = *fragment.textAttributes;
+  FragmentStyle style;
+  style.fontMetrics = &FontMetrics::get(textAttributes);
+
+  auto multiplier = Float{1};
+  if (textAttributes.allowFontScaling.value_or(true) &&
+      !std::isnan(textAttributes.fontSizeMultiplier)) {
+    multiplier = textAttributes.fontSizeMultiplier;
+  }
+  if (!std::isnan(textAttributes.fontSize)) {
+    style.fontSize = textAttributes.fontSize;
+  }
+  style.fontSize *= multiplier;
+  if (!std::isnan(textAttributes.lineHeight)) {
+    style.lineHeight = textAttributes.lineHeight * multiplier;
+  }
+
+  if (fragment.isAttachment()) {
+    style.isAttachment = true;
+    style.attachmentSize = fragment.parentShadowView.layoutMetrics.frame.size;
+  }
+  return style;
+}
+
+/*
+ * Decodes the UTF-8 sequence at `offset`, and advances `offset` past it.
+ * Invalid sequences are decoded as U+FFFD, one byte at a time.
+ */
+char32_t decodeUtf8(std::string_view text, size_t& offset) {
+  auto lead = static_cast<unsigned char>(text[offset++]);
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  size_t length = 0;
+  char32_t codepoint = 0;
+  if ((lead & 0xE0) == 0xC0) {
+    length = 1;
+    codepoint = lead & 0x1F;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 2;
+    codepoint = lead & 0x0F;
+  } else if ((lead & 0xF8) == 0xF0) {
+    length = 3;
+    codepoint = lead & 0x07;
+  } else {
+    return kReplacementCharacter;
+  }
+
+  if (offset + length > text.size()) {
+    return kReplacementCharacter;
+  }
+  for (size_t i = 0; i < length; i++) {
+    auto continuation = static_cast<unsigned char>(text[offset + i]);
+    if ((continuation & 0xC0) != 0x80) {
+      return kReplacementCharacter;
+    }
+    codepoint = (codepoint << 6) | (continuation & 0x3F);
+  }
+  offset += length;
+  return codepoint;
+}
+
+bool isLineTerminator(char32_t codepoint) {
+  if (codepoint >= 0x20 && codepoint < 0x7F) {
+    return false;
+  }
+  auto lineBreakClass = getLineBreakClass(codepoint);
+  return lineBreakClass == LineBreakClass::BK ||
+      lineBreakClass == LineBreakClass::CR ||
+      lineBreakClass == LineBreakClass::LF ||
+      lineBreakClass == LineBreakClass::NL;
+}
+
+/*
+ * Whether the character hangs at the end of a line, instead of counting
+ * towards its width.
+ */
+bool isHangingWhitespace(char32_t codepoint) {
+  return codepoint == ' ' || codepoint == '\t' || codepoint == 0x1680 ||
+      (codepoint >= 0x2000 && codepoint <= 0x200A) || codepoint == 0x205F ||
+      codepoint == 0x3000 || isLineTerminator(codepoint);
+}
+
+/*
+ * Breaks `glyphs` into lines of at most `maxWidth`, unless a single character
+ * doesn't fit.
+ */
+std::vector<Line> breakLines(
+    const std::vector<Glyph>& glyphs,
+    const std::vector<LineBreak>& breaks,
+    Float maxWidth,
+    size_t maxLines) {
+  std::vector<Line> lines;
+  auto count = glyphs.size();
+
+  size_t lineStart = 0;
+  while (lineStart < count && lines.size() < maxLines) {
+    auto lineEnd = count;
+    auto lastBreak = lineStart;
+    auto width = Float{0};
+
+    for (auto i = lineStart; i < count; i++) {
+      if (i > lineStart && breaks[i] == LineBreak::Mandatory) {
+        lineEnd = i;
+        break;
+      }
+      if (i > lineStart && breaks[i] == LineBreak::Allowed) {
+        lastBreak = i;
+      }
+
+      const auto& glyph = glyphs[i];
+      if (!isHangingWhitespace(glyph.codepoint) && i > lineStart &&
+          glyph.advance > 0 && width + glyph.advance > maxWidth) {
+        lineEnd = lastBreak > lineStart ? lastBreak : i;
+        break;
+      }
+      width += glyph.advance;
+    }
+
+    auto contentEnd = lineEnd;
+    while (contentEnd > lineStart &&
+           isHangingWhitespace(glyphs[contentEnd - 1].codepoint)) {
+      contentEnd--;
+    }
+    width = 0;
+    for (auto i = lineStart; i < contentEnd; i++) {
+      width += glyphs[i].advance;
+    }
+
+    lines.push_back(Line{.start = lineStart, .end = lineEnd, .width = width});
+    lineStart = lineEnd;
+  }
+
+  // A line terminator at the end of the text starts an empty line.
+  if (count > 0 && lineStart == count && lines.size() < maxLines &&
+      isLineTerminator(glyphs[count - 1].codepoint)) {
+    lines.push_back(Line{.start = count, .end = count, .width = 0});
+  }
+
+  return lines;
+}
+
+LineMetrics getLineMetrics(
+    const Line& line,
+    const std::vector<Glyph>& glyphs,
+    const std::vector<FragmentStyle>& styles) {
+  LineMetrics metrics;
+  auto lineHeight = std::numeric_limits<Float>::quiet_NaN();
+
+  auto addStyle = [&](const FragmentStyle& style) {
+    if (style.isAttachment) {
+      // Attachments are placed on the baseline.
+      metrics.ascender =
+          std::max(metrics.ascender, style.attachmentSize.height);
+    } else {
+      const auto& font = *style.fontMetrics;
+      metrics.ascender =
+          std::max(metrics.ascender, font.ascender * style.fontSize);
+      metrics.descender =
+          std::max(metrics.descender, font.descender * style.fontSize);
+      metrics.capHeight =
+          std::max(metrics.capHeight, font.capHeight * style.fontSize);
+      metrics.xHeight =
+          std::max(metrics.xHeight, font.xHeight * style.fontSize);
+    }
+    if (!std::isnan(style.lineHeight) &&
+        (std::isnan(lineHeight) || style.lineHeight > lineHeight)) {
+      lineHeight = style.lineHeight;
+    }
+  };
+
+  if (line.start == line.end) {
+    // Empty lines have the metrics of the preceding line terminator.
+    addStyle(styles[glyphs[line.start - 1].fragmentIndex]);
+  } else {
+    auto fragmentIndex = glyphs[line.start].fragmentIndex;
+    addStyle(styles[fragmentIndex]);
+    for (auto i = line.start + 1; i < line.end; i++) {
+      if (glyphs[i].fragmentIndex != fragmentIndex) {
+        fragmentIndex = glyphs[i].fragmentIndex;
+        addStyle(styles[fragmentIndex]);
+      }
+    }
+  }
+
+  metrics.height = metrics.ascender + metrics.descender;
+  if (!std::isnan(lineHeight)) {
+    // The difference with the natural height is split between the top and the
+    // bottom of the line.
+    auto extra = (lineHeight - metrics.height) / 2;
+    metrics.ascender += extra;
+    metrics.descender += extra;
+    metrics.height = lineHeight;
+  }
+  return metrics;
+}
+
+Float getAlignmentOffset(
+    TextAlignment alignment,
+    bool isRTL,
+    Float containerWidth,
+    Float lineWidth) {
+  switch (alignment) {
+    case TextAlignment::Natural:
+    case TextAlignment::Justified:
+      return isRTL ? containerWidth - lineWidth : 0;
+    case TextAlignment::Left:
+      return 0;
+    case TextAlignment::Center:
+      return (containerWidth - lineWidth) / 2;
+    case TextAlignment::Right:
+      return containerWidth - lineWidth;
+  }
+  return 0;
+}
+
+} // namespace
+
+struct ShapedText {
+  std::vector<FragmentStyle> styles;
+  std::vector<Glyph> glyphs;
+  // Break opportunity before each glyph.
+  std::vector<LineBreak> breaks;
+  // Text of all fragments, which lines refer to.
+  std::string text;
+  size_t attachmentCount{0};
+  // Alignment of the paragraph, which is the alignment of its first fragment.
+  TextAlignment alignment{TextAlignment::Natural};
+};
+
+std::shared_ptr<const ShapedText> shapeText(
+    const AttributedString& attributedString) {
+  const auto& fragments = attributedString.getFragments();
+  auto shapedText = std::make_shared<ShapedText>();
+  auto& styles = shapedText->styles;
+  auto& glyphs = shapedText->glyphs;
+  auto& text = shapedText->text;
+  std::vector<char32_t> codepoints;
+
+  size_t length = 0;
+  for (const auto& fragment : fragments) {
+    length += fragment.string->size();
+  }
+  // Every character is at least one byte long.
+  styles.reserve(fragments.size());
+  glyphs.reserve(length);
+  codepoints.reserve(length);
+  text.reserve(length);
+
+  for (uint32_t fragmentIndex = 0; fragmentIndex < fragments.size();
+       fragmentIndex++) {
+    const auto& fragment = fragments[fragmentIndex];
+    const auto& style = styles.emplace_back(getFragmentStyle(fragment));
+    auto textOffset = static_cast<uint32_t>(text.size());
+    text.append(*fragment.string);
+
+    if (style.isAttachment) {
+      glyphs.push_back(Glyph{
+          .codepoint = kObjectReplacementCharacter,
+          .fragmentIndex = fragmentIndex,
+          .byteOffset = textOffset,
+          .advance = style.attachmentSize.width,
+      });
+      codepoints.push_back(kObjectReplacementCharacter);
+      shapedText->attachmentCount++;
+      continue;
+    }
+
+    auto letterSpacing = std::isnan(fragment.textAttributes->letterSpacing)
+        ? Float{0}
+        : fragment.textAttributes->letterSpacing;
+    std::string_view string = *fragment.string;
+    size_t offset = 0;
+    while (offset < string.size()) {
+      auto byteOffset = textOffset + static_cast<uint32_t>(offset);
+      auto codepoint = decodeUtf8(string, offset);
+      auto advance =
+          style.fontMetrics->getAdvance(codepoint) * style.fontSize;
+      if (advance > 0) {
+        advance += letterSpacing;
+      }
+      glyphs.push_back(Glyph{
+          .codepoint = codepoint,
+          .fragmentIndex = fragmentIndex,
+          .byteOffset = byteOffset,
+          .advance = advance,
+      });
+      codepoints.push_back(codepoint);
+    }
+  }
+
+  shapedText->breaks.resize(codepoints.size());
+  findLineBreaks(codepoints, shapedText->breaks);
+
+  if (!fragments.empty()) {
+    shapedText->alignment =
+        fragments.front().textAttributes->alignment.value_or(
+            TextAlignment::Natural);
+  }
+  return shapedText;
+}
+
+TextLayout layoutShapedText(
+    const ShapedText& shapedText,
+    const ParagraphAttributes& paragraphAttributes,
+    const LayoutConstraints& layoutConstraints) {
+  const auto& styles = shapedText.styles;
+  const auto& glyphs = shapedText.glyphs;
+  const auto& text = shapedText.text;
+
+  auto maxLines = paragraphAttributes.maximumNumberOfLines > 0
+      ? static_cast<size_t>(paragraphAttributes.maximumNumberOfLines)
+      : std::numeric_limits<size_t>::max();
+  auto lines = breakLines(
+      glyphs, shapedText.breaks, layoutConstraints.maximumSize.width, maxLines);
+
+  auto contentWidth = Float{0};
+  for (const auto& line : lines) {
+    contentWidth = std::max(contentWidth, line.width);
+  }
+  auto containerWidth = layoutConstraints.clamp({contentWidth, 0}).width;
+  auto isRTL =
+      layoutConstraints.layoutDirection == LayoutDirection::RightToLeft;
+
+  TextLayout layout;
+  layout.lines.reserve(lines.size());
+  // Attachments which are not laid out, because they are beyond the maximum
+  // number of lines, are clipped.
+  layout.measurement.attachments.resize(
+      shapedText.attachmentCount,
+      TextMeasurement::Attachment{{{0, 0}, {0, 0}}, true});
+  size_t attachmentIndex = 0;
+  auto top = Float{0};
+
+  for (const auto& line : lines) {
+    auto metrics = getLineMetrics(line, glyphs, styles);
+    auto left = getAlignmentOffset(
+        shapedText.alignment, isRTL, containerWidth, line.width);
+
+    auto x = left;
+    for (auto i = line.start; i < line.end; i++) {
+      const auto& glyph = glyphs[i];
+      const auto& style = styles[glyph.fragmentIndex];
+      if (style.isAttachment) {
+        auto& attachment = layout.measurement.attachments[attachmentIndex++];
+        attachment.frame = {
+            {x, top + metrics.ascender - style.attachmentSize.height},
+            style.attachmentSize};
+        attachment.isClipped = false;
+      }
+      x += glyph.advance;
+    }
+
+    auto startByte = line.start < glyphs.size() ? glyphs[line.start].byteOffset
+                                                : text.size();
+    auto endByte =
+        line.end < glyphs.size() ? glyphs[line.end].byteOffset : text.size();
+    layout.lines.emplace_back(
+        text.substr(startByte, endByte - startByte),
+        Rect{{left, top}, {line.width, metrics.height}},
+        metrics.descender,
+        metrics.capHeight,
+        metrics.ascender,
+        metrics.xHeight);
+
+    top += metrics.height;
+  }
+
+  layout.measurement.size = {contentWidth, top};
+  return layout;
+}
+
+TextLayout layoutText(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    const LayoutConstraints& layoutConstraints) {
+  return layoutShapedText(
+      *shapeText(attributedString), paragraphAttributes, layoutConstraints);
+}
+
+} // namespace facebook::react
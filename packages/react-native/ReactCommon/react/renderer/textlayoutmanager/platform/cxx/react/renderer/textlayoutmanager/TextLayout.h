@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <react/renderer/attributedstring/AttributedString.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+namespace facebook::react {
+
+/*
+ * Describes the lines and attachments of a laid out paragraph. Frames are
+ * relative to the paragraph.
+ */
+struct TextLayout {
+  TextMeasurement measurement;
+  LinesMeasurements lines;
+};
+
+/*
+ * Width-independent representation of a paragraph: its characters with their
+ * advances and styles, and its line break opportunities. Shaping is the
+ * expensive part of laying out text, so shaped text is meant to be reused to
+ * lay out the same paragraph under different constraints.
+ */
+struct ShapedText;
+
+std::shared_ptr<const ShapedText> shapeText(
+    const AttributedString& attributedString);
+
+/*
+ * Breaks `shapedText` into lines for `layoutConstraints`, as `layoutText`
+ * does.
+ */
+TextLayout layoutShapedText(
+    const ShapedText& shapedText,
+    const ParagraphAttributes& paragraphAttributes,
+    const LayoutConstraints& layoutConstraints);
+
+/*
+ * Lays out `attributedString` without platform text infrastructure, using
+ * the built-in `FontMetrics` and the line breaking opportunities of
+ * `findLineBreaks`.
+ *
+ * Lines are filled greedily up to `layoutConstraints.maximumSize.width`, and
+ * are broken between characters when a word doesn't fit on its own line.
+ * Trailing spaces don't count towards the width of a line. The height of a
+ * line is determined by the largest font (or attachment) on it, or by the
+ * largest `lineHeight` of its fragments if any is set. Only the attributes
+ * which `TextMeasureCache` considers layout-wise are taken into account, so
+ * results can be cached.
+ *
+ * Only reads immutable data, so independent paragraphs can be laid out in
+ * parallel.
+ */
+TextLayout layoutText(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    const LayoutConstraints& layoutConstraints);
+
+} // namespace facebook::react
@@ -7,28 +7,102 @@
 
 #include "TextLayoutManager.h"
 
+#include <react/debug/react_native_assert.h>
+#include <react/renderer/graphics/rounding.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
+#include "TextLayout.h"
+
 namespace facebook::react {
 
 TextLayoutManager::TextLayoutManager(
     const ContextContainer::Shared& /*contextContainer*/)
-    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      shapedTextCache_(kSimpleThreadSafeCacheSizeCap) {}
+
+std::shared_ptr<const ShapedText> TextLayoutManager::getShapedText(
+    const AttributedString& attributedString) const {
+  // Shaping doesn't depend on paragraph attributes or constraints, so these
+  // are left out of the key. Like layout, shaping runs outside of the lock of
+  // the cache, so no cache lock is ever held while text is shaped.
+  auto key = PreparedTextCacheKey{};
+  key.attributedString = attributedString;
+  return shapedTextCache_.getConcurrently(key, [&]() {
+    shapeCount_.fetch_add(1, std::memory_order_relaxed);
+    return shapeText(attributedString);
+  });
+}
+
+TextLayoutManager::HeadlessLayoutCounters
+TextLayoutManager::getHeadlessLayoutCounters() const {
+  return {
+      .shapeCount = shapeCount_.load(std::memory_order_relaxed),
+      .layoutCount = layoutCount_.load(std::memory_order_relaxed)};
+}
 
 TextMeasurement TextLayoutManager::measure(
     const AttributedStringBox& attributedStringBox,
-    const ParagraphAttributes& /*paragraphAttributes*/,
-    const TextLayoutContext& /*layoutContext*/,
+    const ParagraphAttributes& paragraphAttributes,
+    const TextLayoutContext& layoutContext,
     const LayoutConstraints& layoutConstraints) const {
-  TextMeasurement::Attachments attachments;
-  for (const auto& fragment : attributedStringBox.getValue().getFragments()) {
-    if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, false});
-    }
-  }
-  return TextMeasurement{
-      {layoutConstraints.minimumSize.width,
-       layoutConstraints.minimumSize.height},
-      attachments};
+  const auto& attributedString = attributedStringBox.getValue();
+
+  // Text is laid out outside of the lock of the cache, so that paragraphs can
+  // be measured in parallel.
+  auto measurement = textMeasureCache_.getConcurrently(
+      {.attributedString = attributedString,
+       .paragraphAttributes = paragraphAttributes,
+       .layoutConstraints = layoutConstraints},
+      [&]() {
+        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+        if (telemetry != nullptr) {
+          telemetry->willMeasureText();
+        }
+
+        auto shapedText = getShapedText(attributedString);
+        layoutCount_.fetch_add(1, std::memory_order_relaxed);
+        auto measurement = layoutShapedText(
+                               *shapedText,
+                               paragraphAttributes,
+                               layoutConstraints)
+                               .measurement;
+
+        if (telemetry != nullptr) {
+          telemetry->didMeasureText();
+        }
+
+        return measurement;
+      });
+
+  // Rounding to *next* value on the pixel grid, as platforms do.
+  auto size = roundToPixel<&std::ceil>(
+      measurement.size, layoutContext.pointScaleFactor);
+  measurement.size = layoutConstraints.clamp(size);
+  return measurement;
+}
+
+LinesMeasurements TextLayoutManager::measureLines(
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const Size& size) const {
+  react_native_assert(
+      attributedStringBox.getMode() == AttributedStringBox::Mode::Value);
+  const auto& attributedString = attributedStringBox.getValue();
+
+  return lineMeasureCache_.getConcurrently(
+      {.attributedString = attributedString,
+       .paragraphAttributes = paragraphAttributes,
+       .size = size},
+      [&]() {
+        auto shapedText = getShapedText(attributedString);
+        layoutCount_.fetch_add(1, std::memory_order_relaxed);
+        return layoutShapedText(
+                   *shapedText,
+                   paragraphAttributes,
+                   {.minimumSize = size, .maximumSize = size})
+            .lines;
+      });
 }
 
 } // namespace facebook::react
@@ -13,15 +13,22 @@
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
 #include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 #include <react/utils/ContextContainer.h>
+#include <atomic>
 #include <memory>
 
 namespace facebook::react {
 
 class TextLayoutManager;
+struct ShapedText;
 
 /*
  * Cross platform facade for text measurement (e.g. Android-specific
- * TextLayoutManager)
+ * TextLayoutManager). Text is laid out without platform text infrastructure,
+ * for headless environments, and can be measured from any thread.
+ *
+ * Shaped paragraphs are cached independently of layout constraints, so
+ * measuring a paragraph at several widths (as Yoga does) only breaks the
+ * already shaped text into lines again.
  */
 class TextLayoutManager {
  public:
@@ -41,7 +48,8 @@ class TextLayoutManager {
   TextLayoutManager& operator=(TextLayoutManager&&) = delete;
 
   /*
-   * Measures `attributedString` using native text rendering infrastructure.
+   * Measures `attributedString` using the headless text layout engine (see
+   * `layoutText`).
    */
   virtual TextMeasurement measure(
       const AttributedStringBox& attributedStringBox,
@@ -49,9 +57,45 @@ class TextLayoutManager {
       const TextLayoutContext& layoutContext,
       const LayoutConstraints& layoutConstraints) const;
 
+  /*
+   * Measures lines of `attributedString` using the headless text layout
+   * engine.
+   */
+  virtual LinesMeasurements measureLines(
+      const AttributedStringBox& attributedStringBox,
+      const ParagraphAttributes& paragraphAttributes,
+      const Size& size) const;
+
+  /*
+   * Number of times paragraphs were shaped, and laid out from shaped text,
+   * by the headless text layout engine since the creation of the instance.
+   * Results served from the measure caches are not counted.
+   * Specific to this implementation: the Android and iOS text layout managers
+   * lay out text natively and don't shape text in C++.
+   */
+  struct HeadlessLayoutCounters {
+    size_t shapeCount;
+    size_t layoutCount;
+  };
+
+  HeadlessLayoutCounters getHeadlessLayoutCounters() const;
+
  protected:
+  std::shared_ptr<const ShapedText> getShapedText(
+      const AttributedString& attributedString) const;
+
   std::shared_ptr<const ContextContainer> contextContainer_;
   TextMeasureCache textMeasureCache_;
+  LineMeasureCache lineMeasureCache_;
+  // Shaped text by content, so that measuring a paragraph under new
+  // constraints only breaks it into lines again.
+  SimpleThreadSafeCache<
+      PreparedTextCacheKey,
+      std::shared_ptr<const ShapedText>,
+      kSimpleThreadSafeCacheSizeCap>
+      shapedTextCache_;
+  mutable std::atomic<size_t> shapeCount_{0};
+  mutable std::atomic<size_t> layoutCount_{0};
 };
 
 } // namespace facebook::react
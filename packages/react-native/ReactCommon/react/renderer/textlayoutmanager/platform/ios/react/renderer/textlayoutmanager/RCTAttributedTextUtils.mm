@@ -368,16 +368,16 @@ static NSMutableAttributedString *RCTNSAttributedStringFragmentFromFragment(
 
     return [[NSMutableAttributedString attributedStringWithAttachment:attachment] mutableCopy];
   } else {
-    NSString *string = [NSString stringWithUTF8String:fragment.string.c_str()];
+    NSString *string = [NSString stringWithUTF8String:fragment.string->c_str()];
 
-    if (fragment.textAttributes.textTransform.has_value()) {
-      auto textTransform = fragment.textAttributes.textTransform.value();
+    if (fragment.textAttributes->textTransform.has_value()) {
+      auto textTransform = fragment.textAttributes->textTransform.value();
       string = RCTNSStringFromStringApplyingTextTransform(string, textTransform);
     }
 
     return [[NSMutableAttributedString alloc]
         initWithString:string
-            attributes:RCTNSTextAttributesFromTextAttributes(fragment.textAttributes)];
+            attributes:RCTNSTextAttributesFromTextAttributes(*fragment.textAttributes)];
   }
 }
 
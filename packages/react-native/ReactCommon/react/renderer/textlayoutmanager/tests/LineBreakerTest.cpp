@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/LineBreaker.h>
+
+using namespace facebook::react;
+
+namespace {
+
+/*
+ * Returns `text` with `|` inserted at allowed and `!` inserted at mandatory
+ * break opportunities.
+ */
+std::u32string markLineBreaks(const std::u32string& text) {
+  auto breaks = std::vector<LineBreak>(text.size());
+  findLineBreaks(text, breaks);
+
+  auto result = std::u32string{};
+  for (size_t i = 0; i < text.size(); i++) {
+    if (breaks[i] == LineBreak::Allowed) {
+      result += U'|';
+    } else if (breaks[i] == LineBreak::Mandatory) {
+      result += U'!';
+    }
+    result += text[i];
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(LineBreakerTest, testEmptyText) {
+  EXPECT_EQ(markLineBreaks(U""), U"");
+}
+
+TEST(LineBreakerTest, testSpaces) {
+  EXPECT_EQ(markLineBreaks(U"hello world"), U"hello |world");
+  EXPECT_EQ(markLineBreaks(U"hello   world"), U"hello   |world");
+  EXPECT_EQ(markLineBreaks(U"  leading"), U"  |leading");
+  EXPECT_EQ(markLineBreaks(U"tab\tstop"), U"tab\t|stop");
+}
+
+TEST(LineBreakerTest, testMandatoryBreaks) {
+  EXPECT_EQ(markLineBreaks(U"a\nb"), U"a\n!b");
+  EXPECT_EQ(markLineBreaks(U"a\r\nb"), U"a\r\n!b");
+  EXPECT_EQ(markLineBreaks(U"a\rb"), U"a\r!b");
+  EXPECT_EQ(markLineBreaks(U"a b"), U"a !b");
+  EXPECT_EQ(markLineBreaks(U"a \n\nb"), U"a \n!\n!b");
+}
+
+TEST(LineBreakerTest, testPunctuation) {
+  EXPECT_EQ(
+      markLineBreaks(U"(hello) world! yes?"), U"(hello) |world! |yes?");
+  EXPECT_EQ(markLineBreaks(U"\"quoted\" text"), U"\"quoted\" |text");
+  EXPECT_EQ(markLineBreaks(U"one, two; three"), U"one, |two; |three");
+}
+
+TEST(LineBreakerTest, testHyphens) {
+  EXPECT_EQ(markLineBreaks(U"well-known"), U"well-|known");
+  EXPECT_EQ(markLineBreaks(U"-1"), U"-1");
+  EXPECT_EQ(markLineBreaks(U"a - b"), U"a |- |b");
+}
+
+TEST(LineBreakerTest, testNumbers) {
+  EXPECT_EQ(markLineBreaks(U"$100.00, 50%"), U"$100.00, |50%");
+  EXPECT_EQ(markLineBreaks(U"1/2 (3)"), U"1/2 |(3)");
+  EXPECT_EQ(markLineBreaks(U"1,000,000"), U"1,000,000");
+}
+
+TEST(LineBreakerTest, testIdeographs) {
+  EXPECT_EQ(markLineBreaks(U"日本語"), U"日|本|語");
+  EXPECT_EQ(markLineBreaks(U"です。次"), U"で|す。|次");
+  EXPECT_EQ(markLineBreaks(U"「引用」"), U"「引|用」");
+  EXPECT_EQ(markLineBreaks(U"漢字abc漢字"), U"漢|字|abc|漢|字");
+}
+
+TEST(LineBreakerTest, testNonBreakingCharacters) {
+  EXPECT_EQ(markLineBreaks(U"100 km away"), U"100 km |away");
+  EXPECT_EQ(markLineBreaks(U"a⁠b c"), U"a⁠b |c");
+  EXPECT_EQ(markLineBreaks(U"a​b"), U"a​|b");
+}
+
+TEST(LineBreakerTest, testCombiningMarks) {
+  EXPECT_EQ(markLineBreaks(U"é x"), U"é |x");
+  EXPECT_EQ(
+      markLineBreaks(U"\U0001F468‍\U0001F469 x"),
+      U"\U0001F468‍\U0001F469 |x");
+}
+
+TEST(LineBreakerTest, testLineBreakClasses) {
+  EXPECT_EQ(getLineBreakClass(U'a'), LineBreakClass::AL);
+  EXPECT_EQ(getLineBreakClass(U'7'), LineBreakClass::NU);
+  EXPECT_EQ(getLineBreakClass(U' '), LineBreakClass::SP);
+  EXPECT_EQ(getLineBreakClass(U'\n'), LineBreakClass::LF);
+  EXPECT_EQ(getLineBreakClass(U' '), LineBreakClass::GL);
+  EXPECT_EQ(getLineBreakClass(U'‍'), LineBreakClass::ZWJ);
+  EXPECT_EQ(getLineBreakClass(U'́'), LineBreakClass::CM);
+  EXPECT_EQ(getLineBreakClass(U'中'), LineBreakClass::ID);
+  EXPECT_EQ(getLineBreakClass(U'￼'), LineBreakClass::ID);
+}
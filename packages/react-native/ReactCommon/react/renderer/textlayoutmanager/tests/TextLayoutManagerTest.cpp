@@ -5,7 +5,11 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -13,6 +17,340 @@
 
 using namespace facebook::react;
 
-TEST(TextLayoutManagerTest, testSomething) {
-  // TODO:
+namespace {
+
+AttributedString::Fragment makeFragment(
+    std::string string,
+    Float fontSize = 14,
+    Float lineHeight = std::numeric_limits<Float>::quiet_NaN()) {
+  auto textAttributes = TextAttributes{};
+  textAttributes.fontSize = fontSize;
+  textAttributes.lineHeight = lineHeight;
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = std::move(string);
+  fragment.textAttributes = textAttributes;
+  return fragment;
+}
+
+AttributedStringBox makeAttributedStringBox(
+    std::vector<AttributedString::Fragment> fragments) {
+  auto attributedString = AttributedString{};
+  for (auto& fragment : fragments) {
+    attributedString.appendFragment(std::move(fragment));
+  }
+  return AttributedStringBox{attributedString};
+}
+
+LayoutConstraints makeLayoutConstraints(Float maximumWidth) {
+  return {
+      .minimumSize = {0, 0},
+      .maximumSize = {maximumWidth, std::numeric_limits<Float>::infinity()}};
+}
+
+constexpr Float kUnboundedWidth = std::numeric_limits<Float>::infinity();
+
+const std::string kParagraph =
+    "The quick brown fox jumps over the lazy dog. Pack my box with five "
+    "dozen liquor jugs.";
+
+} // namespace
+
+TEST(TextLayoutManagerTest, testMeasureEmptyString) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  auto measurement = textLayoutManager.measure(
+      makeAttributedStringBox({}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+
+  EXPECT_EQ(measurement.size, (Size{0, 0}));
+}
+
+TEST(TextLayoutManagerTest, testMeasureSingleLine) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  auto small = textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment("Hello")}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+  auto large = textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment("Hello", 28)}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+  auto longer = textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment("Hello, world")}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+
+  EXPECT_GT(small.size.width, 0);
+  EXPECT_GT(small.size.height, 0);
+  EXPECT_GT(large.size.width, small.size.width);
+  EXPECT_GT(large.size.height, small.size.height);
+  EXPECT_GT(longer.size.width, small.size.width);
+  EXPECT_EQ(longer.size.height, small.size.height);
+}
+
+TEST(TextLayoutManagerTest, testMeasureRoundsToPixelGrid) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto layoutContext = TextLayoutContext{.pointScaleFactor = 3};
+
+  auto measurement = textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment("Hello")}),
+      {},
+      layoutContext,
+      makeLayoutConstraints(kUnboundedWidth));
+
+  EXPECT_FLOAT_EQ(
+      measurement.size.width * 3, std::round(measurement.size.width * 3));
+  EXPECT_FLOAT_EQ(
+      measurement.size.height * 3, std::round(measurement.size.height * 3));
+}
+
+TEST(TextLayoutManagerTest, testMeasureWrapsAtWordBoundaries) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attributedStringBox =
+      makeAttributedStringBox({makeFragment(kParagraph)});
+
+  auto singleLine = textLayoutManager.measure(
+      attributedStringBox, {}, {}, makeLayoutConstraints(kUnboundedWidth));
+  auto wrapped = textLayoutManager.measure(
+      attributedStringBox, {}, {}, makeLayoutConstraints(100));
+
+  EXPECT_LE(wrapped.size.width, 100);
+  EXPECT_GT(wrapped.size.height, singleLine.size.height * 4);
+
+  auto lines =
+      textLayoutManager.measureLines(attributedStringBox, {}, wrapped.size);
+
+  ASSERT_GT(lines.size(), 4);
+  auto text = std::string{};
+  for (const auto& line : lines) {
+    EXPECT_LE(line.frame.size.width, 100);
+    text += line.text;
+  }
+  EXPECT_EQ(text, kParagraph);
+  for (size_t i = 0; i + 1 < lines.size(); i++) {
+    EXPECT_EQ(lines[i].text.back(), ' ');
+    EXPECT_FLOAT_EQ(
+        lines[i].frame.origin.y + lines[i].frame.size.height,
+        lines[i + 1].frame.origin.y);
+  }
+}
+
+TEST(TextLayoutManagerTest, testMeasureBreaksLongWords) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attributedStringBox =
+      makeAttributedStringBox({makeFragment("Supercalifragilistic")});
+
+  auto measurement = textLayoutManager.measure(
+      attributedStringBox, {}, {}, makeLayoutConstraints(40));
+  auto lines = textLayoutManager.measureLines(
+      attributedStringBox, {}, measurement.size);
+
+  EXPECT_LE(measurement.size.width, 40);
+  EXPECT_GT(lines.size(), 1);
+}
+
+TEST(TextLayoutManagerTest, testMeasureLinesWithMandatoryBreaks) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  auto lines = textLayoutManager.measureLines(
+      makeAttributedStringBox({makeFragment("first\r\nsecond\n")}),
+      {},
+      {1000, 1000});
+
+  ASSERT_EQ(lines.size(), 3);
+  EXPECT_EQ(lines[0].text, "first\r\n");
+  EXPECT_EQ(lines[1].text, "second\n");
+  EXPECT_EQ(lines[2].text, "");
+  EXPECT_EQ(lines[2].frame.size.width, 0);
+  EXPECT_GT(lines[2].frame.size.height, 0);
+}
+
+TEST(TextLayoutManagerTest, testMeasureLinesWithCJK) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  // Six ideographs fit on each line, but "。" can't start one.
+  auto lines = textLayoutManager.measureLines(
+      makeAttributedStringBox({makeFragment("日本語のテキ。改行です", 10)}),
+      {},
+      {60, 1000});
+
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[0].text, "日本語のテ");
+  EXPECT_EQ(lines[1].text, "キ。改行です");
+}
+
+TEST(TextLayoutManagerTest, testMeasureWithLineHeight) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  auto measurement = textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment("first\nsecond", 14, 30)}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+
+  EXPECT_EQ(measurement.size.height, 60);
+}
+
+TEST(TextLayoutManagerTest, testMeasureWithMaximumNumberOfLines) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attributedStringBox =
+      makeAttributedStringBox({makeFragment(kParagraph)});
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+
+  auto singleLine = textLayoutManager.measure(
+      attributedStringBox, {}, {}, makeLayoutConstraints(kUnboundedWidth));
+  auto measurement = textLayoutManager.measure(
+      attributedStringBox,
+      paragraphAttributes,
+      {},
+      makeLayoutConstraints(100));
+  auto lines = textLayoutManager.measureLines(
+      attributedStringBox, paragraphAttributes, measurement.size);
+
+  EXPECT_EQ(lines.size(), 2);
+  EXPECT_LE(measurement.size.height, singleLine.size.height * 2);
+}
+
+TEST(TextLayoutManagerTest, testMeasureAttachments) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attachment =
+      makeFragment(AttributedString::Fragment::AttachmentCharacter());
+  attachment.parentShadowView.layoutMetrics.frame.size = {20, 10};
+
+  auto prefix = textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment("Before")}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+  auto measurement = textLayoutManager.measure(
+      makeAttributedStringBox(
+          {makeFragment("Before "), attachment, makeFragment(" after")}),
+      {},
+      {},
+      makeLayoutConstraints(kUnboundedWidth));
+
+  ASSERT_EQ(measurement.attachments.size(), 1);
+  const auto& frame = measurement.attachments[0].frame;
+  EXPECT_FALSE(measurement.attachments[0].isClipped);
+  EXPECT_EQ(frame.size, (Size{20, 10}));
+  EXPECT_GT(frame.origin.x, prefix.size.width);
+  EXPECT_LT(frame.origin.x + frame.size.width, measurement.size.width);
+  EXPECT_GE(frame.origin.y, 0);
+  EXPECT_LE(frame.origin.y + frame.size.height, measurement.size.height);
+}
+
+TEST(TextLayoutManagerTest, testMeasureConcurrently) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  auto attributedStringBoxes = std::vector<AttributedStringBox>{};
+  for (int i = 0; i < 64; i++) {
+    attributedStringBoxes.push_back(makeAttributedStringBox(
+        {makeFragment(kParagraph.substr(0, 20 + i), 12 + (i % 5))}));
+  }
+
+  auto expected = std::vector<Size>{};
+  for (const auto& attributedStringBox : attributedStringBoxes) {
+    expected.push_back(
+        TextLayoutManager{std::make_shared<ContextContainer>()}
+            .measure(attributedStringBox, {}, {}, makeLayoutConstraints(120))
+            .size);
+  }
+
+  auto threads = std::vector<std::thread>{};
+  auto results = std::vector<std::vector<Size>>(4);
+  for (auto& result : results) {
+    threads.emplace_back([&]() {
+      for (const auto& attributedStringBox : attributedStringBoxes) {
+        result.push_back(
+            textLayoutManager
+                .measure(
+                    attributedStringBox, {}, {}, makeLayoutConstraints(120))
+                .size);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& result : results) {
+    EXPECT_EQ(result, expected);
+  }
+}
+
+TEST(TextLayoutManagerTest, testMeasureAtSeveralWidthsShapesOnce) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attributedStringBox =
+      makeAttributedStringBox({makeFragment(kParagraph)});
+
+  auto widths = std::vector<Float>{kUnboundedWidth, 80, 120, 200};
+  auto sizes = std::vector<Size>{};
+  for (auto width : widths) {
+    sizes.push_back(
+        textLayoutManager
+            .measure(
+                attributedStringBox, {}, {}, makeLayoutConstraints(width))
+            .size);
+  }
+  textLayoutManager.measureLines(attributedStringBox, {}, {120, 1000});
+
+  auto counters = textLayoutManager.getHeadlessLayoutCounters();
+  EXPECT_EQ(counters.shapeCount, 1);
+  EXPECT_EQ(counters.layoutCount, widths.size() + 1);
+
+  // Results served from the measure cache don't lay the text out again.
+  textLayoutManager.measure(
+      attributedStringBox, {}, {}, makeLayoutConstraints(80));
+  EXPECT_EQ(
+      textLayoutManager.getHeadlessLayoutCounters().layoutCount,
+      widths.size() + 1);
+
+  // Matches measuring with a manager which didn't shape the text before.
+  for (size_t i = 0; i < widths.size(); i++) {
+    auto expected = TextLayoutManager{std::make_shared<ContextContainer>()}
+                        .measure(
+                            attributedStringBox,
+                            {},
+                            {},
+                            makeLayoutConstraints(widths[i]))
+                        .size;
+    EXPECT_EQ(sizes[i], expected);
+  }
+}
+
+TEST(TextLayoutManagerTest, testMeasureDifferentTextShapesAgain) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+
+  textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment(kParagraph)}),
+      {},
+      {},
+      makeLayoutConstraints(120));
+  textLayoutManager.measure(
+      makeAttributedStringBox({makeFragment(kParagraph, 18)}),
+      {},
+      {},
+      makeLayoutConstraints(120));
+
+  EXPECT_EQ(textLayoutManager.getHeadlessLayoutCounters().shapeCount, 2);
 }
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/TextLayout.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/utils/ContextContainer.h>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr const char* kWords[] = {
+    "the",     "quick",  "brown",  "fox",     "jumps",      "over",
+    "lazy",    "dog",    "React",  "Native",  "text",       "layout",
+    "wraps",   "across", "line",   "break",   "12.50",      "(hello)",
+    "world!",  "日本語", "の",     "テキスト", "です。",    "well-known"};
+
+/*
+ * Deterministic mix of paragraphs: plain Latin text, text mixed with CJK and
+ * numbers, and paragraphs made of several fragments with different font
+ * sizes and line heights.
+ */
+std::vector<AttributedString> makeParagraphs(size_t count) {
+  auto paragraphs = std::vector<AttributedString>{};
+  paragraphs.reserve(count);
+
+  uint32_t seed = 42;
+  auto next = [&]() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+  };
+
+  for (size_t i = 0; i < count; i++) {
+    auto attributedString = AttributedString{};
+    auto fragmentCount = 1 + next() % 3;
+    for (size_t j = 0; j < fragmentCount; j++) {
+      auto string = std::string{};
+      auto wordCount = 5 + next() % 40;
+      for (size_t k = 0; k < wordCount; k++) {
+        string += kWords[next() % std::size(kWords)];
+        string += k + 1 < wordCount ? " " : "";
+      }
+      auto textAttributes = TextAttributes{};
+      textAttributes.fontSize = 12 + static_cast<Float>(next() % 8);
+      textAttributes.lineHeight = next() % 4 == 0
+          ? 24
+          : std::numeric_limits<Float>::quiet_NaN();
+      attributedString.appendFragment(
+          {.string = std::move(string),
+           .textAttributes = textAttributes,
+           .parentShadowView = {}});
+    }
+    paragraphs.push_back(std::move(attributedString));
+  }
+  return paragraphs;
+}
+
+const auto paragraphs = makeParagraphs(256);
+
+size_t getTotalLength(const std::vector<AttributedString>& paragraphs) {
+  auto length = size_t{0};
+  for (const auto& paragraph : paragraphs) {
+    length += paragraph.getString().size();
+  }
+  return length;
+}
+
+LayoutConstraints makeLayoutConstraints(Float maximumWidth) {
+  return {
+      .minimumSize = {0, 0},
+      .maximumSize = {maximumWidth, std::numeric_limits<Float>::infinity()}};
+}
+
+} // namespace
+
+static void layoutParagraphs(benchmark::State& state) {
+  auto paragraphAttributes = ParagraphAttributes{};
+  auto layoutConstraints = makeLayoutConstraints(state.range(0));
+
+  for (auto _ : state) {
+    for (const auto& paragraph : paragraphs) {
+      benchmark::DoNotOptimize(
+          layoutText(paragraph, paragraphAttributes, layoutConstraints));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * paragraphs.size());
+  state.SetBytesProcessed(state.iterations() * getTotalLength(paragraphs));
+}
+BENCHMARK(layoutParagraphs)->Arg(120)->Arg(360)->Arg(10000);
+
+/*
+ * Breaks already shaped paragraphs into lines, as measuring a paragraph again
+ * with different constraints does.
+ */
+static void layoutShapedParagraphs(benchmark::State& state) {
+  auto shapedTexts = std::vector<std::shared_ptr<const ShapedText>>{};
+  for (const auto& paragraph : paragraphs) {
+    shapedTexts.push_back(shapeText(paragraph));
+  }
+  auto paragraphAttributes = ParagraphAttributes{};
+  auto layoutConstraints = makeLayoutConstraints(state.range(0));
+
+  for (auto _ : state) {
+    for (const auto& shapedText : shapedTexts) {
+      benchmark::DoNotOptimize(layoutShapedText(
+          *shapedText, paragraphAttributes, layoutConstraints));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * paragraphs.size());
+  state.SetBytesProcessed(state.iterations() * getTotalLength(paragraphs));
+}
+BENCHMARK(layoutShapedParagraphs)->Arg(120)->Arg(360)->Arg(10000);
+
+/*
+ * Measures through `TextLayoutManager`, with a different width on every
+ * iteration so that results aren't served from the measure cache. Paragraphs
+ * are only shaped on the first iteration.
+ */
+static void measureParagraphs(benchmark::State& state) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attributedStringBoxes = std::vector<AttributedStringBox>{};
+  for (const auto& paragraph : paragraphs) {
+    attributedStringBoxes.emplace_back(paragraph);
+  }
+  auto width = Float{200};
+
+  for (auto _ : state) {
+    auto layoutConstraints = makeLayoutConstraints(width);
+    width = width < 400 ? width + 1 : 200;
+    for (const auto& attributedStringBox : attributedStringBoxes) {
+      benchmark::DoNotOptimize(textLayoutManager.measure(
+          attributedStringBox, {}, {}, layoutConstraints));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * paragraphs.size());
+}
+BENCHMARK(measureParagraphs);
+
+/*
+ * Measures paragraphs through a `TextLayoutManager` shared by several threads
+ * at once, as concurrent surfaces do. Every thread measures at its own widths,
+ * so that results aren't served from the measure cache. Layout runs outside of
+ * the locks of the caches and only reads immutable tables, so throughput
+ * should scale with the number of threads.
+ */
+static void measureParagraphsConcurrently(benchmark::State& state) {
+  static auto textLayoutManager =
+      TextLayoutManager{std::make_shared<ContextContainer>()};
+  auto attributedStringBoxes = std::vector<AttributedStringBox>{};
+  for (const auto& paragraph : paragraphs) {
+    attributedStringBoxes.emplace_back(paragraph);
+  }
+  auto minimumWidth = Float{200} + 1000 * state.thread_index();
+  auto width = minimumWidth;
+
+  for (auto _ : state) {
+    auto layoutConstraints = makeLayoutConstraints(width);
+    width = width < minimumWidth + 200 ? width + 1 : minimumWidth;
+    for (const auto& attributedStringBox : attributedStringBoxes) {
+      benchmark::DoNotOptimize(textLayoutManager.measure(
+          attributedStringBox, {}, {}, layoutConstraints));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * paragraphs.size());
+}
+BENCHMARK(measureParagraphsConcurrently)->ThreadRange(1, 8)->UseRealTime();
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Live heap bytes, to report the memory retained by a chat surface.
+std::atomic<size_t> liveBytes{0};
+
+constexpr size_t kAllocationHeaderSize = alignof(std::max_align_t);
+
+} // namespace
+
+void* operator new(size_t size) {
+  auto* allocation =
+      static_cast<char*>(std::malloc(size + kAllocationHeaderSize));
+  if (allocation == nullptr) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<size_t*>(allocation) = size;
+  liveBytes.fetch_add(size, std::memory_order_relaxed);
+  return allocation + kAllocationHeaderSize;
+}
+
+void operator delete(void* pointer) noexcept {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto* allocation = static_cast<char*>(pointer) - kAllocationHeaderSize;
+  liveBytes.fetch_sub(
+      *reinterpret_cast<size_t*>(allocation), std::memory_order_relaxed);
+  std::free(allocation);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+  operator delete(pointer);
+}
+
+namespace facebook::react {
+
+namespace {
+
+constexpr size_t kMessageCount = 1000;
+
+constexpr const char* kSenders[] = {
+    "Alice", "Bob", "Charlie", "Dana", "Eve", "Frank", "Grace", "Heidi"};
+
+constexpr const char* kReplies[] = {
+    "ok",
+    "lol",
+    "Sounds good to me!",
+    "On my way, see you in ten minutes.",
+    "Did you see the game last night? That last minute goal was unbelievable.",
+};
+
+/*
+ * The text of a chat message, as it would be split into the raw texts of a
+ * `<Text>` with a bold sender, a body and a timestamp.
+ */
+struct Message {
+  std::string sender;
+  std::string body;
+  std::string timestamp;
+};
+
+std::vector<Message> makeMessages() {
+  auto messages = std::vector<Message>{};
+  uint32_t seed = 7;
+  auto next = [&]() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+  };
+
+  for (size_t i = 0; i < kMessageCount; i++) {
+    auto message = Message{};
+    message.sender = kSenders[next() % std::size(kSenders)];
+    if (next() % 2 == 0) {
+      message.body = kReplies[next() % std::size(kReplies)];
+    } else {
+      // A unique message, long enough not to fit the small string buffer.
+      message.body = "Message #" + std::to_string(i) +
+          ": let's meet at the usual place and bring the documents.";
+    }
+    message.timestamp = std::to_string(9 + i / 60 % 12) + ":" +
+        std::to_string(10 + i % 50) + " PM";
+    messages.push_back(std::move(message));
+  }
+  return messages;
+}
+
+const auto messages = makeMessages();
+
+TextAttributes makeTextAttributes(
+    FontWeight fontWeight,
+    Float fontSize,
+    SharedColor color) {
+  auto textAttributes = TextAttributes::defaultTextAttributes();
+  textAttributes.fontWeight = fontWeight;
+  textAttributes.fontSize = fontSize;
+  textAttributes.foregroundColor = color;
+  return textAttributes;
+}
+
+/*
+ * Builds attributed strings the way `BaseTextShadowNode` does, from text
+ * attributes which are computed for every paragraph.
+ */
+std::vector<AttributedString> buildAttributedStrings() {
+  auto attributedStrings = std::vector<AttributedString>{};
+  attributedStrings.reserve(messages.size());
+  for (const auto& message : messages) {
+    auto attributedString = AttributedString{};
+    attributedString.appendFragment(
+        {.string = message.sender,
+         .textAttributes =
+             makeTextAttributes(FontWeight::Bold, 15, blackColor()),
+         .parentShadowView = {}});
+    attributedString.appendFragment(
+        {.string = message.body,
+         .textAttributes =
+             makeTextAttributes(FontWeight::Regular, 15, blackColor()),
+         .parentShadowView = {}});
+    attributedString.appendFragment(
+        {.string = message.timestamp,
+         .textAttributes =
+             makeTextAttributes(FontWeight::Regular, 11, clearColor()),
+         .parentShadowView = {}});
+    attributedStrings.push_back(std::move(attributedString));
+  }
+  return attributedStrings;
+}
+
+TextMeasureCacheKey makeCacheKey(const AttributedString& attributedString) {
+  auto key = TextMeasureCacheKey{};
+  key.attributedString = attributedString;
+  return key;
+}
+
+} // namespace
+
+/*
+ * Memory retained by the attributed strings of a 1k message chat surface
+ * across two commits: each commit rebuilds the attributed strings of its
+ * paragraphs, which are also retained by their states and by the keys of the
+ * measure cache.
+ */
+static void chatSurfaceRetainedMemory(benchmark::State& state) {
+  auto retainedBytes = size_t{0};
+
+  for (auto _ : state) {
+    auto before = liveBytes.load();
+    {
+      auto commits = std::vector<std::vector<AttributedString>>{};
+      auto cacheKeys = std::vector<TextMeasureCacheKey>{};
+      for (int i = 0; i < 2; i++) {
+        commits.push_back(buildAttributedStrings());
+        for (const auto& attributedString : commits.back()) {
+          cacheKeys.push_back(makeCacheKey(attributedString));
+        }
+      }
+      retainedBytes = liveBytes.load() - before;
+      benchmark::DoNotOptimize(commits);
+    }
+  }
+
+  state.counters["retained_bytes"] = static_cast<double>(retainedBytes);
+  state.SetItemsProcessed(state.iterations() * kMessageCount * 2);
+}
+BENCHMARK(chatSurfaceRetainedMemory);
+
+/*
+ * Hashes and compares the measure cache keys of a 1k message chat surface
+ * with the keys of its previous commit, as looking them up in the measure
+ * cache does.
+ */
+static void chatSurfaceCacheKeyLookup(benchmark::State& state) {
+  auto previousKeys = std::vector<TextMeasureCacheKey>{};
+  for (const auto& attributedString : buildAttributedStrings()) {
+    previousKeys.push_back(makeCacheKey(attributedString));
+  }
+  auto keys = std::vector<TextMeasureCacheKey>{};
+  for (const auto& attributedString : buildAttributedStrings()) {
+    keys.push_back(makeCacheKey(attributedString));
+  }
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < keys.size(); i++) {
+      benchmark::DoNotOptimize(std::hash<TextMeasureCacheKey>{}(keys[i]));
+      benchmark::DoNotOptimize(keys[i] == previousKeys[i]);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(chatSurfaceCacheKeyLookup);
+
+/*
+ * Builds the attributed strings of a 1k message chat surface, which interns
+ * their strings and text attributes.
+ */
+static void chatSurfaceBuildAttributedStrings(benchmark::State& state) {
+  // Keeps the interned values of the surface alive, as the previous commit
+  // does.
+  auto previousCommit = buildAttributedStrings();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(buildAttributedStrings());
+  }
+
+  state.SetItemsProcessed(state.iterations() * kMessageCount);
+}
+BENCHMARK(chatSurfaceBuildAttributedStrings);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
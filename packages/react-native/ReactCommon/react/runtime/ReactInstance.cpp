@@ -27,10 +27,25 @@
 #include <memory>
 #include <utility>
 
+#ifdef RN_JSI_CALL_COUNTERS
+#include <react/runtime/CountingRuntime.h>
+#endif
+
 namespace facebook::react {
 
 namespace {
 
+std::shared_ptr<JSRuntime> decorateRuntime(
+    std::unique_ptr<JSRuntime> runtime) {
+#ifdef RN_JSI_CALL_COUNTERS
+  // Counts the JSI calls made while the runtime is profiled for a
+  // performance trace.
+  return std::make_shared<CountingJSRuntime>(std::move(runtime));
+#else
+  return runtime;
+#endif
+}
+
 std::shared_ptr<RuntimeScheduler> createRuntimeScheduler(
     RuntimeExecutor runtimeExecutor,
     RuntimeSchedulerTaskErrorHandler taskErrorHandler) {
@@ -53,7 +68,7 @@ ReactInstance::ReactInstance(
     std::shared_ptr<TimerManager> timerManager,
     JsErrorHandler::OnJsError onJsError,
     jsinspector_modern::HostTarget* parentInspectorTarget)
-    : runtime_(std::move(runtime)),
+    : runtime_(decorateRuntime(std::move(runtime))),
       jsMessageQueueThread_(jsMessageQueueThread),
       timerManager_(std::move(timerManager)),
       jsErrorHandler_(std::make_shared<JsErrorHandler>(std::move(onJsError))),
@@ -147,6 +162,8 @@ ReactInstance::ReactInstance(
         });
   }
 
+  timerManager_->setRuntimeScheduler(runtimeScheduler_);
+
   bufferedRuntimeExecutor_ = std::make_shared<BufferedRuntimeExecutor>(
       [runtimeScheduler = runtimeScheduler_.get()](
           std::function<void(jsi::Runtime & runtime)>&& callback) {
@@ -9,7 +9,10 @@
 
 #include <cxxreact/TraceSection.h>
 #include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/utils/OnScopeExit.h>
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
 
@@ -51,17 +54,29 @@ inline const char* getTimerSourceName(TimerSource source) {
   return "unknown";
 }
 
+// Bounds the delays of timers to a range where milliseconds are exact as
+// doubles.
+constexpr double kMaxTimerDelay = 1ull << 52;
+
 } // namespace
 
 TimerManager::TimerManager(
-    std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept
-    : platformTimerRegistry_(std::move(platformTimerRegistry)) {}
+    std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry,
+    std::function<HighResTimeStamp()> now) noexcept
+    : platformTimerRegistry_(std::move(platformTimerRegistry)),
+      now_(std::move(now)),
+      timerWheelOrigin_(now_()) {}
 
 void TimerManager::setRuntimeExecutor(
     RuntimeExecutor runtimeExecutor) noexcept {
   runtimeExecutor_ = runtimeExecutor;
 }
 
+void TimerManager::setRuntimeScheduler(
+    std::weak_ptr<RuntimeScheduler> runtimeScheduler) noexcept {
+  runtimeScheduler_ = std::move(runtimeScheduler);
+}
+
 TimerHandle TimerManager::createReactNativeMicrotask(
     jsi::Function&& callback,
     std::vector<jsi::Value>&& args) {
@@ -114,16 +129,15 @@ TimerHandle TimerManager::createTimer(
       "delay",
       delay);
 
-  timers_.emplace(
-      std::piecewise_construct,
-      std::forward_as_tuple(timerID),
-      std::forward_as_tuple(
-          std::move(callback),
-          std::move(args),
-          /* repeat */ false,
-          source));
-
-  platformTimerRegistry_->createTimer(timerID, delay);
+  auto result = timers_.try_emplace(
+      timerID,
+      std::move(callback),
+      std::move(args),
+      /* repeat */ false,
+      source);
+  auto& timerCallback = result.first->second;
+  timerCallback.delay = delay;
+  scheduleTimer(timerID, timerCallback);
 
   return timerID;
 }
@@ -145,13 +159,15 @@ TimerHandle TimerManager::createRecurringTimer(
       "delay",
       delay);
 
-  timers_.emplace(
-      std::piecewise_construct,
-      std::forward_as_tuple(timerID),
-      std::forward_as_tuple(
-          std::move(callback), std::move(args), /* repeat */ true, source));
-
-  platformTimerRegistry_->createRecurringTimer(timerID, delay);
+  auto result = timers_.try_emplace(
+      timerID,
+      std::move(callback),
+      std::move(args),
+      /* repeat */ true,
+      source);
+  auto& timerCallback = result.first->second;
+  timerCallback.delay = delay;
+  scheduleTimer(timerID, timerCallback);
 
   return timerID;
 }
@@ -179,8 +195,16 @@ void TimerManager::deleteTimer(jsi::Runtime& runtime, TimerHandle timerHandle) {
     throw jsi::JSError(runtime, "clearTimeout called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
-  timers_.erase(timerHandle);
+  auto it = timers_.find(timerHandle);
+  if (it == timers_.end()) {
+    return;
+  }
+
+  timerWheel_.cancel(it->second.entryId, timerHandle);
+  timers_.erase(it);
+  if (timerWheel_.empty()) {
+    cancelWakeup();
+  }
 }
 
 void TimerManager::deleteRecurringTimer(
@@ -190,11 +214,16 @@ void TimerManager::deleteRecurringTimer(
     throw jsi::JSError(runtime, "clearInterval called with an invalid handle");
   }
 
-  platformTimerRegistry_->deleteTimer(timerHandle);
-  timers_.erase(timerHandle);
+  deleteTimer(runtime, timerHandle);
 }
 
 void TimerManager::callTimer(TimerHandle timerHandle) {
+  if (timerHandle == kWakeupTimerHandle) {
+    runtimeExecutor_(
+        [this](jsi::Runtime& runtime) { callExpiredTimers(runtime); });
+    return;
+  }
+
   runtimeExecutor_([this, timerHandle](jsi::Runtime& runtime) {
     auto it = timers_.find(timerHandle);
     if (it != timers_.end()) {
@@ -214,12 +243,122 @@ void TimerManager::callTimer(TimerHandle timerHandle) {
       if (!repeats) {
         // Invoking a timer has the potential to delete it. Do not re-use the
         // existing iterator to erase it from the map.
-        timers_.erase(timerHandle);
+        it = timers_.find(timerHandle);
+        if (it != timers_.end()) {
+          timerWheel_.cancel(it->second.entryId, timerHandle);
+          timers_.erase(it);
+        }
       }
     }
   });
 }
 
+void TimerManager::scheduleTimer(
+    TimerHandle timerHandle,
+    TimerCallback& timerCallback) {
+  // Timers expire on the millisecond, as they do on the platforms. Both the
+  // current time and the delay are rounded up, so that timers are never
+  // called before their delay has elapsed.
+  auto delay = std::min(std::ceil(timerCallback.delay), kMaxTimerDelay);
+  auto deadline = static_cast<uint64_t>(
+      std::max(0.0, std::ceil(getElapsedTime())) + delay);
+  timerCallback.entryId = timerWheel_.schedule(timerHandle, deadline);
+
+  if (!wakeupDeadline_ || deadline < *wakeupDeadline_) {
+    scheduleWakeup(deadline);
+  }
+}
+
+void TimerManager::callExpiredTimers(jsi::Runtime& runtime) {
+  TraceSection s("TimerManager::callExpiredTimers");
+
+  // A batch is only left unfinished when one of its timers throws: the rest
+  // of it is called before any timer that expired since.
+  if (nextExpiredTimer_ == expiredTimers_.size()) {
+    expiredTimers_.clear();
+    nextExpiredTimer_ = 0;
+    timerWheel_.advance(getWheelTime(), expiredTimers_);
+  }
+
+  // As the HTML event loop does after running the callback of a timer, the
+  // microtasks queued by each timer of the batch are drained before the next
+  // one is called.
+  auto runtimeScheduler = runtimeScheduler_.lock();
+
+  OnScopeExit callRemainingTimers([this]() {
+    if (nextExpiredTimer_ < expiredTimers_.size()) {
+      // Call the timers after the one that threw in their own task, after the
+      // error is reported, as if they had not been batched.
+      runtimeExecutor_(
+          [this](jsi::Runtime& runtime) { callExpiredTimers(runtime); });
+    }
+  });
+
+  while (nextExpiredTimer_ < expiredTimers_.size()) {
+    auto timerHandle = expiredTimers_[nextExpiredTimer_++];
+    auto it = timers_.find(timerHandle);
+    if (it == timers_.end()) {
+      // Deleted by a timer called earlier in the batch.
+      continue;
+    }
+
+    auto& timerCallback = it->second;
+    TraceSection timerSection(
+        "TimerManager::callTimer",
+        "id",
+        timerHandle,
+        "type",
+        getTimerSourceName(timerCallback.source));
+    if (timerCallback.repeat) {
+      scheduleTimer(timerHandle, timerCallback);
+      timerCallback.invoke(runtime);
+    } else {
+      // Invoking a timer has the potential to delete it. Do not re-use the
+      // existing iterator to erase it from the map.
+      OnScopeExit eraseTimer([&]() { timers_.erase(timerHandle); });
+      timerCallback.invoke(runtime);
+    }
+
+    if (runtimeScheduler) {
+      runtimeScheduler->performMicrotaskCheckpoint(runtime);
+    }
+  }
+
+  // The wakeup that was scheduled has been consumed, or is about to be if
+  // another wakeup got ahead of it, so a new one is always scheduled.
+  if (auto deadline = timerWheel_.nextDeadline()) {
+    scheduleWakeup(*deadline);
+  } else {
+    cancelWakeup();
+  }
+}
+
+void TimerManager::scheduleWakeup(uint64_t deadline) {
+  if (wakeupDeadline_) {
+    platformTimerRegistry_->deleteTimer(kWakeupTimerHandle);
+  }
+
+  wakeupDeadline_ = deadline;
+  auto delay = static_cast<double>(deadline) - getElapsedTime();
+  platformTimerRegistry_->createTimer(
+      kWakeupTimerHandle, std::max(0.0, std::ceil(delay)));
+}
+
+void TimerManager::cancelWakeup() {
+  if (wakeupDeadline_) {
+    platformTimerRegistry_->deleteTimer(kWakeupTimerHandle);
+    wakeupDeadline_.reset();
+  }
+}
+
+double TimerManager::getElapsedTime() const {
+  return (now_() - timerWheelOrigin_).toDOMHighResTimeStamp();
+}
+
+uint64_t TimerManager::getWheelTime() const {
+  return static_cast<uint64_t>(std::max(0.0, std::floor(getElapsedTime())));
+}
+
 void TimerManager::attachGlobals(jsi::Runtime& runtime) {
   // Install host functions for timers.
   // TODO (T45786383): Add missing timer functions from JSTimers
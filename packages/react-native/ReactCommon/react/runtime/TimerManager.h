@@ -8,15 +8,20 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <react/timing/primitives.h>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
 #include "PlatformTimerRegistry.h"
+#include "TimerWheel.h"
 
 namespace facebook::react {
 
-using TimerHandle = int;
+class RuntimeScheduler;
 
 enum class TimerSource {
   Unknown,
@@ -47,15 +52,33 @@ struct TimerCallback {
   const std::vector<jsi::Value> args_;
   bool repeat;
   TimerSource source;
+
+  // The delay of the timer, in milliseconds, and its entry in the timer wheel.
+  double delay{0};
+  TimerWheel::EntryId entryId{0};
 };
 
+/*
+ * Owns the JS timers. Their deadlines are tracked in a timer wheel, and only
+ * the earliest one is scheduled on the platform, as the timer with the
+ * `kWakeupTimerHandle` handle. When the platform calls it, every timer that
+ * expired is called in a single task on the JS thread, with a microtask
+ * checkpoint of the runtime scheduler after each of them.
+ */
 class TimerManager {
  public:
+  // The handles of JS timers start at 1, so this one never collides with them.
+  static constexpr TimerHandle kWakeupTimerHandle = 0;
+
   explicit TimerManager(
-      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry) noexcept;
+      std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry,
+      std::function<HighResTimeStamp()> now = HighResTimeStamp::now) noexcept;
 
   void setRuntimeExecutor(RuntimeExecutor runtimeExecutor) noexcept;
 
+  void setRuntimeScheduler(
+      std::weak_ptr<RuntimeScheduler> runtimeScheduler) noexcept;
+
   void callReactNativeMicrotasks(jsi::Runtime& runtime);
 
   void callTimer(TimerHandle handle);
@@ -85,8 +108,23 @@ class TimerManager {
 
   void deleteRecurringTimer(jsi::Runtime& runtime, TimerHandle handle);
 
+  void scheduleTimer(TimerHandle handle, TimerCallback& timerCallback);
+
+  void callExpiredTimers(jsi::Runtime& runtime);
+
+  void scheduleWakeup(uint64_t deadline);
+
+  void cancelWakeup();
+
+  // Milliseconds elapsed since the creation of the timer wheel, and the same
+  // rounded down, as the timer wheel tracks them.
+  double getElapsedTime() const;
+  uint64_t getWheelTime() const;
+
   RuntimeExecutor runtimeExecutor_;
+  std::weak_ptr<RuntimeScheduler> runtimeScheduler_;
   std::unique_ptr<PlatformTimerRegistry> platformTimerRegistry_;
+  std::function<HighResTimeStamp()> now_;
 
   // A map (id => callback func) of the currently active JS timers
   std::unordered_map<TimerHandle, TimerCallback> timers_;
@@ -97,6 +135,19 @@ class TimerManager {
   // at 1
   TimerHandle timerIndex_{1};
 
+  // The deadlines of the active JS timers, in milliseconds since
+  // `timerWheelOrigin_`.
+  HighResTimeStamp timerWheelOrigin_;
+  TimerWheel timerWheel_;
+
+  // The deadline of the wakeup scheduled on the platform, if any.
+  std::optional<uint64_t> wakeupDeadline_;
+
+  // The timers that expired in the batch being called, and the next one to
+  // call.
+  std::vector<TimerHandle> expiredTimers_;
+  size_t nextExpiredTimer_{0};
+
   // The React Native microtask queue is used to back public APIs including
   // `queueMicrotask`, `clearImmediate`, and `setImmediate` (which is used by
   // the Promise polyfill) when the JSVM microtask mechanism is not used.
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TimerWheel.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace facebook::react {
+
+namespace {
+
+constexpr uint64_t kSlotMask = TimerWheel::kSlotCount - 1;
+
+} // namespace
+
+TimerWheel::TimerWheel() noexcept {
+  slots_.fill(kNoEntry);
+}
+
+TimerWheel::EntryId TimerWheel::schedule(
+    TimerHandle handle,
+    uint64_t deadline) {
+  EntryId entryId = freeEntries_;
+  if (entryId != kNoEntry) {
+    freeEntries_ = entries_[entryId].next;
+  } else {
+    entryId = static_cast<EntryId>(entries_.size());
+    entries_.emplace_back();
+  }
+
+  auto& entry = entries_[entryId];
+  entry.handle = handle;
+  entry.deadline = deadline;
+  place(entryId);
+  size_++;
+  return entryId;
+}
+
+bool TimerWheel::cancel(EntryId entryId, TimerHandle handle) {
+  if (entryId >= entries_.size()) {
+    return false;
+  }
+
+  const auto& entry = entries_[entryId];
+  if (entry.slot == kNoSlot || entry.handle != handle) {
+    // The timer already expired, and the entry may have been reused since.
+    return false;
+  }
+
+  unlink(entryId);
+  release(entryId);
+  return true;
+}
+
+void TimerWheel::advance(uint64_t time, std::vector<TimerHandle>& expired) {
+  collect(kExpiredSlot);
+
+  while (true) {
+    auto eventTime = nextEventTime();
+    if (!eventTime || *eventTime > time) {
+      time_ = std::max(time_, time);
+      break;
+    }
+
+    time_ = *eventTime;
+
+    // Re-place the timers of the slots that start now, from the highest
+    // level down, so that they cascade to the levels below.
+    if (time_ % (uint64_t{1} << (kLevelBits * kLevelCount)) == 0) {
+      cascade(kOverflowSlot);
+    }
+    for (size_t level = kLevelCount - 1; level > 0; level--) {
+      auto shift = kLevelBits * level;
+      if (time_ % (uint64_t{1} << shift) == 0) {
+        cascade(level * kSlotCount + ((time_ >> shift) & kSlotMask));
+      }
+    }
+
+    collect(time_ & kSlotMask);
+    collect(kExpiredSlot);
+  }
+
+  std::sort(collected_.begin(), collected_.end());
+  for (const auto& [deadline, handle] : collected_) {
+    expired.push_back(handle);
+  }
+  collected_.clear();
+}
+
+std::optional<uint64_t> TimerWheel::nextDeadline() const {
+  if (slots_[kExpiredSlot] != kNoEntry) {
+    return minDeadline(kExpiredSlot);
+  }
+
+  // Timers of lower levels always expire before those of higher levels, and
+  // all the timers of the first slot of a level expire at once.
+  if (occupiedSlots_[0] != 0) {
+    return ((time_ >> kLevelBits) << kLevelBits) |
+        std::countr_zero(occupiedSlots_[0]);
+  }
+  for (size_t level = 1; level < kLevelCount; level++) {
+    if (occupiedSlots_[level] != 0) {
+      return minDeadline(
+          level * kSlotCount + std::countr_zero(occupiedSlots_[level]));
+    }
+  }
+
+  if (slots_[kOverflowSlot] != kNoEntry) {
+    return minDeadline(kOverflowSlot);
+  }
+
+  return std::nullopt;
+}
+
+void TimerWheel::place(EntryId entryId) {
+  auto& entry = entries_[entryId];
+
+  if (entry.deadline <= time_) {
+    entry.slot = kExpiredSlot;
+  } else {
+    // The lowest level whose slots tell the deadline apart from the current
+    // time, i.e. the level of the highest bit where they differ. The slot of
+    // the deadline on that level is always ahead of the current one.
+    auto level = (std::bit_width(entry.deadline ^ time_) - 1) / kLevelBits;
+    if (level >= kLevelCount) {
+      entry.slot = kOverflowSlot;
+    } else {
+      auto slot = (entry.deadline >> (kLevelBits * level)) & kSlotMask;
+      entry.slot = static_cast<uint16_t>(level * kSlotCount + slot);
+      occupiedSlots_[level] |= uint64_t{1} << slot;
+    }
+  }
+
+  entry.previous = kNoEntry;
+  entry.next = slots_[entry.slot];
+  if (entry.next != kNoEntry) {
+    entries_[entry.next].previous = entryId;
+  }
+  slots_[entry.slot] = entryId;
+}
+
+void TimerWheel::unlink(EntryId entryId) {
+  auto& entry = entries_[entryId];
+
+  if (entry.previous != kNoEntry) {
+    entries_[entry.previous].next = entry.next;
+  } else {
+    slots_[entry.slot] = entry.next;
+    if (entry.next == kNoEntry && entry.slot < kOverflowSlot) {
+      occupiedSlots_[entry.slot / kSlotCount] &=
+          ~(uint64_t{1} << (entry.slot & kSlotMask));
+    }
+  }
+  if (entry.next != kNoEntry) {
+    entries_[entry.next].previous = entry.previous;
+  }
+
+  entry.slot = kNoSlot;
+}
+
+void TimerWheel::release(EntryId entryId) {
+  auto& entry = entries_[entryId];
+  entry.slot = kNoSlot;
+  entry.next = freeEntries_;
+  freeEntries_ = entryId;
+  size_--;
+}
+
+void TimerWheel::cascade(uint16_t slot) {
+  auto entryId = slots_[slot];
+  if (entryId == kNoEntry) {
+    return;
+  }
+
+  slots_[slot] = kNoEntry;
+  if (slot < kOverflowSlot) {
+    occupiedSlots_[slot / kSlotCount] &= ~(uint64_t{1} << (slot & kSlotMask));
+  }
+
+  while (entryId != kNoEntry) {
+    auto next = entries_[entryId].next;
+    place(entryId);
+    entryId = next;
+  }
+}
+
+void TimerWheel::collect(uint16_t slot) {
+  auto entryId = slots_[slot];
+  if (entryId == kNoEntry) {
+    return;
+  }
+
+  slots_[slot] = kNoEntry;
+  if (slot < kOverflowSlot) {
+    occupiedSlots_[slot / kSlotCount] &= ~(uint64_t{1} << (slot & kSlotMask));
+  }
+
+  while (entryId != kNoEntry) {
+    const auto& entry = entries_[entryId];
+    auto next = entry.next;
+    collected_.emplace_back(entry.deadline, entry.handle);
+    release(entryId);
+    entryId = next;
+  }
+}
+
+uint64_t TimerWheel::minDeadline(uint16_t slot) const {
+  auto deadline = UINT64_MAX;
+  for (auto entryId = slots_[slot]; entryId != kNoEntry;
+       entryId = entries_[entryId].next) {
+    deadline = std::min(deadline, entries_[entryId].deadline);
+  }
+  return deadline;
+}
+
+std::optional<uint64_t> TimerWheel::nextEventTime() const {
+  // The time at which the first non-empty slot of each level starts: the
+  // deadline of its timers on the first level, and the time to cascade them
+  // on the others. The slots of a level that are behind the current one are
+  // always empty.
+  std::optional<uint64_t> eventTime;
+  for (size_t level = 0; level < kLevelCount; level++) {
+    if (occupiedSlots_[level] == 0) {
+      continue;
+    }
+    auto shift = kLevelBits * level;
+    auto turn = (time_ >> (shift + kLevelBits)) << (shift + kLevelBits);
+    auto slotTime = turn |
+        (static_cast<uint64_t>(std::countr_zero(occupiedSlots_[level]))
+         << shift);
+    if (!eventTime || slotTime < *eventTime) {
+      eventTime = slotTime;
+    }
+  }
+
+  if (slots_[kOverflowSlot] != kNoEntry) {
+    auto shift = kLevelBits * kLevelCount;
+    auto overflowTime = ((time_ >> shift) + 1) << shift;
+    if (!eventTime || overflowTime < *eventTime) {
+      eventTime = overflowTime;
+    }
+  }
+
+  return eventTime;
+}
+
+} // namespace facebook::react
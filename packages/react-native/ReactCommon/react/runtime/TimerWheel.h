@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+using TimerHandle = int;
+
+/*
+ * A hierarchical timing wheel tracking the deadlines of timers, in
+ * milliseconds since an arbitrary origin.
+ *
+ * Each level has `kSlotCount` slots: the slots of the first level span a
+ * millisecond, and the slots of every other level span a whole turn of the
+ * level below it. Timers are placed on the lowest level that can tell their
+ * deadline apart from the current time, and cascade to lower levels as time
+ * advances, so scheduling and cancelling a timer take constant time however
+ * many timers are pending.
+ *
+ * Not thread safe.
+ */
+class TimerWheel {
+ public:
+  /*
+   * Identifies a timer scheduled in the wheel. Entries are reused once their
+   * timer expired or was cancelled.
+   */
+  using EntryId = uint32_t;
+
+  TimerWheel() noexcept;
+
+  static constexpr size_t kLevelCount = 6;
+  static constexpr size_t kSlotCount = 64;
+
+  /*
+   * Schedules the timer with the given handle to expire at `deadline`.
+   * Deadlines that are not after the current time of the wheel expire on the
+   * next call to `advance`.
+   */
+  EntryId schedule(TimerHandle handle, uint64_t deadline);
+
+  /*
+   * Cancels the timer if it is still pending. Returns whether it was.
+   */
+  bool cancel(EntryId entryId, TimerHandle handle);
+
+  /*
+   * Moves the current time of the wheel forward to `time` and appends the
+   * handles of the timers that expired to `expired`, ordered by deadline and
+   * then by handle.
+   */
+  void advance(uint64_t time, std::vector<TimerHandle>& expired);
+
+  /*
+   * The earliest deadline of the pending timers, if any.
+   */
+  std::optional<uint64_t> nextDeadline() const;
+
+  uint64_t time() const {
+    return time_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  static constexpr size_t kLevelBits = 6;
+  static_assert(kSlotCount == 1 << kLevelBits);
+
+  // Timers with deadlines past the range of the last level, and timers whose
+  // deadline already passed.
+  static constexpr uint16_t kOverflowSlot = kLevelCount * kSlotCount;
+  static constexpr uint16_t kExpiredSlot = kOverflowSlot + 1;
+  static constexpr uint16_t kNoSlot = kExpiredSlot + 1;
+
+  static constexpr EntryId kNoEntry = UINT32_MAX;
+
+  struct Entry {
+    TimerHandle handle{0};
+    uint64_t deadline{0};
+    EntryId previous{kNoEntry};
+    EntryId next{kNoEntry};
+    uint16_t slot{kNoSlot};
+  };
+
+  void place(EntryId entryId);
+  void unlink(EntryId entryId);
+  void release(EntryId entryId);
+  void cascade(uint16_t slot);
+  void collect(uint16_t slot);
+  uint64_t minDeadline(uint16_t slot) const;
+  std::optional<uint64_t> nextEventTime() const;
+
+  std::vector<Entry> entries_;
+  EntryId freeEntries_{kNoEntry};
+  std::array<EntryId, kNoSlot> slots_;
+  // One bit per non-empty slot of each level.
+  std::array<uint64_t, kLevelCount> occupiedSlots_{};
+  uint64_t time_{0};
+  size_t size_{0};
+
+  // Deadlines and handles of the timers collected by `advance`.
+  std::vector<std::pair<uint64_t, TimerHandle>> collected_;
+};
+
+} // namespace facebook::react
@@ -59,6 +59,8 @@ static void mapReactMarkerToPerformanceLogger(
     case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
     case ReactMarker::REGISTER_JS_SEGMENT_START:
     case ReactMarker::REGISTER_JS_SEGMENT_STOP:
+    case ReactMarker::INSTALL_RUNTIME_BINDING_START:
+    case ReactMarker::INSTALL_RUNTIME_BINDING_STOP:
       // These are not used on iOS.
       break;
   }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/runtime/TimerWheel.h>
+#include <random>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * The delays of the timers of an app debouncing input and polyfilling
+ * animations: mostly a frame or a few hundred milliseconds, and sometimes
+ * seconds or minutes.
+ */
+std::vector<uint64_t> makeDelays(size_t count) {
+  auto random = std::mt19937{42};
+  auto delays = std::vector<uint64_t>{};
+  for (size_t i = 0; i < count; i++) {
+    switch (random() % 4) {
+      case 0:
+        delays.push_back(16);
+        break;
+      case 1:
+        delays.push_back(random() % 300);
+        break;
+      case 2:
+        delays.push_back(random() % 5'000);
+        break;
+      default:
+        delays.push_back(random() % 600'000);
+        break;
+    }
+  }
+  return delays;
+}
+
+} // namespace
+
+/*
+ * Creates timers and clears them before they expire, as debounced callbacks
+ * do.
+ */
+static void scheduleAndCancelTimers(benchmark::State& state) {
+  auto delays = makeDelays(state.range(0));
+  auto wheel = TimerWheel{};
+  auto entries = std::vector<TimerWheel::EntryId>(delays.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < delays.size(); i++) {
+      entries[i] = wheel.schedule(
+          static_cast<TimerHandle>(i), wheel.time() + delays[i]);
+    }
+    for (size_t i = 0; i < delays.size(); i++) {
+      wheel.cancel(entries[i], static_cast<TimerHandle>(i));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * delays.size());
+}
+BENCHMARK(scheduleAndCancelTimers)->Arg(1'000)->Arg(100'000);
+
+/*
+ * Creates timers and lets them expire, calling the expired ones every frame.
+ */
+static void scheduleAndExpireTimers(benchmark::State& state) {
+  auto delays = makeDelays(state.range(0));
+  auto wheel = TimerWheel{};
+  auto expired = std::vector<TimerHandle>{};
+  for (auto _ : state) {
+    for (size_t i = 0; i < delays.size(); i++) {
+      wheel.schedule(static_cast<TimerHandle>(i), wheel.time() + delays[i]);
+    }
+    while (!wheel.empty()) {
+      wheel.advance(*wheel.nextDeadline() + 16, expired);
+      expired.clear();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * delays.size());
+}
+BENCHMARK(scheduleAndExpireTimers)->Arg(1'000)->Arg(100'000);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -117,13 +117,17 @@ class ReactInstanceTest : public ::testing::Test {
   ReactInstanceTest() {}
 
   void SetUp() override {
-    auto runtime =
-        std::make_unique<JSIRuntimeHolder>(hermes::makeHermesRuntime());
+    // Make promises work with Hermes microtasks.
+    auto runtimeConfig =
+        ::hermes::vm::RuntimeConfig::Builder().withMicrotaskQueue(true).build();
+    auto runtime = std::make_unique<JSIRuntimeHolder>(
+        hermes::makeHermesRuntime(runtimeConfig));
     runtime_ = &runtime->getRuntime();
     messageQueueThread_ = std::make_shared<MockMessageQueueThread>();
     auto mockRegistry = std::make_unique<MockTimerRegistry>();
     mockRegistry_ = mockRegistry.get();
-    timerManager_ = std::make_shared<TimerManager>(std::move(mockRegistry));
+    timerManager_ = std::make_shared<TimerManager>(
+        std::move(mockRegistry), [this]() { return now_; });
     auto onJsError =
         [](jsi::Runtime& /*runtime*/,
            const JsErrorHandler::ProcessedError& /*error*/) noexcept {
@@ -214,12 +218,18 @@ class ReactInstanceTest : public ::testing::Test {
     messageQueueThread_->guardedTick();
   }
 
+  // Moves the clock of the timer manager forward.
+  void advanceTime(double milliseconds) {
+    now_ += HighResDuration::fromDOMHighResTimeStamp(milliseconds);
+  }
+
   jsi::Runtime* runtime_;
   std::shared_ptr<MockMessageQueueThread> messageQueueThread_;
   std::unique_ptr<ReactInstance> instance_;
   std::shared_ptr<TimerManager> timerManager_;
   MockTimerRegistry* mockRegistry_;
   std::shared_ptr<ErrorUtils> errorHandler_;
+  HighResTimeStamp now_{HighResTimeStamp::now()};
 };
 
 TEST_F(ReactInstanceTest, testBridgelessFlagIsSet) {
@@ -253,6 +263,7 @@ function getResult() {
   return called;
 }
   )xyz123");
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
   auto called = runtime_->global()
@@ -354,11 +365,12 @@ function clear() {
 }
   )xyz123");
   // Call the timer
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
 
-  // Now clear the called timer
-  EXPECT_CALL(*mockRegistry_, deleteTimer(timerID));
+  // Now clear the called timer. The wakeup was already consumed.
+  EXPECT_CALL(*mockRegistry_, deleteTimer(_)).Times(0);
   auto clear = runtime_->global().getPropertyAsFunction(*runtime_, "clear");
   EXPECT_NO_THROW(clear.call(*runtime_));
 }
@@ -367,8 +379,8 @@ TEST_F(ReactInstanceTest, testSetInterval) {
   initializeRuntimeWithScript("");
 
   uint32_t timerID{0};
-  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, 100))
-      .WillOnce(SaveArg<0>(&timerID));
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillRepeatedly(SaveArg<0>(&timerID));
   eval(R"xyz123(
 let result = 0;
 setInterval(() => {
@@ -378,6 +390,7 @@ function getResult() {
   return result;
 }
   )xyz123");
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
   auto getResult =
@@ -385,6 +398,7 @@ function getResult() {
   EXPECT_EQ(getResult.call(*runtime_).asNumber(), 1.0);
 
   // Should be able to call the same callback again.
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
   EXPECT_EQ(getResult.call(*runtime_).asNumber(), 2.0);
@@ -394,8 +408,8 @@ TEST_F(ReactInstanceTest, testSetIntervalWithPassThroughArgs) {
   initializeRuntimeWithScript("");
 
   uint32_t timerID{0};
-  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, 100))
-      .WillOnce(SaveArg<0>(&timerID));
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillRepeatedly(SaveArg<0>(&timerID));
   eval(R"xyz123(
 let result;
 setInterval(arg => {
@@ -405,6 +419,7 @@ function getResult() {
   return result;
 }
   )xyz123");
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
 
@@ -430,8 +445,8 @@ TEST_F(ReactInstanceTest, testClearInterval) {
   initializeRuntimeWithScript("");
 
   uint32_t timerID{0};
-  EXPECT_CALL(*mockRegistry_, createRecurringTimer(_, 100))
-      .WillOnce(SaveArg<0>(&timerID));
+  EXPECT_CALL(*mockRegistry_, createTimer(_, 100))
+      .WillRepeatedly(SaveArg<0>(&timerID));
   eval(R"xyz123(
 let result = 0;
 const handle = setInterval(() => {
@@ -444,6 +459,7 @@ function getResult() {
   return result;
 }
   )xyz123");
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
   auto getResult =
@@ -454,6 +470,7 @@ function getResult() {
   runtime_->global().getPropertyAsFunction(*runtime_, "clear").call(*runtime_);
   step();
 
+  advanceTime(100);
   timerManager_->callTimer(timerID);
   step();
   // Callback should not have been invoked again.
@@ -476,6 +493,104 @@ TEST_F(ReactInstanceTest, testClearIntervalWithInvalidArgs) {
   expectNoError();
 }
 
+TEST_F(ReactInstanceTest, testTimersShareOneWakeup) {
+  initializeRuntimeWithScript("");
+
+  // Only timers that expire before the scheduled wakeup reschedule it.
+  EXPECT_CALL(
+      *mockRegistry_, createTimer(TimerManager::kWakeupTimerHandle, 100));
+  EXPECT_CALL(
+      *mockRegistry_, createTimer(TimerManager::kWakeupTimerHandle, 50));
+  eval(R"xyz123(
+const calls = [];
+setTimeout(() => calls.push('b'), 100);
+setTimeout(() => calls.push('a'), 50);
+setTimeout(() => calls.push('c'), 200);
+setTimeout(() => calls.push('d'), 200);
+const handle = setTimeout(() => calls.push('e'), 200);
+clearTimeout(handle);
+function getResult() {
+  return calls.join(',');
+}
+  )xyz123");
+  auto getResult =
+      runtime_->global().getPropertyAsFunction(*runtime_, "getResult");
+
+  // Every timer that expired is called in a single task, by deadline.
+  EXPECT_CALL(
+      *mockRegistry_, createTimer(TimerManager::kWakeupTimerHandle, 100));
+  advanceTime(100);
+  timerManager_->callTimer(TimerManager::kWakeupTimerHandle);
+  step();
+  EXPECT_EQ(
+      getResult.call(*runtime_).asString(*runtime_).utf8(*runtime_), "a,b");
+
+  EXPECT_CALL(*mockRegistry_, deleteTimer(TimerManager::kWakeupTimerHandle));
+  advanceTime(100);
+  timerManager_->callTimer(TimerManager::kWakeupTimerHandle);
+  step();
+  EXPECT_EQ(
+      getResult.call(*runtime_).asString(*runtime_).utf8(*runtime_),
+      "a,b,c,d");
+}
+
+TEST_F(ReactInstanceTest, testMicrotasksRunAfterEachTimer) {
+  initializeRuntimeWithScript("");
+
+  eval(R"xyz123(
+const calls = [];
+setTimeout(() => {
+  calls.push('a');
+  Promise.resolve().then(() => calls.push('a.then'));
+}, 100);
+setTimeout(() => {
+  calls.push('b');
+  Promise.resolve().then(() => calls.push('b.then'));
+}, 100);
+function getResult() {
+  return calls.join(',');
+}
+  )xyz123");
+
+  // Both timers are called in the same batch, but the continuations of the
+  // first one run before the second one, as they would on the web.
+  advanceTime(100);
+  timerManager_->callTimer(TimerManager::kWakeupTimerHandle);
+  step();
+  auto result = runtime_->global()
+                    .getPropertyAsFunction(*runtime_, "getResult")
+                    .call(*runtime_);
+  EXPECT_EQ(result.asString(*runtime_).utf8(*runtime_), "a,a.then,b,b.then");
+}
+
+TEST_F(ReactInstanceTest, testTimerErrorDoesNotCancelOtherTimers) {
+  initializeRuntimeWithScript("");
+
+  eval(R"xyz123(
+let called = false;
+setTimeout(() => {
+  throw new Error('timer error');
+}, 100);
+setTimeout(() => {
+  called = true;
+}, 100);
+function getResult() {
+  return called;
+}
+  )xyz123");
+  advanceTime(100);
+  timerManager_->callTimer(TimerManager::kWakeupTimerHandle);
+  step();
+  expectError();
+
+  // The rest of the batch is called in another task.
+  step();
+  auto called = runtime_->global()
+                    .getPropertyAsFunction(*runtime_, "getResult")
+                    .call(*runtime_);
+  EXPECT_EQ(called.getBool(), true);
+}
+
 TEST_F(ReactInstanceTest, testRequestAnimationFrame) {
   initializeRuntimeWithScript("");
 
@@ -630,7 +745,8 @@ function getResult() {
                     .call(*runtime_);
   EXPECT_EQ(called.getBool(), true);
 
-  EXPECT_CALL(*mockRegistry_, deleteTimer(timerID));
+  // The wakeup was already consumed.
+  EXPECT_CALL(*mockRegistry_, deleteTimer(_)).Times(0);
   auto clear = runtime_->global().getPropertyAsFunction(*runtime_, "clear");
   // Canceling an expired timer should fail silently.
   EXPECT_NO_THROW(clear.call(*runtime_));
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/runtime/TimerWheel.h>
+
+namespace facebook::react {
+
+TEST(TimerWheelTest, testTimersExpireAtTheirDeadline) {
+  auto wheel = TimerWheel{};
+  // Deadlines on every level, and on the boundaries between them.
+  auto deadlines = std::vector<uint64_t>{
+      1, 63, 64, 65, 100, 4095, 4096, 4097, 300'000, 1ull << 30, 1ull << 40};
+  for (size_t i = 0; i < deadlines.size(); i++) {
+    wheel.schedule(static_cast<TimerHandle>(i + 1), deadlines[i]);
+  }
+  EXPECT_EQ(wheel.size(), deadlines.size());
+
+  auto expired = std::vector<TimerHandle>{};
+  for (size_t i = 0; i < deadlines.size(); i++) {
+    EXPECT_EQ(wheel.nextDeadline(), deadlines[i]);
+
+    wheel.advance(deadlines[i] - 1, expired);
+    EXPECT_TRUE(expired.empty());
+
+    wheel.advance(deadlines[i], expired);
+    EXPECT_EQ(
+        expired, std::vector<TimerHandle>{static_cast<TimerHandle>(i) + 1});
+    expired.clear();
+  }
+
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.nextDeadline(), std::nullopt);
+}
+
+TEST(TimerWheelTest, testTimersExpireByDeadlineThenHandle) {
+  auto wheel = TimerWheel{};
+  wheel.schedule(1, 5000);
+  wheel.schedule(2, 20);
+  wheel.schedule(3, 5000);
+  wheel.schedule(4, 10);
+
+  auto expired = std::vector<TimerHandle>{};
+  wheel.advance(10'000, expired);
+  EXPECT_EQ(expired, (std::vector<TimerHandle>{4, 2, 1, 3}));
+  EXPECT_EQ(wheel.time(), 10'000);
+}
+
+TEST(TimerWheelTest, testPastDeadlinesExpireOnNextAdvance) {
+  auto wheel = TimerWheel{};
+  auto expired = std::vector<TimerHandle>{};
+  wheel.advance(100, expired);
+
+  wheel.schedule(1, 100);
+  wheel.schedule(2, 50);
+  EXPECT_EQ(wheel.nextDeadline(), 50);
+
+  wheel.advance(100, expired);
+  EXPECT_EQ(expired, (std::vector<TimerHandle>{2, 1}));
+}
+
+TEST(TimerWheelTest, testCancel) {
+  auto wheel = TimerWheel{};
+  auto first = wheel.schedule(1, 10);
+  auto second = wheel.schedule(2, 100'000);
+  wheel.schedule(3, 100'000);
+
+  EXPECT_TRUE(wheel.cancel(second, 2));
+  EXPECT_FALSE(wheel.cancel(second, 2));
+  EXPECT_EQ(wheel.size(), 2);
+
+  auto expired = std::vector<TimerHandle>{};
+  wheel.advance(10, expired);
+  EXPECT_EQ(expired, std::vector<TimerHandle>{1});
+  EXPECT_FALSE(wheel.cancel(first, 1));
+
+  // The entry of an expired timer is reused, and does not cancel the new one.
+  auto reused = wheel.schedule(4, 20);
+  EXPECT_EQ(reused, first);
+  EXPECT_FALSE(wheel.cancel(reused, 1));
+  EXPECT_EQ(wheel.nextDeadline(), 20);
+
+  expired.clear();
+  wheel.advance(200'000, expired);
+  EXPECT_EQ(expired, (std::vector<TimerHandle>{4, 3}));
+}
+
+TEST(TimerWheelTest, testMatchesOrderedMap) {
+  auto wheel = TimerWheel{};
+  auto reference = std::set<std::pair<uint64_t, TimerHandle>>{};
+  auto entries = std::unordered_map<TimerHandle, TimerWheel::EntryId>{};
+  auto deadlines = std::unordered_map<TimerHandle, uint64_t>{};
+  auto random = std::mt19937{42};
+  TimerHandle nextHandle = 1;
+  auto expired = std::vector<TimerHandle>{};
+
+  for (int step = 0; step < 20'000; step++) {
+    auto action = random() % 8;
+    if (action < 5) {
+      // Mostly short delays, with the occasional long one.
+      auto delay = random() % 8 == 0 ? random() % 10'000'000 : random() % 200;
+      auto deadline = wheel.time() + delay;
+      auto handle = nextHandle++;
+      entries[handle] = wheel.schedule(handle, deadline);
+      deadlines[handle] = deadline;
+      reference.emplace(deadline, handle);
+    } else if (action < 7 && !entries.empty()) {
+      auto it = entries.begin();
+      std::advance(it, random() % entries.size());
+      auto handle = it->first;
+      EXPECT_TRUE(wheel.cancel(it->second, handle));
+      reference.erase({deadlines[handle], handle});
+      entries.erase(it);
+    } else {
+      auto time = wheel.time() + random() % 500;
+      if (random() % 50 == 0) {
+        time += random() % 10'000'000;
+      }
+      wheel.advance(time, expired);
+
+      auto expected = std::vector<TimerHandle>{};
+      while (!reference.empty() && reference.begin()->first <= time) {
+        auto handle = reference.begin()->second;
+        expected.push_back(handle);
+        entries.erase(handle);
+        reference.erase(reference.begin());
+      }
+      ASSERT_EQ(expired, expected);
+      expired.clear();
+    }
+
+    ASSERT_EQ(wheel.size(), reference.size());
+    if (reference.empty()) {
+      ASSERT_EQ(wheel.nextDeadline(), std::nullopt);
+    } else {
+      ASSERT_EQ(wheel.nextDeadline(), reference.begin()->first);
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace facebook::react {
+
+/*
+ * Equality used to find an interned value to share. Since the shared value
+ * replaces the interned one, it must be exact: types whose `==` is more
+ * lenient (e.g. ignores some fields, or compares floats with a tolerance)
+ * specialize it.
+ */
+template <typename T>
+struct InternedEqual {
+  bool operator()(const T& lhs, const T& rhs) const {
+    return lhs == rhs;
+  }
+};
+
+/*
+ * Immutable, reference-counted value of type `T` which shares its storage
+ * with all other live `Interned<T>` holding an equal value.
+ *
+ * Copying an `Interned<T>` only copies a pointer, its hash is computed once
+ * when the value is interned, and two interned values are usually compared by
+ * comparing their storage pointers. Values are removed from the intern table
+ * once no `Interned<T>` refers to them anymore.
+ *
+ * `T` must be hashable with `std::hash<T>` and comparable with `==`. Values
+ * are only shared when they are equal according to `InternedEqual<T>`.
+ * Equality of `Interned<T>` falls back to comparing values with `==` when
+ * the storage differs, so types whose equality is more lenient than their
+ * hash (e.g. floats compared with a tolerance) keep their semantics.
+ *
+ * Interning takes a lock, so it should happen when values are produced (e.g.
+ * when a shadow node is created), not when they are read. Can be used from
+ * any thread.
+ */
+template <typename T>
+class Interned final {
+ public:
+  /*
+   * Holds the default-constructed `T`.
+   */
+  Interned() : storage_(getDefaultStorage()) {}
+
+  template <typename U = T>
+    requires(
+        !std::is_same_v<std::remove_cvref_t<U>, Interned> &&
+        std::is_constructible_v<T, U &&>)
+  Interned(U&& value) : storage_(intern(T(std::forward<U>(value)))) {}
+
+  const T& get() const {
+    return storage_->value;
+  }
+
+  const T& operator*() const {
+    return storage_->value;
+  }
+
+  const T* operator->() const {
+    return &storage_->value;
+  }
+
+  operator const T&() const {
+    return storage_->value;
+  }
+
+  /*
+   * Returns the precomputed `std::hash<T>` of the value.
+   */
+  size_t hash() const {
+    return storage_->hash;
+  }
+
+  bool operator==(const Interned& rhs) const {
+    if (storage_ == rhs.storage_) {
+      return true;
+    }
+    if (kHashMatchesEquality && storage_->hash != rhs.storage_->hash) {
+      return false;
+    }
+    return storage_->value == rhs.storage_->value;
+  }
+
+  bool operator==(const T& rhs) const {
+    return storage_->value == rhs;
+  }
+
+  /*
+   * Returns the number of distinct values of type `T` currently interned.
+   */
+  static size_t getInternedCount() {
+    auto& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.entries.size();
+  }
+
+ private:
+  struct Storage {
+    T value;
+    size_t hash;
+  };
+
+  struct Entry {
+    const Storage* storage;
+    std::weak_ptr<const Storage> weakStorage;
+  };
+
+  struct Table {
+    std::mutex mutex;
+    std::unordered_multimap<size_t, Entry> entries;
+  };
+
+  /*
+   * Whether values which are equal always have the same hash, which allows to
+   * skip comparing values with different hashes.
+   */
+  static constexpr bool kHashMatchesEquality = std::is_integral_v<T> ||
+      std::is_enum_v<T> || std::is_same_v<T, std::string>;
+
+  static Table& getTable() {
+    // Leaked, so values outliving static destruction can still be released.
+    static auto& table = *new Table();
+    return table;
+  }
+
+  static const std::shared_ptr<const Storage>& getDefaultStorage() {
+    static const auto storage = intern(T{});
+    return storage;
+  }
+
+  static std::shared_ptr<const Storage> intern(T&& value) {
+    auto hash = std::hash<T>{}(value);
+    auto& table = getTable();
+
+    // Releasing the last reference to a mismatching value would remove it from
+    // the table, so these are only released once the lock isn't held anymore.
+    auto mismatches = std::vector<std::shared_ptr<const Storage>>{};
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    auto [begin, end] = table.entries.equal_range(hash);
+    for (auto it = begin; it != end; it++) {
+      auto storage = it->second.weakStorage.lock();
+      if (!storage) {
+        continue;
+      }
+      if (InternedEqual<T>{}(storage->value, value)) {
+        return storage;
+      }
+      mismatches.push_back(std::move(storage));
+    }
+
+    auto* rawStorage = new Storage{std::move(value), hash};
+    auto storage =
+        std::shared_ptr<const Storage>(rawStorage, &Interned::release);
+    table.entries.emplace(hash, Entry{rawStorage, storage});
+    return storage;
+  }
+
+  static void release(const Storage* storage) {
+    {
+      auto& table = getTable();
+      std::lock_guard<std::mutex> lock(table.mutex);
+      auto [begin, end] = table.entries.equal_range(storage->hash);
+      for (auto it = begin; it != end; it++) {
+        if (it->second.storage == storage) {
+          table.entries.erase(it);
+          break;
+        }
+      }
+    }
+    delete storage;
+  }
+
+  std::shared_ptr<const Storage> storage_;
+};
+
+} // namespace facebook::react
+
+namespace std {
+
+template <typename T>
+struct hash<facebook::react::Interned<T>> {
+  size_t operator()(const facebook::react::Interned<T>& interned) const {
+    return interned.hash();
+  }
+};
+
+} // namespace std
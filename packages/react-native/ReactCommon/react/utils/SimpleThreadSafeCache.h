@@ -47,14 +47,37 @@ class SimpleThreadSafeCache {
     }
 
     auto value = generator();
-    // Add new value to front of list and map
-    list_.emplace_front(key, value);
-    map_[key] = list_.begin();
-    if (list_.size() > maxSize_) {
-      // Evict least recently used item (back of list)
-      map_.erase(list_.back().first);
-      list_.pop_back();
+    insert(key, value);
+    return value;
+  }
+
+  /*
+   * Same as `get`, but the generator function runs without holding the lock
+   * of the cache, so that expensive values can be constructed for several
+   * keys in parallel. Threads that miss the same key concurrently may all run
+   * the generator, in which case the first value stored is returned to all of
+   * them.
+   * Can be called from any thread.
+   */
+  ValueT getConcurrently(
+      const KeyT& key,
+      CacheGeneratorFunction<ValueT> auto generator) const {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (auto it = map_.find(key); it != map_.end()) {
+        list_.splice(list_.begin(), list_, it->second);
+        return it->second->second;
+      }
     }
+
+    auto value = generator();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (auto it = map_.find(key); it != map_.end()) {
+      list_.splice(list_.begin(), list_, it->second);
+      return it->second->second;
+    }
+    insert(key, value);
     return value;
   }
 
@@ -79,6 +102,18 @@ class SimpleThreadSafeCache {
   using EntryT = std::pair<KeyT, ValueT>;
   using iterator = typename std::list<EntryT>::iterator;
 
+  // Must be called with `mutex_` held.
+  void insert(const KeyT& key, const ValueT& value) const {
+    // Add new value to front of list and map
+    list_.emplace_front(key, value);
+    map_[key] = list_.begin();
+    if (list_.size() > maxSize_) {
+      // Evict least recently used item (back of list)
+      map_.erase(list_.back().first);
+      list_.pop_back();
+    }
+  }
+
   size_t maxSize_;
   mutable std::mutex mutex_;
   mutable std::list<EntryT> list_;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <react/utils/Interned.h>
+
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+/*
+ * Compares with a tolerance, like most of the renderer's float attributes.
+ */
+struct Approximate {
+  float value;
+
+  bool operator==(const Approximate& rhs) const {
+    return std::abs(value - rhs.value) < 0.01f;
+  }
+};
+
+/*
+ * Ignores its label when compared, like attributes that don't affect layout.
+ */
+struct Labeled {
+  int value;
+  std::string label;
+
+  bool operator==(const Labeled& rhs) const {
+    return value == rhs.value;
+  }
+};
+
+} // namespace
+
+template <>
+struct InternedEqual<Labeled> {
+  bool operator()(const Labeled& lhs, const Labeled& rhs) const {
+    return lhs.value == rhs.value && lhs.label == rhs.label;
+  }
+};
+
+} // namespace facebook::react
+
+template <>
+struct std::hash<facebook::react::Approximate> {
+  size_t operator()(const facebook::react::Approximate& approximate) const {
+    return std::hash<float>{}(approximate.value);
+  }
+};
+
+template <>
+struct std::hash<facebook::react::Labeled> {
+  size_t operator()(const facebook::react::Labeled& labeled) const {
+    return std::hash<int>{}(labeled.value);
+  }
+};
+
+namespace facebook::react {
+
+TEST(InternedTest, testDefaultConstructor) {
+  auto interned = Interned<std::string>{};
+
+  EXPECT_EQ(*interned, "");
+  EXPECT_EQ(interned, Interned<std::string>{});
+  EXPECT_EQ(interned.hash(), std::hash<std::string>{}(""));
+}
+
+TEST(InternedTest, testEqualValuesShareStorage) {
+  auto first = Interned<std::string>{std::string{"hello world"}};
+  auto second = Interned<std::string>{"hello world"};
+  auto third = Interned<std::string>{"goodbye"};
+
+  EXPECT_EQ(&first.get(), &second.get());
+  EXPECT_NE(&first.get(), &third.get());
+  EXPECT_EQ(first, second);
+  EXPECT_NE(first, third);
+  EXPECT_EQ(first, std::string{"hello world"});
+  EXPECT_EQ(first.hash(), std::hash<std::string>{}("hello world"));
+  EXPECT_EQ(std::hash<Interned<std::string>>{}(first), first.hash());
+}
+
+TEST(InternedTest, testValuesAreReleased) {
+  auto count = Interned<std::string>::getInternedCount();
+  {
+    auto first = Interned<std::string>{"released"};
+    auto second = first;
+    EXPECT_EQ(Interned<std::string>::getInternedCount(), count + 1);
+  }
+  EXPECT_EQ(Interned<std::string>::getInternedCount(), count);
+
+  auto interned = Interned<std::string>{"released"};
+  EXPECT_EQ(*interned, "released");
+}
+
+TEST(InternedTest, testAssignment) {
+  auto interned = Interned<std::string>{"first"};
+  interned = "second";
+  EXPECT_EQ(*interned, "second");
+  EXPECT_EQ(interned->size(), 6);
+}
+
+TEST(InternedTest, testLenientEquality) {
+  auto first = Interned<Approximate>{Approximate{1.0f}};
+  auto second = Interned<Approximate>{Approximate{1.001f}};
+
+  EXPECT_EQ(first, second);
+}
+
+TEST(InternedTest, testInternedEqualSpecialization) {
+  auto first = Interned<Labeled>{Labeled{1, "first"}};
+  auto second = Interned<Labeled>{Labeled{1, "second"}};
+  auto third = Interned<Labeled>{Labeled{1, "first"}};
+
+  // Values are only shared when they are identical...
+  EXPECT_NE(&first.get(), &second.get());
+  EXPECT_EQ(second->label, "second");
+  EXPECT_EQ(&first.get(), &third.get());
+
+  // ...but still compare with `==`.
+  EXPECT_EQ(first, second);
+}
+
+TEST(InternedTest, testConcurrentInterning) {
+  auto threads = std::vector<std::thread>{};
+  auto results = std::vector<std::vector<Interned<std::string>>>(4);
+  for (auto& result : results) {
+    threads.emplace_back([&]() {
+      for (int i = 0; i < 1000; i++) {
+        result.emplace_back(std::to_string(i % 10));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const auto& result : results) {
+    for (size_t i = 0; i < result.size(); i++) {
+      EXPECT_EQ(&result[i].get(), &results[0][i % 10].get());
+    }
+  }
+}
+
+} // namespace facebook::react
@@ -8,6 +8,10 @@
 #include <gtest/gtest.h>
 #include <react/utils/SimpleThreadSafeCache.h>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace facebook::react {
 
 TEST(EvictingCacheMapTest, BasicInsertAndGet) {
@@ -37,4 +41,46 @@ TEST(EvictingCacheMapTest, Eviction) {
   EXPECT_EQ(cache.get(3), "three");
 }
 
+TEST(EvictingCacheMapTest, GetConcurrently) {
+  SimpleThreadSafeCache<int, std::string, 2> cache;
+  EXPECT_EQ(
+      cache.getConcurrently(1, []() { return std::string("one"); }), "one");
+  EXPECT_EQ(
+      cache.getConcurrently(1, []() { return std::string("other"); }), "one");
+  EXPECT_EQ(cache.get(1), "one");
+
+  // The generator may use the cache itself.
+  EXPECT_EQ(
+      cache.getConcurrently(
+          2, [&]() { return cache.get(1, []() { return std::string(); }); }),
+      "one");
+}
+
+TEST(EvictingCacheMapTest, GetConcurrentlyRunsGeneratorsInParallel) {
+  SimpleThreadSafeCache<int, std::string, 2> cache;
+  std::atomic<int> runningGenerators{0};
+
+  // Each generator waits for the other one to start, which only happens if
+  // they don't hold the lock of the cache.
+  auto generator = [&]() {
+    runningGenerators++;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (runningGenerators < 2 &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    return std::to_string(runningGenerators.load());
+  };
+
+  auto first = std::string{};
+  auto second = std::string{};
+  auto thread = std::thread(
+      [&]() { first = cache.getConcurrently(1, generator); });
+  second = cache.getConcurrently(2, generator);
+  thread.join();
+
+  EXPECT_EQ(first, "2");
+  EXPECT_EQ(second, "2");
+}
+
 } // namespace facebook::react
@@ -25,6 +25,23 @@ export type NativeNodeReference =
   | NativeTextReference
   | RootTag;
 
+/**
+ * Layout reads supported by `getLayoutBatch`. They must be kept in sync with
+ * `DOMLayoutQuery` in `react/renderer/dom/DOM.h`.
+ */
+export const LayoutQuery = Object.freeze({
+  // [x, y, width, height] for each node, including transforms.
+  BoundingClientRect: 0,
+  // [x, y, width, height] for each node, excluding transforms.
+  BoundingClientRectWithoutTransform: 1,
+  // [scrollLeft, scrollTop] for each node.
+  ScrollPosition: 2,
+  // [top, left] for each node, relative to its offset parent.
+  Offset: 3,
+});
+
+export type LayoutQueryValue = $Values<typeof LayoutQuery>;
+
 export type MeasureInWindowOnSuccessCallback = (
   x: number,
   y: number,
@@ -126,6 +143,15 @@ export interface Spec extends TurboModule {
     nativeElementReference: mixed /* NativeElementReference */,
   ) => $ReadOnlyArray<mixed> /* [offsetParent: ?InstanceHandle, top: number, left: number] */;
 
+  /*
+   * Batched layout APIs.
+   */
+
+  +getLayoutBatch?: (
+    nativeElementReferences: $ReadOnlyArray<mixed> /* $ReadOnlyArray<NativeElementReference> */,
+    query: number /* LayoutQuery */,
+  ) => mixed /* Float64Array */;
+
   /*
    * Special methods to handle the root node.
    */
@@ -379,6 +405,26 @@ export interface RefinedSpec {
     ],
   >;
 
+  /*
+   * Batched layout APIs.
+   */
+
+  /**
+   * Performs the given layout read (e.g.: `getBoundingClientRect`) for all
+   * the given elements at once, using the same revision of the shadow tree
+   * for all of them, and returns the results in a single `Float64Array`
+   * (with a fixed number of values per element, in the same order as the
+   * elements). Elements that are not connected or not displayed produce
+   * zeros.
+   *
+   * This is significantly cheaper than calling the single-element methods in
+   * a loop when measuring many elements (e.g.: the cells of a list).
+   */
+  +getLayoutBatch: (
+    nativeElementReferences: $ReadOnlyArray<NativeElementReference>,
+    query: LayoutQueryValue,
+  ) => Float64Array;
+
   /*
    * Special methods to handle the root node.
    */
@@ -560,6 +606,18 @@ const NativeDOM: RefinedSpec = {
     >);
   },
 
+  /*
+   * Batched layout APIs.
+   */
+
+  getLayoutBatch(nativeElementReferences, query) {
+    // $FlowExpectedError[incompatible-cast]
+    return (nullthrows(RawNativeDOM?.getLayoutBatch)(
+      nativeElementReferences,
+      query,
+    ): Float64Array);
+  },
+
   /*
    * Special methods to handle the root node.
    */